@@ -0,0 +1,44 @@
+#include <array>
+#include <benchmark/benchmark.h>
+#include "base/BitWriter.hpp"
+
+static void BitWriter_WriteWordUnaligned(benchmark::State& state)
+{
+    std::array<std::uint8_t, 256> buffer;
+    const auto bits = static_cast<std::uint8_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        BitWriter writer(buffer);
+        while (writer.WriteWord(0x5A5A, bits))
+        {
+        }
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BitWriter_WriteWordUnaligned)->Arg(1)->Arg(3)->Arg(8)->Arg(13)->Arg(16);
+
+static void BitWriter_WriteMixedLayout(benchmark::State& state)
+{
+    std::array<std::uint8_t, 256> buffer;
+
+    for (auto _ : state)
+    {
+        BitWriter writer(buffer);
+        for (int i = 0; i < 32; i++)
+        {
+            writer.WriteWord(0x3FF, 10);
+            writer.Write(true);
+            writer.WriteDoubleWord(0x12345678, 22);
+            writer.Write(static_cast<std::uint8_t>(i));
+        }
+
+        benchmark::DoNotOptimize(writer.GetBitDataLength());
+    }
+}
+
+BENCHMARK(BitWriter_WriteMixedLayout);
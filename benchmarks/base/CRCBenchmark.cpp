@@ -0,0 +1,23 @@
+#include <array>
+#include <benchmark/benchmark.h>
+#include "base/crc.h"
+
+static void CRC_Calculate(benchmark::State& state)
+{
+    std::array<std::uint8_t, 4096> buffer;
+    for (std::size_t i = 0; i < buffer.size(); i++)
+    {
+        buffer[i] = static_cast<std::uint8_t>(i * 7);
+    }
+
+    const auto area = gsl::make_span(buffer).subspan(0, state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(CRC_calc(area));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(CRC_Calculate)->Arg(32)->Arg(235)->Arg(4096);
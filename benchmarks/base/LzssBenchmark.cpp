@@ -0,0 +1,46 @@
+#include <algorithm>
+#include <array>
+#include <random>
+#include <benchmark/benchmark.h>
+#include "base/lzss.hpp"
+
+/**
+ * @brief Fills buffer with data resembling experiment file - short data packets separated by 0xFF padding
+ * @param[out] buffer Buffer to fill
+ * @param[in] packetSize Size of data packet in each 256-byte block
+ */
+static void FillExperimentFile(gsl::span<std::uint8_t> buffer, std::size_t packetSize)
+{
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> bytes(0, 255);
+
+    std::fill(buffer.begin(), buffer.end(), 0xFF);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(buffer.size()); i++)
+    {
+        if (i % 256 < packetSize)
+        {
+            buffer[i] = static_cast<std::uint8_t>(bytes(generator));
+        }
+    }
+}
+
+static void Lzss_CompressPart(benchmark::State& state)
+{
+    std::array<std::uint8_t, 2048> input;
+    FillExperimentFile(input, state.range(0));
+
+    std::array<std::uint8_t, 220> output;
+    lzss::CompressionResult result{0, 0};
+
+    for (auto _ : state)
+    {
+        result = lzss::Compress(input, output);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * result.Consumed);
+    state.counters["consumed"] = result.Consumed;
+    state.counters["ratio"] = static_cast<double>(result.Consumed) / std::max<std::size_t>(result.Produced, 1);
+}
+
+BENCHMARK(Lzss_CompressPart)->Arg(0)->Arg(16)->Arg(64)->Arg(256);
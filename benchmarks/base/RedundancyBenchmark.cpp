@@ -0,0 +1,42 @@
+#include <array>
+#include <benchmark/benchmark.h>
+#include "redundancy.hpp"
+
+static void Redundancy_CorrectBuffer3(benchmark::State& state)
+{
+    std::array<std::uint8_t, 4096> a;
+    std::array<std::uint8_t, 4096> b;
+    std::array<std::uint8_t, 4096> c;
+    a.fill(0x55);
+    b.fill(0x55);
+    c.fill(0x55);
+    b[100] = 0x54;
+
+    const auto size = state.range(0);
+
+    for (auto _ : state)
+    {
+        auto result = redundancy::CorrectBuffer(gsl::make_span(a).subspan(0, size), //
+            gsl::make_span(b).subspan(0, size),                                    //
+            gsl::make_span(c).subspan(0, size));
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+BENCHMARK(Redundancy_CorrectBuffer3)->Arg(256)->Arg(4096);
+
+static void Redundancy_VoteWord(benchmark::State& state)
+{
+    std::uint32_t a = 0x12345678, b = 0x12345678, c = 0x12345679;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(redundancy::Vote(a, b, c));
+        benchmark::DoNotOptimize(redundancy::Correct(a, b, c));
+    }
+}
+
+BENCHMARK(Redundancy_VoteWord);
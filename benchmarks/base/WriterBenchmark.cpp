@@ -0,0 +1,46 @@
+#include <array>
+#include <benchmark/benchmark.h>
+#include "base/writer.h"
+
+static void Writer_WriteDoubleWordLE(benchmark::State& state)
+{
+    std::array<std::uint8_t, 256> buffer;
+
+    for (auto _ : state)
+    {
+        Writer writer(buffer);
+        std::uint32_t value = 0;
+        while (writer.WriteDoubleWordLE(value++))
+        {
+        }
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(Writer_WriteDoubleWordLE);
+
+static void Writer_WriteArray(benchmark::State& state)
+{
+    std::array<std::uint8_t, 1024> buffer;
+    std::array<std::uint8_t, 1024> source;
+    source.fill(0xAA);
+
+    const auto chunk = gsl::make_span(source).subspan(0, state.range(0));
+
+    for (auto _ : state)
+    {
+        Writer writer(buffer);
+        while (writer.WriteArray(chunk))
+        {
+        }
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(Writer_WriteArray)->Arg(4)->Arg(32)->Arg(230);
@@ -0,0 +1,15 @@
+function(add_benchmarks NAME)
+    add_executable(${NAME} ${ARGN})
+    list(APPEND BENCHMARK_EXECUTABLES ${NAME})
+
+    set(BENCHMARK_EXECUTABLES "${BENCHMARK_EXECUTABLES}" CACHE INTERNAL "list of benchmarks")
+
+    target_link_libraries(${NAME} benchmark_main)
+
+    set (EXEC_OBJ $<TARGET_FILE:${NAME}>)
+    add_custom_target(${NAME}.run
+      COMMAND ${EXEC_OBJ} --benchmark_out=${OUTPUT_PATH}/${NAME}.json --benchmark_out_format=json
+
+      DEPENDS ${NAME}
+    )
+endfunction()
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <thread>
+#include <benchmark/benchmark.h>
+#include "comm/CommDriver.hpp"
+#include "comm/Frame.hpp"
+#include "comm/IHandleFrame.hpp"
+#include "error_counter/error_counter.hpp"
+#include "i2c/i2c.h"
+#include "Scheduler.hpp"
+
+using devices::comm::Address;
+using devices::comm::CommObject;
+using devices::comm::Frame;
+using devices::comm::ITransmitter;
+using devices::comm::ReceiverCommand;
+using drivers::i2c::I2CAddress;
+using drivers::i2c::I2CResult;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    /**
+     * @brief Simulation of comm receiver holding given number of frames
+     */
+    class ReceiverSimulator final : public drivers::i2c::II2CBus
+    {
+      public:
+        void Reset()
+        {
+            this->Transactions = 0;
+            this->Removed = 0;
+            this->Residency = Clock::duration::zero();
+            this->_pending = 0;
+        }
+
+        void Load(std::uint16_t frames)
+        {
+            this->_pending = frames;
+            this->_start = Clock::now();
+        }
+
+        virtual I2CResult Write(const I2CAddress address, gsl::span<const uint8_t> inData) override
+        {
+            this->Transactions++;
+            this->_command = inData[0];
+
+            if (address == num(Address::Receiver) && this->_command == num(ReceiverCommand::RemoveFrame) && this->_pending > 0)
+            {
+                this->_pending--;
+                this->Residency += Clock::now() - this->_start;
+                this->Removed++;
+            }
+
+            return I2CResult::OK;
+        }
+
+        virtual I2CResult Read(const I2CAddress address, gsl::span<uint8_t> outData) override
+        {
+            this->Transactions++;
+            std::fill(outData.begin(), outData.end(), 0x55);
+
+            if (address != num(Address::Receiver))
+            {
+                return I2CResult::OK;
+            }
+
+            if (this->_command == num(ReceiverCommand::GetFrameCount))
+            {
+                outData[0] = this->_pending & 0xFF;
+                outData[1] = this->_pending >> 8;
+            }
+            else if (this->_command == num(ReceiverCommand::GetFrame))
+            {
+                const std::uint8_t header[] = {FrameSize, 0, 0, 0, 0, 0};
+                std::copy_n(header, std::min<std::size_t>(sizeof(header), outData.size()), outData.begin());
+            }
+
+            return I2CResult::OK;
+        }
+
+        virtual I2CResult WriteRead(const I2CAddress /*address*/, gsl::span<const uint8_t> /*inData*/, gsl::span<uint8_t> /*outData*/) override
+        {
+            this->Transactions++;
+            return I2CResult::OK;
+        }
+
+        static constexpr std::uint8_t FrameSize = 180;
+
+        std::uint32_t Transactions = 0;
+        std::uint32_t Removed = 0;
+        Clock::duration Residency = Clock::duration::zero();
+
+      private:
+        std::uint16_t _pending = 0;
+        std::uint8_t _command = 0;
+        Clock::time_point _start;
+    };
+
+    struct ErrorCountingConfiguration final : public error_counter::IErrorCountingConfigration
+    {
+        virtual error_counter::CounterValue Limit(error_counter::Device /*device*/) override
+        {
+            return 255;
+        }
+
+        virtual error_counter::CounterValue Increment(error_counter::Device /*device*/) override
+        {
+            return 0;
+        }
+
+        virtual error_counter::CounterValue Decrement(error_counter::Device /*device*/) override
+        {
+            return 0;
+        }
+    };
+
+    /**
+     * @brief Frame handler that takes given time to handle each frame (e.g. program upload writing to flash)
+     */
+    struct SlowFrameHandler final : public devices::comm::IHandleFrame
+    {
+        virtual void HandleFrame(ITransmitter& /*transmitter*/, Frame& frame) override
+        {
+            benchmark::DoNotOptimize(frame.Payload().data());
+            std::this_thread::sleep_for(Duration);
+        }
+
+        std::chrono::microseconds Duration{0};
+    };
+
+    /**
+     * @brief Comm driver polled directly by benchmarks, created once as its background task never finishes
+     */
+    struct CommReceiveFixture
+    {
+        CommReceiveFixture() : errors(configuration), comm(errors, receiver)
+        {
+            comm.Initialize();
+            comm.SetFrameHandler(handler);
+
+            // task is created suspended and would block on its first sleep holding receiver semaphore,
+            // so it has to be resumed before scheduler lets it run
+            comm.StartTask();
+        }
+
+        void Start(benchmark::State& state)
+        {
+            if (!paused)
+            {
+                // background task would poll receiver concurrently with benchmark, park it for good
+                benchmarks::EnsureSchedulerStarted();
+                comm.Pause();
+                paused = true;
+            }
+
+            handler.Duration = std::chrono::microseconds(state.range(1));
+            receiver.Reset();
+        }
+
+        void Report(benchmark::State& state)
+        {
+            const auto residency = std::chrono::duration_cast<std::chrono::microseconds>(receiver.Residency).count();
+            state.counters["residency_us"] = benchmark::Counter(static_cast<double>(residency) / receiver.Removed);
+            state.counters["i2c_per_frame"] = benchmark::Counter(static_cast<double>(receiver.Transactions) / receiver.Removed);
+            state.SetItemsProcessed(receiver.Removed);
+        }
+
+        ErrorCountingConfiguration configuration;
+        error_counter::ErrorCounting errors;
+        ReceiverSimulator receiver;
+        SlowFrameHandler handler;
+        CommObject comm;
+        bool paused = false;
+    };
+
+    CommReceiveFixture& GetCommReceiveFixture()
+    {
+        static auto fixture = new CommReceiveFixture();
+        return *fixture;
+    }
+
+    // created before main, so before any benchmark starts scheduler
+    CommReceiveFixture& CommReceive = GetCommReceiveFixture();
+
+    CommReceiveFixture& StartCommReceive(benchmark::State& state)
+    {
+        CommReceive.Start(state);
+        return CommReceive;
+    }
+}
+
+/** @brief Frame by frame processing: each frame is handled before it is removed from receiver */
+static void Comm_ReceiveFrameByFrame(benchmark::State& state)
+{
+    auto& fixture = StartCommReceive(state);
+    std::array<std::uint8_t, devices::comm::PrefferedBufferSize> buffer;
+
+    for (auto _ : state)
+    {
+        fixture.receiver.Load(state.range(0));
+
+        const auto count = fixture.comm.GetFrameCount();
+        for (auto i = 0; i < count.frameCount; i++)
+        {
+            Frame frame;
+            if (fixture.comm.ReceiveFrame(buffer, frame))
+            {
+                fixture.handler.HandleFrame(fixture.comm, frame);
+            }
+
+            fixture.comm.RemoveFrame();
+        }
+    }
+
+    fixture.Report(state);
+}
+
+BENCHMARK(Comm_ReceiveFrameByFrame)->Args({8, 0})->Args({8, 5000})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/** @brief Batched processing: frames are retrieved and removed from receiver before they are handled */
+static void Comm_ReceiveBatch(benchmark::State& state)
+{
+    auto& fixture = StartCommReceive(state);
+
+    for (auto _ : state)
+    {
+        fixture.receiver.Load(state.range(0));
+
+        while (fixture.comm.PollHardware())
+        {
+        }
+    }
+
+    fixture.Report(state);
+}
+
+BENCHMARK(Comm_ReceiveBatch)->Args({8, 0})->Args({8, 5000})->Unit(benchmark::kMillisecond)->UseRealTime();
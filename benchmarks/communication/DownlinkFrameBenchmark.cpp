@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <benchmark/benchmark.h>
+#include "base/os.h"
+#include "comm/DownlinkQueue.hpp"
+#include "comm/ITransmitter.hpp"
+#include "telecommunication/downlink.h"
+#include "Scheduler.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkFrame;
+using telecommunication::downlink::CorrelatedDownlinkFrame;
+using telecommunication::downlink::TransmitterDownlinkFrame;
+
+static void Downlink_BuildFrame(benchmark::State& state)
+{
+    std::array<std::uint8_t, DownlinkFrame::MaxPayloadSize> payload;
+    payload.fill(0x11);
+
+    std::uint32_t seq = 0;
+
+    for (auto _ : state)
+    {
+        DownlinkFrame frame(DownlinkAPID::FileSend, seq++);
+        frame.PayloadWriter().WriteArray(payload);
+        benchmark::DoNotOptimize(frame.Frame().data());
+    }
+}
+
+BENCHMARK(Downlink_BuildFrame);
+
+static void Downlink_BuildCorrelatedFrame(benchmark::State& state)
+{
+    std::array<std::uint8_t, CorrelatedDownlinkFrame::MaxPayloadSize> payload;
+    payload.fill(0x22);
+
+    for (auto _ : state)
+    {
+        CorrelatedDownlinkFrame frame(DownlinkAPID::Operation, 0, 0x11);
+        frame.PayloadWriter().WriteArray(payload);
+        benchmark::DoNotOptimize(frame.Frame().data());
+    }
+}
+
+BENCHMARK(Downlink_BuildCorrelatedFrame);
+
+namespace
+{
+    /**
+     * @brief Transmitter that immediately accepts every frame and touches all its bytes
+     */
+    class TransmitterSimulator final : public devices::comm::IFlowControlledTransmitter
+    {
+      public:
+        virtual bool SendFrame(gsl::span<const std::uint8_t> frame) override
+        {
+            std::uint8_t remainingSlots;
+            return SendFrame(frame, remainingSlots);
+        }
+
+        virtual bool SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& remainingSlots) override
+        {
+            std::array<std::uint8_t, devices::comm::PrefferedBufferSize> command;
+            std::copy(frame.begin(), frame.end(), command.begin() + 1);
+            return Transfer(gsl::make_span(command).subspan(0, frame.size() + 1), remainingSlots);
+        }
+
+        virtual bool SendFrameInPlace(devices::comm::DownlinkFrameBuffer& buffer, std::uint8_t frameSize, std::uint8_t& remainingSlots) override
+        {
+            return Transfer(gsl::make_span(buffer).subspan(0, frameSize + devices::comm::DownlinkFrameHeadroom), remainingSlots);
+        }
+
+        virtual devices::comm::DownlinkFrameBuffer* AcquireFrameBuffer() override
+        {
+            return nullptr;
+        }
+
+        virtual bool SendFrameBuffer(devices::comm::DownlinkFrameBuffer& /*buffer*/, std::uint8_t /*frameSize*/) override
+        {
+            return false;
+        }
+
+        virtual void ReleaseFrameBuffer(devices::comm::DownlinkFrameBuffer& /*buffer*/) override
+        {
+        }
+
+        virtual bool GetTransmitterTelemetry(devices::comm::TransmitterTelemetry& /*telemetry*/) override
+        {
+            return false;
+        }
+
+        virtual bool SetTransmitterStateWhenIdle(devices::comm::IdleState /*requestedState*/) override
+        {
+            return true;
+        }
+
+        virtual bool SetTransmitterBitRate(devices::comm::Bitrate /*bitrate*/) override
+        {
+            return true;
+        }
+
+        virtual bool ResetTransmitter() override
+        {
+            return true;
+        }
+
+        std::atomic<std::uint32_t> Sent{0};
+
+      private:
+        bool Transfer(gsl::span<std::uint8_t> command, std::uint8_t& remainingSlots)
+        {
+            command[0] = 0x10;
+            benchmark::DoNotOptimize(std::accumulate(command.begin(), command.end(), 0u));
+            this->Sent++;
+            remainingSlots = 0xF0;
+            return true;
+        }
+    };
+
+    /**
+     * @brief Downlink queue with running sender task, created once as neither task nor scheduler ever finishes
+     */
+    struct DownlinkFixture
+    {
+        DownlinkFixture() : queue(transmitter, telecommunication::downlink::FramePriority)
+        {
+            queue.Initialize();
+            payload.fill(0x33);
+
+            benchmarks::EnsureSchedulerStarted();
+        }
+
+        TransmitterSimulator transmitter;
+        devices::comm::DownlinkQueue queue;
+        std::array<std::uint8_t, CorrelatedDownlinkFrame::MaxPayloadSize> payload;
+    };
+
+    DownlinkFixture& GetDownlinkFixture()
+    {
+        static auto fixture = new DownlinkFixture();
+        return *fixture;
+    }
+
+    void ReportSent(benchmark::State& state, std::uint32_t sentBefore)
+    {
+        state.SetItemsProcessed(GetDownlinkFixture().transmitter.Sent - sentBefore);
+    }
+}
+
+/** @brief File part built on stack, copied into queued frame and again into transmitter command */
+static void Downlink_QueueCopiedFrame(benchmark::State& state)
+{
+    auto& fixture = GetDownlinkFixture();
+    const std::uint32_t sentBefore = fixture.transmitter.Sent;
+
+    for (auto _ : state)
+    {
+        CorrelatedDownlinkFrame frame(DownlinkAPID::FileSend, 0, 0x11);
+        frame.PayloadWriter().WriteArray(fixture.payload);
+        fixture.queue.SendFrame(frame.Frame());
+    }
+
+    ReportSent(state, sentBefore);
+}
+
+BENCHMARK(Downlink_QueueCopiedFrame)->UseRealTime();
+
+/** @brief File part built directly in pooled buffer that is passed to transmitter */
+static void Downlink_QueueFrameInPlace(benchmark::State& state)
+{
+    auto& fixture = GetDownlinkFixture();
+    const std::uint32_t sentBefore = fixture.transmitter.Sent;
+
+    for (auto _ : state)
+    {
+        TransmitterDownlinkFrame frame(fixture.queue, DownlinkAPID::FileSend, 0, 0x11);
+        frame.PayloadWriter().WriteArray(fixture.payload);
+        frame.Send();
+    }
+
+    ReportSent(state, sentBefore);
+}
+
+BENCHMARK(Downlink_QueueFrameInPlace)->UseRealTime();
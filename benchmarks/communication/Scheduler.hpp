@@ -0,0 +1,23 @@
+#ifndef BENCHMARKS_COMMUNICATION_SCHEDULER_HPP
+#define BENCHMARKS_COMMUNICATION_SCHEDULER_HPP
+
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include "base/os.h"
+
+namespace benchmarks
+{
+    /**
+     * @brief Starts scheduler on detached thread, once per process
+     * @remark Scheduler never returns once started, so tasks and objects they use must live until process exit
+     */
+    inline void EnsureSchedulerStarted()
+    {
+        static std::once_flag started;
+        std::call_once(started, [] { std::thread([] { System::RunScheduler(); }).detach(); });
+    }
+}
+
+#endif /* BENCHMARKS_COMMUNICATION_SCHEDULER_HPP */
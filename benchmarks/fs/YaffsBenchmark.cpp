@@ -0,0 +1,487 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "error_counter/error_counter.hpp"
+#include "fs/yaffs.h"
+#include "n25q/n25q.h"
+#include "n25q/simulated.h"
+#include "n25q/yaffs.h"
+#include "utils.h"
+#include "yaffsfs.h"
+
+using devices::n25q::BlockMapping;
+using devices::n25q::ChunkVerification;
+using devices::n25q::N25QYaffsDevice;
+using devices::n25q::RedundantN25QDriver;
+using devices::n25q::SimulatedClock;
+using devices::n25q::SimulatedN25QDriver;
+using devices::n25q::YaffsDeviceOptions;
+using services::fs::FileAccess;
+using services::fs::FileOpen;
+using services::fs::YaffsFileSystem;
+
+// Defined by yaffsfs, but not exposed in its header
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /**
+     * @brief Error counting that ignores all reports
+     */
+    class NoErrorCounting final : public error_counter::IErrorCounting
+    {
+      public:
+        virtual error_counter::CounterValue Current(error_counter::Device /*device*/) const override
+        {
+            return 0;
+        }
+
+        virtual void Failure(error_counter::Device /*device*/) override
+        {
+        }
+
+        virtual void Success(error_counter::Device /*device*/) override
+        {
+        }
+    };
+
+    /**
+     * @brief Complete OBC storage stack (as in obc::storage::N25QStorage) on top of simulated chips
+     */
+    class SimulatedStorage final
+    {
+      public:
+        SimulatedStorage(const YaffsDeviceOptions& options)
+            : Chips{{{Clock}, {Clock}, {Clock}}},                   //
+              _driver{_errors, {&Chips[0], &Chips[1], &Chips[2]}}, //
+              _device("/", _driver, options)                       //
+        {
+            static bool initialized = false;
+            if (!initialized)
+            {
+                this->FileSystem.Initialize();
+                initialized = true;
+            }
+
+            this->FileSystem.AddDeviceAndMount(this->_device.Device());
+        }
+
+        ~SimulatedStorage()
+        {
+            this->Unmount();
+            yaffs_remove_device(this->_device.Device());
+        }
+
+        void Unmount()
+        {
+            yaffs_unmount2(this->_device.Device()->param.name, 1);
+        }
+
+        void Mount()
+        {
+            yaffs_mount(this->_device.Device()->param.name);
+        }
+
+        /**
+         * @brief Returns number of bytes read from all chips
+         * @return Number of bytes
+         */
+        std::uint64_t BytesRead() const
+        {
+            return this->Chips[0].Counters().BytesRead + this->Chips[1].Counters().BytesRead + this->Chips[2].Counters().BytesRead;
+        }
+
+        /** @brief Simulated time */
+        SimulatedClock Clock;
+        /** @brief Simulated chips */
+        std::array<SimulatedN25QDriver, 3> Chips;
+        /** @brief File system */
+        YaffsFileSystem FileSystem;
+
+      private:
+        NoErrorCounting _errors;
+        RedundantN25QDriver _driver;
+        N25QYaffsDevice<BlockMapping::Sector, 2_KB, 16_MB> _device;
+    };
+
+    /**
+     * @brief Writes file filled with pattern
+     * @param[in] fs File system
+     * @param[in] path File path
+     * @param[in] size File size
+     */
+    void WriteFile(YaffsFileSystem& fs, const char* path, std::size_t size)
+    {
+        std::array<std::uint8_t, 2_KB> buffer;
+        std::fill(buffer.begin(), buffer.end(), 0x5A);
+
+        auto file = fs.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly);
+        for (std::size_t written = 0; written < size; written += buffer.size())
+        {
+            fs.Write(file.Result, buffer);
+        }
+        fs.Close(file.Result);
+    }
+}
+
+/**
+ * Simulated flash time and amount of data read from all chips to mount file system with given number of 64KB files
+ * Arguments: checkpoints enabled, number of files, chunk verification
+ */
+static void Yaffs_Mount(benchmark::State& state)
+{
+    SimulatedStorage storage({0, state.range(0) != 0, static_cast<ChunkVerification>(state.range(2))});
+
+    for (auto i = 0; i < state.range(1); i++)
+    {
+        char path[16];
+        std::snprintf(path, sizeof(path), "/file%d", i);
+        WriteFile(storage.FileSystem, path, 64_KB);
+    }
+
+    storage.FileSystem.Sync();
+
+    std::uint64_t bytesRead = 0;
+    std::chrono::nanoseconds flashTime{0};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        storage.Unmount();
+        auto readBefore = storage.BytesRead();
+        auto start = storage.Clock.Now;
+        state.ResumeTiming();
+
+        storage.Mount();
+
+        bytesRead += storage.BytesRead() - readBefore;
+        flashTime += storage.Clock.Now - start;
+    }
+
+    state.counters["bytesRead"] = benchmark::Counter(bytesRead, benchmark::Counter::kAvgIterations);
+    state.counters["flashMs"] = benchmark::Counter(flashTime.count() / 1e6, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(Yaffs_Mount)->ArgsProduct({{0, 1}, {16, 128}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+/**
+ * Simulated flash time and amount of data read from all chips to read 256KB file
+ * Arguments: chunk verification, corrupt copy in first chip
+ */
+static void Yaffs_Read(benchmark::State& state)
+{
+    SimulatedStorage storage({0, true, static_cast<ChunkVerification>(state.range(0))});
+    WriteFile(storage.FileSystem, "/file", 256_KB);
+
+    if (state.range(1) != 0)
+    {
+        std::array<std::uint8_t, SimulatedN25QDriver::PageSize> zeros;
+        zeros.fill(0);
+
+        for (std::size_t address = 0; address < 16_MB; address += SimulatedN25QDriver::SubSectorSize)
+        {
+            storage.Chips[0].BeginWritePage(address, 0, zeros).Wait();
+        }
+    }
+
+    std::array<std::uint8_t, 2_KB> buffer;
+    std::uint64_t bytesRead = 0;
+    std::chrono::nanoseconds flashTime{0};
+    bool valid = true;
+
+    for (auto _ : state)
+    {
+        auto readBefore = storage.BytesRead();
+        auto start = storage.Clock.Now;
+
+        auto file = storage.FileSystem.Open("/file", FileOpen::Existing, FileAccess::ReadOnly);
+        for (std::size_t offset = 0; offset < 256_KB; offset += buffer.size())
+        {
+            storage.FileSystem.Read(file.Result, buffer);
+            valid = valid && std::all_of(buffer.begin(), buffer.end(), [](std::uint8_t value) { return value == 0x5A; });
+        }
+        storage.FileSystem.Close(file.Result);
+
+        bytesRead += storage.BytesRead() - readBefore;
+        flashTime += storage.Clock.Now - start;
+    }
+
+    if (!valid)
+    {
+        state.SkipWithError("Invalid data read");
+    }
+
+    state.SetBytesProcessed(state.iterations() * 256_KB);
+    state.counters["bytesRead"] = benchmark::Counter(bytesRead, benchmark::Counter::kAvgIterations);
+    state.counters["flashMs"] = benchmark::Counter(flashTime.count() / 1e6, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(Yaffs_Read)->ArgsProduct({{0, 1}, {0, 1}});
+
+/**
+ * Simulated flash time to write 256KB file (including erasing blocks reclaimed by garbage collector)
+ */
+static void Yaffs_SequentialWrite(benchmark::State& state)
+{
+    SimulatedStorage storage({0, true, ChunkVerification::Voting});
+
+    std::chrono::nanoseconds flashTime{0};
+
+    for (auto _ : state)
+    {
+        auto start = storage.Clock.Now;
+        WriteFile(storage.FileSystem, "/file", 256_KB);
+        flashTime += storage.Clock.Now - start;
+    }
+
+    state.SetBytesProcessed(state.iterations() * 256_KB);
+    state.counters["flashMs"] = benchmark::Counter(flashTime.count() / 1e6, benchmark::Counter::kAvgIterations);
+    state.counters["flashKBps"] = benchmark::Counter(state.iterations() * 256 / (flashTime.count() / 1e9));
+}
+
+BENCHMARK(Yaffs_SequentialWrite);
+
+/**
+ * Flash pages programmed on single chip per small (telemetry-sized) write, with files written round-robin
+ * Arguments: number of short-op caches, number of files
+ */
+static void Yaffs_SmallWrites(benchmark::State& state)
+{
+    SimulatedStorage storage({static_cast<std::uint8_t>(state.range(0)), true, ChunkVerification::Voting});
+
+    std::vector<services::fs::FileHandle> files;
+    for (auto i = 0; i < state.range(1); i++)
+    {
+        char path[16];
+        std::snprintf(path, sizeof(path), "/file%d", i);
+        files.push_back(storage.FileSystem.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly).Result);
+    }
+
+    std::array<std::uint8_t, 230> record;
+    std::fill(record.begin(), record.end(), 0x5A);
+
+    storage.Chips[0].ResetCounters();
+    auto start = storage.Clock.Now;
+    std::size_t next = 0;
+
+    for (auto _ : state)
+    {
+        storage.FileSystem.Write(files[next], record);
+        next = (next + 1) % files.size();
+    }
+
+    for (auto file : files)
+    {
+        storage.FileSystem.Close(file);
+    }
+
+    auto& counters = storage.Chips[0].Counters();
+    auto written = state.iterations() * record.size();
+
+    state.SetBytesProcessed(written);
+    state.counters["pagePrograms"] = benchmark::Counter(counters.PagePrograms, benchmark::Counter::kAvgIterations);
+    state.counters["amplification"] = static_cast<double>(counters.BytesProgrammed) / written;
+    state.counters["flashUs"] = benchmark::Counter((storage.Clock.Now - start).count() / 1e3, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(Yaffs_SmallWrites)
+    ->Args({0, 1})
+    ->Args({2, 1})
+    ->Args({4, 1})
+    ->Args({0, 3})
+    ->Args({2, 3})
+    ->Args({4, 3})
+    ->Iterations(4096);
+
+namespace
+{
+    /**
+     * @brief Replays file system usage of OBC mission, one second at a time
+     *
+     * Models:
+     *  - telemetry: 230B entry every 30s, appended in 2KB batches, index entry every 16 entries,
+     *    files archived at 512KB (as configured in main.cpp)
+     *  - experiments: 4 runs a day, each 30min long writing one 230B packet per second to its own file,
+     *    only 8 newest files are kept (older are assumed to be downloaded and removed)
+     *  - photos: 8 photos a day, 64KB each written at once, only 16 newest photos are kept
+     *  - file system sync every 10 minutes
+     */
+    class MissionWorkload final
+    {
+      public:
+        MissionWorkload(SimulatedStorage& storage) : _storage(storage), _fs(storage.FileSystem)
+        {
+            std::fill(this->_data.begin(), this->_data.end(), 0x5A);
+        }
+
+        /**
+         * @brief Replays single second of mission
+         * @param[in] second Mission time in seconds
+         */
+        void Tick(std::uint32_t second)
+        {
+            if (second % 30 == 0)
+            {
+                this->SaveTelemetry();
+            }
+
+            auto secondOfDay = second % Day;
+            if (secondOfDay % (Day / 4) < 30 * 60)
+            {
+                this->SaveExperimentPacket(second / (Day / 4), secondOfDay % (Day / 4) == 0);
+            }
+
+            if (second % (Day / 8) == 0)
+            {
+                this->SavePhoto(second / (Day / 8));
+            }
+
+            if (second % (10 * 60) == 0)
+            {
+                this->_fs.Sync();
+            }
+        }
+
+        /** @brief Number of bytes written by workload */
+        std::uint64_t BytesWritten = 0;
+        /** @brief Longest single file system write (simulated flash time) */
+        std::chrono::nanoseconds LongestWrite{0};
+
+        /** @brief Seconds in day */
+        static constexpr std::uint32_t Day = 24 * 3600;
+
+      private:
+        void SaveTelemetry()
+        {
+            this->_pendingEntries++;
+            this->_entries++;
+
+            if (this->_pendingEntries * 230 >= 2_KB)
+            {
+                this->Append("/telemetry.current", this->_pendingEntries * 230);
+                this->_telemetrySize += this->_pendingEntries * 230;
+                this->_pendingEntries = 0;
+            }
+
+            if (this->_entries % 16 == 0)
+            {
+                this->Append("/telemetry.current.idx", 12);
+            }
+
+            if (this->_telemetrySize >= 512_KB)
+            {
+                this->_fs.Unlink("/telemetry.previous");
+                this->_fs.Unlink("/telemetry.previous.idx");
+                this->_fs.Move("/telemetry.current", "/telemetry.previous");
+                this->_fs.Move("/telemetry.current.idx", "/telemetry.previous.idx");
+                this->_telemetrySize = 0;
+            }
+        }
+
+        void SaveExperimentPacket(std::uint32_t run, bool start)
+        {
+            char path[24];
+
+            if (start)
+            {
+                std::snprintf(path, sizeof(path), "/exp%u", static_cast<unsigned>(run - 8));
+                this->_fs.Unlink(path);
+
+                if (this->_experiment.HasValue)
+                {
+                    this->_fs.Close(this->_experiment.Value);
+                }
+
+                std::snprintf(path, sizeof(path), "/exp%u", static_cast<unsigned>(run));
+                auto file = this->_fs.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly);
+                this->_experiment = Option<services::fs::FileHandle>::Some(file.Result);
+            }
+
+            if (this->_experiment.HasValue)
+            {
+                this->Write(this->_experiment.Value, 230);
+            }
+        }
+
+        void SavePhoto(std::uint32_t photo)
+        {
+            char path[24];
+            std::snprintf(path, sizeof(path), "/photo%u", static_cast<unsigned>(photo - 16));
+            this->_fs.Unlink(path);
+
+            std::snprintf(path, sizeof(path), "/photo%u", static_cast<unsigned>(photo));
+            auto file = this->_fs.Open(path, FileOpen::CreateAlways, FileAccess::WriteOnly);
+            for (auto i = 0; i < 32; i++)
+            {
+                this->Write(file.Result, 2_KB);
+            }
+            this->_fs.Close(file.Result);
+        }
+
+        void Append(const char* path, std::size_t size)
+        {
+            auto file = this->_fs.Open(path, FileOpen::AppendAlways, FileAccess::WriteOnly);
+            this->Write(file.Result, size);
+            this->_fs.Close(file.Result);
+        }
+
+        void Write(services::fs::FileHandle file, std::size_t size)
+        {
+            auto start = this->_storage.Clock.Now;
+            this->_fs.Write(file, gsl::make_span(this->_data.data(), size));
+
+            this->LongestWrite = std::max(this->LongestWrite, this->_storage.Clock.Now - start);
+            this->BytesWritten += size;
+        }
+
+        SimulatedStorage& _storage;
+        YaffsFileSystem& _fs;
+        std::array<std::uint8_t, 2_KB + 230> _data;
+        std::uint32_t _pendingEntries = 0;
+        std::uint32_t _entries = 0;
+        std::size_t _telemetrySize = 0;
+        Option<services::fs::FileHandle> _experiment = None<services::fs::FileHandle>();
+    };
+
+    constexpr std::uint32_t MissionWorkload::Day;
+}
+
+/**
+ * Flash usage while replaying mission file system workload
+ * Arguments: number of short-op caches, number of days
+ */
+static void Yaffs_MissionWorkload(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        SimulatedStorage storage({static_cast<std::uint8_t>(state.range(0)), true, ChunkVerification::Voting});
+        MissionWorkload workload(storage);
+        storage.Chips[0].ResetCounters();
+        auto start = storage.Clock.Now;
+        state.ResumeTiming();
+
+        for (std::uint32_t second = 0; second < state.range(1) * MissionWorkload::Day; second++)
+        {
+            workload.Tick(second);
+        }
+
+        state.PauseTiming();
+        auto& counters = storage.Chips[0].Counters();
+
+        state.counters["writtenKB"] = workload.BytesWritten / 1024.0;
+        state.counters["amplification"] = static_cast<double>(counters.BytesProgrammed) / workload.BytesWritten;
+        state.counters["sectorErases"] = counters.SectorErases;
+        state.counters["maxEraseCount"] = storage.Chips[0].MaxEraseCount();
+        state.counters["flashBusyS"] = counters.BusyTime.count() / 1e9;
+        state.counters["flashTimeS"] = (storage.Clock.Now - start).count() / 1e9;
+        state.counters["longestWriteMs"] = workload.LongestWrite.count() / 1e6;
+        state.counters["programViolations"] = counters.ProgramViolations;
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK(Yaffs_MissionWorkload)->Args({0, 7})->Args({4, 7})->Iterations(1)->Unit(benchmark::kMillisecond);
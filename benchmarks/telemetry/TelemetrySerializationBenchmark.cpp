@@ -0,0 +1,112 @@
+#include <array>
+#include <cstring>
+#include <benchmark/benchmark.h>
+#include "base/BitWriter.hpp"
+#include "telemetry/state.hpp"
+
+using telemetry::ManagedTelemetry;
+
+using Image = std::array<std::uint8_t, ManagedTelemetry::TotalSerializedSize>;
+
+/**
+ * @brief Updates given number of telemetry elements with new values
+ * @param telemetry Telemetry container
+ * @param count Number of elements to update
+ * @param seed Value used to generate new element values
+ */
+static void UpdateElements(ManagedTelemetry& telemetry, int count, std::uint32_t seed)
+{
+    if (count > 0)
+    {
+        telemetry.Set(telemetry::OSState(seed & 0x3FFFFF));
+    }
+
+    if (count > 1)
+    {
+        telemetry.Set(telemetry::McuTemperature(seed & 0xFFF));
+    }
+
+    if (count > 2)
+    {
+        telemetry.Set(telemetry::RAMScrubbing(seed));
+    }
+
+    if (count > 3)
+    {
+        telemetry.Set(telemetry::FileSystemTelemetry(~seed));
+    }
+}
+
+static void Telemetry_FullSerialization(benchmark::State& state)
+{
+    ManagedTelemetry telemetry;
+    Image buffer;
+    Image published;
+    std::uint32_t seed = 0;
+
+    for (auto _ : state)
+    {
+        UpdateElements(telemetry, state.range(0), seed++);
+
+        BitWriter writer(buffer);
+        telemetry.Write(writer);
+        std::memcpy(published.data(), buffer.data(), buffer.size());
+
+        benchmark::DoNotOptimize(published.data());
+    }
+}
+
+BENCHMARK(Telemetry_FullSerialization)->Arg(0)->Arg(1)->Arg(4);
+
+static void Telemetry_IncrementalSerialization(benchmark::State& state)
+{
+    ManagedTelemetry telemetry;
+    Image image;
+    Image published;
+    std::uint32_t seed = 0;
+
+    image.fill(0);
+    telemetry.WriteChanged(image);
+
+    for (auto _ : state)
+    {
+        UpdateElements(telemetry, state.range(0), seed++);
+
+        if (telemetry.IsChanged())
+        {
+            telemetry.WriteChanged(image);
+            std::memcpy(published.data(), image.data(), image.size());
+        }
+
+        benchmark::DoNotOptimize(published.data());
+    }
+}
+
+BENCHMARK(Telemetry_IncrementalSerialization)->Arg(0)->Arg(1)->Arg(4);
+
+static void Telemetry_IncrementalSerializationMatchesFull(benchmark::State& state)
+{
+    ManagedTelemetry telemetry;
+    Image image;
+    Image full;
+
+    image.fill(0);
+    telemetry.WriteChanged(image);
+
+    std::uint32_t seed = 0;
+    for (auto _ : state)
+    {
+        UpdateElements(telemetry, 4, seed++);
+        telemetry.WriteChanged(image);
+    }
+
+    BitWriter writer(full);
+    telemetry.Write(writer);
+
+    if (!writer.Status() || image != full)
+    {
+        state.SkipWithError("Incremental serialization differs from full serialization");
+    }
+}
+
+BENCHMARK(Telemetry_IncrementalSerializationMatchesFull)->Iterations(16);
@@ -0,0 +1,14 @@
+from parser import CategoryParser
+
+
+class DownlinkQueueTelemetryParser(CategoryParser):
+    def __init__(self, reader, store):
+        CategoryParser.__init__(self, '25: Downlink Queue', reader, store)
+
+    def get_bit_count(self):
+        return 2 + 3 + 3
+
+    def parse(self):
+        self.append("Depth", 2)
+        self.append("Dropped control frames (log2)", 3)
+        self.append("Dropped bulk frames (log2)", 3)
@@ -22,6 +22,7 @@ from imtq_self_test_telemetry_parser import ImtqSelfTestTelemetryParser
 from imtq_state_telemetry_parser import ImtqStateTelemetryParser
 from imtq_temperature_telemetry_parser import ImtqTemperatureTelemetryParser
 from system_parser import SystemParser
+from downlink_queue_telemetry_parser import DownlinkQueueTelemetryParser
 
 
 class FullBeaconParser:
@@ -49,4 +50,5 @@ class FullBeaconParser:
                 ImtqCoilsTelemetryParser(reader, store),
                 ImtqTemperatureTelemetryParser(reader, store),
                 ImtqStateTelemetryParser(reader, store),
-                ImtqSelfTestTelemetryParser(reader, store)]
+                ImtqSelfTestTelemetryParser(reader, store),
+                DownlinkQueueTelemetryParser(reader, store)]
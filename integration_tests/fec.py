@@ -0,0 +1,120 @@
+MAX_DATA_COUNT = 32
+MAX_PARITY_COUNT = 4
+POLYNOMIAL = 0x11D
+
+_EXP = [0] * 510
+_LOG = [0] * 256
+
+_x = 1
+for _i in range(0, 255):
+    _EXP[_i] = _x
+    _EXP[_i + 255] = _x
+    _LOG[_x] = _i
+    _x <<= 1
+    if _x & 0x100:
+        _x ^= POLYNOMIAL
+
+
+def multiply(a, b):
+    if a == 0 or b == 0:
+        return 0
+
+    return _EXP[_LOG[a] + _LOG[b]]
+
+
+def inverse(a):
+    if a == 0:
+        return 0
+
+    return _EXP[255 - _LOG[a]]
+
+
+def parity_coefficient(parity_index, data_index):
+    """Coefficient of data chunk in parity chunk, must match telecommunication::fec::ParityCoefficient"""
+    return inverse(parity_index ^ (MAX_PARITY_COUNT + data_index))
+
+
+def _multiply_add(accumulator, chunk, coefficient):
+    for i in range(0, len(chunk)):
+        accumulator[i] ^= multiply(chunk[i], coefficient)
+
+
+def encode(data, parity_count, chunk_size):
+    """Calculates parity chunks of group of data chunks, same as telecommunication::fec::ParityEncoder"""
+    parity = []
+    for j in range(0, parity_count):
+        chunk = bytearray(chunk_size)
+        for i in range(0, len(data)):
+            _multiply_add(chunk, bytearray(data[i]), parity_coefficient(j, i))
+
+        parity.append(chunk)
+
+    return parity
+
+
+def recover(data, parity, chunk_size):
+    """
+    Reconstructs missing data chunks of single group.
+    data - list of data chunks of the group, None for lost ones
+    parity - list of parity chunks indexed by parity index, None for lost ones
+    Returns list of data chunks (reconstructed chunks are padded to chunk_size) or None if too many chunks are lost
+    """
+    data = [bytearray(c) if c is not None else None for c in data]
+    missing = [i for i in range(0, len(data)) if data[i] is None]
+    rows = [j for j in range(0, len(parity)) if parity[j] is not None][:len(missing)]
+
+    if len(rows) < len(missing):
+        return None
+
+    syndromes = []
+    for j in rows:
+        syndrome = bytearray(parity[j])
+        for i in range(0, len(data)):
+            if data[i] is not None:
+                _multiply_add(syndrome, data[i], parity_coefficient(j, i))
+
+        syndromes.append(syndrome)
+
+    n = len(missing)
+    matrix = [[parity_coefficient(j, i) for i in missing] for j in rows]
+
+    for c in range(0, n):
+        pivot = next(r for r in range(c, n) if matrix[r][c] != 0)
+        matrix[c], matrix[pivot] = matrix[pivot], matrix[c]
+        syndromes[c], syndromes[pivot] = syndromes[pivot], syndromes[c]
+
+        scale = inverse(matrix[c][c])
+        matrix[c] = [multiply(v, scale) for v in matrix[c]]
+        syndromes[c] = bytearray(multiply(v, scale) for v in syndromes[c])
+
+        for r in range(0, n):
+            factor = matrix[r][c]
+            if r == c or factor == 0:
+                continue
+
+            _multiply_add(matrix[r], matrix[c], factor)
+            _multiply_add(syndromes[r], syndromes[c], factor)
+
+    for k in range(0, n):
+        data[missing[k]] = syndromes[k][:chunk_size]
+
+    return data
+
+
+if __name__ == '__main__':
+    import itertools
+    import random
+
+    group = [bytearray(random.getrandbits(8) for _ in range(0, 230)) for _ in range(0, 8)]
+    group[-1] = group[-1][:17]
+    parity = encode(group, MAX_PARITY_COUNT, 230)
+
+    for lost in itertools.combinations(range(0, len(group) + len(parity)), MAX_PARITY_COUNT):
+        received = [c if i not in lost else None for i, c in enumerate(group)]
+        received_parity = [c if len(group) + j not in lost else None for j, c in enumerate(parity)]
+
+        recovered = recover(received, received_parity, 230)
+        assert recovered[:-1] == group[:-1], lost
+        assert recovered[-1][:17] == group[-1] and not any(recovered[-1][17:]), lost
+
+    print 'OK'
@@ -0,0 +1,58 @@
+WINDOW_BITS = 8
+LENGTH_BITS = 4
+MIN_MATCH_LENGTH = 2
+LITERAL_BITS = 1 + 8
+BACK_REFERENCE_BITS = 1 + WINDOW_BITS + LENGTH_BITS
+
+
+class _BitReader(object):
+    def __init__(self, data):
+        self._data = bytearray(data)
+        self._bit = 0
+
+    def remaining(self):
+        return len(self._data) * 8 - self._bit
+
+    def read(self, length):
+        value = 0
+        for i in range(0, length):
+            byte = self._data[self._bit // 8]
+            value |= ((byte >> (self._bit % 8)) & 1) << i
+            self._bit += 1
+
+        return value
+
+
+def decompress(data):
+    """Decompresses single block produced by lzss::Compress"""
+    reader = _BitReader(data)
+    output = bytearray()
+
+    while reader.remaining() >= LITERAL_BITS:
+        if reader.read(1) == 1:
+            output.append(reader.read(8))
+            continue
+
+        if reader.remaining() < BACK_REFERENCE_BITS - 1:
+            break
+
+        distance = reader.read(WINDOW_BITS) + 1
+        length = reader.read(LENGTH_BITS) + MIN_MATCH_LENGTH
+
+        if distance > len(output):
+            raise ValueError('Back reference before beginning of data')
+
+        for _ in range(0, length):
+            output.append(output[-distance])
+
+    return output
+
+
+if __name__ == '__main__':
+    import sys
+
+    with open(sys.argv[1], 'rb') as f:
+        compressed = f.read()
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(decompress(compressed))
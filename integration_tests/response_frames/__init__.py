@@ -24,6 +24,8 @@ from memory import *
 from file_system import *
 from comm import *
 from time import *
+from mission_profile import *
+from telemetry_archive import *
 
 frame_types = []
 frame_types += map(lambda t: t[1], inspect.getmembers(pong, predicate=inspect.isclass))
@@ -45,6 +47,8 @@ frame_types += map(lambda t: t[1], inspect.getmembers(file_system, predicate=ins
 frame_types += map(lambda t: t[1], inspect.getmembers(comm, predicate=inspect.isclass))
 frame_types += map(lambda t: t[1], inspect.getmembers(time, predicate=inspect.isclass))
 frame_types += map(lambda t: t[1], inspect.getmembers(stop_antenna_deployment, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(mission_profile, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(telemetry_archive, predicate=inspect.isclass))
 frame_types = filter(lambda t: issubclass(t, ResponseFrame) and t != ResponseFrame, frame_types)
 frame_types = reduce(lambda t, x: t + [x] if x not in t else t, frame_types, [])
 
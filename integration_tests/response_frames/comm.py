@@ -1,3 +1,5 @@
+import struct
+
 from response_frames import response_frame, ResponseFrame
 
 
@@ -7,3 +9,27 @@ class BeaconErrorFrame(ResponseFrame):
     def matches(cls, payload):
         return True
 
+
+@response_frame(0x26)
+class ReceivePollingStatisticsFrame(ResponseFrame):
+    LATENCY_BUCKETS = ['<=50ms', '<=100ms', '<=250ms', '<=500ms', '<=1s', '<=2s', '>2s']
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.status = payload[1]
+
+        if self.status != 0:
+            return
+
+        values = struct.unpack('<' + 'H' * (1 + len(self.LATENCY_BUCKETS)), bytearray(payload[2:]))
+        self.interval = values[0]
+        self.latency = dict(zip(self.LATENCY_BUCKETS, values[1:]))
+
+    def __str__(self):
+        return 'Receive polling statistics (Correlation {}, Status: {})'.format(self.correlation_id, self.status)
+
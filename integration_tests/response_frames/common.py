@@ -1,3 +1,6 @@
+import struct
+
+import lzss
 from response_frames import ResponseFrame, response_frame
 from enum import unique, IntEnum
 
@@ -31,6 +34,11 @@ class DownlinkApid(IntEnum):
     I2C = 0x1A,
     PeriodicSet = 0x1B,
     SailExperiment = 0x1C,
+    FileSendSummary = 0x27,
+    FileSendCompressed = 0x28,
+    FileSendParity = 0x29,
+    UplinkSegments = 0x2A,
+    TelecommandRejected = 0x2B,
 
 @response_frame(0)
 class GenericSuccessResponseFrame(ResponseFrame):
@@ -108,6 +116,97 @@ class FileSendErrorFrame(GenericErrorResponseFrame):
     pass
 
 
+@response_frame(DownlinkApid.FileSendSummary)
+class FileSendSummaryFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.status = payload[1]
+        (self.sent, self.parts_count) = struct.unpack('<LL', bytearray(payload[2:10]))
+
+    def __repr__(self):
+        return '{}: CID={:03d} Status={} Sent={}/{}'.format(
+            self.__class__.__name__, self.correlation_id, self.status, self.sent, self.parts_count)
+
+
+@response_frame(DownlinkApid.FileSendCompressed)
+class FileSendCompressedSuccessFrame(GenericSuccessResponseFrame):
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        (self.offset, self.length, self.file_size) = struct.unpack('<LHL', bytearray(payload[2:12]))
+        self.response = lzss.decompress(payload[12:])
+
+    def __repr__(self):
+        return '{}: CID={:03d} Offset={} Length={}/{}'.format(
+            self.__class__.__name__, self.correlation_id, self.offset, self.length, self.file_size)
+
+
+@response_frame(DownlinkApid.FileSendCompressed)
+class FileSendCompressedErrorFrame(GenericErrorResponseFrame):
+    pass
+
+
+@response_frame(DownlinkApid.FileSendParity)
+class FileSendParityFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.parity_index = payload[1]
+        self.parity = bytearray(payload[2:])
+
+    def __repr__(self):
+        return '{}: CID={:03d} Group={} Parity={}'.format(
+            self.__class__.__name__, self.correlation_id, self._seq, self.parity_index)
+
+
+@response_frame(DownlinkApid.UplinkSegments)
+class UplinkSegmentsFrame(ResponseFrame):
+    COMPLETE = 0
+    INCOMPLETE = 1
+    MALFORMED = 2
+    UNKNOWN = 3
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.status = payload[1]
+        self.count = payload[2]
+        self.missing = [i for i in range(0, self.count) if not payload[3] & (1 << i)]
+
+    def __repr__(self):
+        return '{}: Stream={:03d} Status={} Missing={}'.format(
+            self.__class__.__name__, self.correlation_id, self.status, self.missing)
+
+
+@response_frame(DownlinkApid.TelecommandRejected)
+class TelecommandRejectedFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.command_code = payload[1]
+
+    def __repr__(self):
+        return '{}: CID={:03d} Command=0x{:02X}'.format(
+            self.__class__.__name__, self.correlation_id, self.command_code)
+
+
 @response_frame(DownlinkApid.FileList)
 class FileListErrorFrame(GenericErrorResponseFrame):
     pass
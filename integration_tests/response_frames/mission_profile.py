@@ -0,0 +1,50 @@
+import struct
+
+from response_frames import response_frame, ResponseFrame
+
+
+@response_frame(0x24)
+class MissionLoopProfileFrame(ResponseFrame):
+    ENTRY_HEADER = '<IIIIIH'
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.status = payload[1]
+        self.entries = []
+
+        if self.status != 0:
+            return
+
+        self.total_count = payload[2]
+        self.first_entry = payload[3]
+
+        data = bytearray(payload[4:])
+        entry_size = struct.calcsize(self.ENTRY_HEADER)
+
+        while len(data) >= 2:
+            kind = data[0]
+            name_length = data[1]
+            name = str(data[2:2 + name_length])
+            offset = 2 + name_length
+            (runs, min_time, avg_time, max_time, last_time, overruns) = \
+                struct.unpack(self.ENTRY_HEADER, data[offset:offset + entry_size])
+            self.entries.append({
+                'kind': kind,
+                'name': name,
+                'runs': runs,
+                'min': min_time,
+                'avg': avg_time,
+                'max': max_time,
+                'last': last_time,
+                'overruns': overruns
+            })
+            data = data[offset + entry_size:]
+
+    def __str__(self):
+        return 'Mission loop profile (Correlation {}, Status: {}, Entries: {})'.format(
+            self.correlation_id, self.status, len(self.entries))
@@ -0,0 +1,30 @@
+import struct
+
+from response_frames import response_frame, ResponseFrame
+
+
+@response_frame(0x25)
+class TelemetryArchiveFrame(ResponseFrame):
+    SUCCESS = 0
+    MALFORMED_REQUEST = 1
+    NOT_FOUND = 2
+    COMPLETED = 3
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        payload = self.payload()
+        self.correlation_id = payload[0]
+        self.status = payload[1]
+        self.entry = None
+        self.count = None
+
+        if self.status == self.SUCCESS:
+            self.entry = bytearray(payload[2:])
+        elif self.status == self.COMPLETED:
+            (self.count,) = struct.unpack('<I', bytearray(payload[2:6]))
+
+    def __str__(self):
+        return 'Telemetry archive (Correlation {}, Status: {})'.format(self.correlation_id, self.status)
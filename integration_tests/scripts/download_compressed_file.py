@@ -0,0 +1,44 @@
+import sys
+from Queue import Empty
+
+from response_frames.common import FileSendCompressedSuccessFrame, FileSendCompressedErrorFrame
+from telecommand import DownloadCompressedFile
+
+obc_path = sys.argv[1]
+local_file = sys.argv[2]
+
+print 'Downloading compressed file from {}'.format(obc_path)
+
+offset = 0
+file_size = None
+
+with open(local_file, 'wb') as local:
+    while file_size is None or offset < file_size:
+        print 'Requesting from offset {}...'.format(offset)
+        system.comm.put_frame(DownloadCompressedFile(0x46, obc_path, offset))
+
+        while file_size is None or offset < file_size:
+            try:
+                part = system.comm.get_frame(5)
+            except Empty:
+                print '\t\tTimeout waiting for frame'
+                break
+
+            if type(part) is FileSendCompressedErrorFrame and part.correlation_id == 0x46:
+                print '\t\tDownload failed: {}'.format(part)
+                sys.exit(1)
+
+            if type(part) is not FileSendCompressedSuccessFrame or part.correlation_id != 0x46:
+                print '\t\tIgnoring {}'.format(part)
+                continue
+
+            if part.offset != offset:
+                print '\t\tIgnoring {} (expected offset {})'.format(part, offset)
+                continue
+
+            print '\t\tReceived {} bytes at {} ({} byte frame)'.format(part.length, part.offset, len(part.payload()))
+            file_size = part.file_size
+
+            local.seek(part.offset, 0)
+            local.write(part.response)
+            offset += part.length
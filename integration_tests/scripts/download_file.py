@@ -3,8 +3,8 @@ from Queue import Empty
 
 from math import ceil
 
-from response_frames.common import FileSendSuccessFrame
-from telecommand import DownloadFile
+from response_frames.common import FileSendSuccessFrame, FileSendSummaryFrame
+from telecommand import SelectiveDownloadFile
 from utils import ensure_string
 
 obc_path = sys.argv[1]
@@ -15,30 +15,23 @@ chunks_count = int(ceil(length / 230.0))
 
 print 'Downloading file from {} ({} bytes, {} chunks)'.format(obc_path, length, chunks_count)
 
-chunks = range(0, chunks_count)
+missing = set(range(0, chunks_count))
 
-i = 0
-
-CHUNKS_PER_ITERATION = 10
+request = SelectiveDownloadFile.for_all(0x45, obc_path)
 
 with open(local_file, 'wb') as local:
-    while i < chunks_count:
-        r = (i, min(i + CHUNKS_PER_ITERATION, chunks_count))
-        i += CHUNKS_PER_ITERATION
-
-        chunks = range(*r)
+    while len(missing) > 0:
+        print 'Requesting {} missing chunks...'.format(len(missing))
+        system.comm.put_frame(request)
 
-        print 'Requesting...'
-        system.comm.put_frame(DownloadFile(0x45, obc_path, chunks))
-
-        while len(chunks) > 0:
-            print '\tWaiting for chunks {}:'.format(chunks)
+        while True:
             try:
-                part = system.comm.get_frame(1) # type: OperationSuccessFrame
+                part = system.comm.get_frame(5)
             except Empty:
                 print '\t\tTimeout waiting for frame'
+                break
 
-            if type(part) is not FileSendSuccessFrame:
+            if type(part) not in [FileSendSuccessFrame, FileSendSummaryFrame]:
                 print '\t\tIgnoring {} (not success)'.format(part)
                 continue
 
@@ -46,16 +39,18 @@ with open(local_file, 'wb') as local:
                 print '\t\tIgnoring {} (not matching correlation id)'.format(part)
                 continue
 
-            if part.seq() not in chunks:
-                print '\t\tIgnoring {} (not matching SEQ)'.format(part)
+            if type(part) is FileSendSummaryFrame:
+                print '\tTransfer finished: {}'.format(part)
+                break
+
+            if part.seq() not in missing:
                 continue
 
             print '\t\tReceived chunk {}'.format(part.seq())
-            chunks.remove(part.seq())
+            missing.remove(part.seq())
 
             local.seek(part.seq() * 230, 0)
             local.write(ensure_string(part.response))
 
-
-
-
+        if len(missing) > 0:
+            request = SelectiveDownloadFile.for_missing(0x45, obc_path, missing)
@@ -0,0 +1,66 @@
+import sys
+from Queue import Empty
+
+import fec
+from response_frames.common import FileSendSuccessFrame, FileSendParityFrame, FileSendSummaryFrame
+from telecommand import DownloadFileWithParity
+
+obc_path = sys.argv[1]
+local_file = sys.argv[2]
+group_size = int(sys.argv[3]) if len(sys.argv) > 3 else 16
+parity_count = int(sys.argv[4]) if len(sys.argv) > 4 else 2
+
+CHUNK_SIZE = 230
+
+print 'Downloading file {} with {} parity frames per {} parts'.format(obc_path, parity_count, group_size)
+
+system.comm.put_frame(DownloadFileWithParity(0x47, obc_path, 0, 0, group_size, parity_count))
+
+parts = {}
+parity = {}
+summary = None
+
+while summary is None:
+    try:
+        frame = system.comm.get_frame(5)
+    except Empty:
+        print '\t\tTimeout waiting for frame'
+        sys.exit(1)
+
+    if getattr(frame, 'correlation_id', None) != 0x47:
+        print '\t\tIgnoring {}'.format(frame)
+        continue
+
+    if type(frame) is FileSendSuccessFrame:
+        parts[frame.seq()] = bytearray(frame.response)
+    elif type(frame) is FileSendParityFrame:
+        parity[(frame.seq(), frame.parity_index)] = frame.parity
+    elif type(frame) is FileSendSummaryFrame:
+        summary = frame
+    else:
+        print '\t\tIgnoring {}'.format(frame)
+
+print 'Download finished: {}'.format(summary)
+
+for first in range(0, summary.parts_count, group_size):
+    seqs = range(first, min(first + group_size, summary.parts_count))
+    lost = [seq for seq in seqs if seq not in parts]
+
+    if not lost:
+        continue
+
+    recovered = fec.recover([parts.get(seq) for seq in seqs],
+                            [parity.get((first, j)) for j in range(0, parity_count)],
+                            CHUNK_SIZE)
+
+    if recovered is None:
+        print '\t\tUnable to recover parts {}, request them with SelectiveDownloadFile'.format(lost)
+        continue
+
+    print '\t\tRecovered parts {}'.format(lost)
+    for seq in lost:
+        parts[seq] = recovered[seq - first]
+
+with open(local_file, 'wb') as local:
+    for seq in range(0, summary.parts_count):
+        local.write(parts.get(seq, bytearray(CHUNK_SIZE)))
@@ -19,9 +19,16 @@ from eps import *
 from adcs import *
 from memory import *
 from ping import *
+from mission_profile import *
+from telemetry_archive import *
+from cancel import *
+from segmentation import *
 
 __all__ = [
     'DownloadFile',
+    'SelectiveDownloadFile',
+    'DownloadCompressedFile',
+    'DownloadFileWithParity',
     'EnterIdleState',
     'RemoveFile',
     'PerformDetumblingExperiment',
@@ -63,6 +70,13 @@ __all__ = [
     'StopSailDeployment',
     'ReadMemory',
     'PingTelecommand',
+    'GetMissionLoopProfile',
+    'DownloadTelemetry',
+    'CancelOperation',
+    'GetReceivePollingStatistics',
+    'UplinkSegment',
+    'UplinkSegmentsStatus',
+    'segment_telecommand',
     'CorrelatedTelecommand'
 ]
 
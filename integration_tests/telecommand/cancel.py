@@ -0,0 +1,14 @@
+import struct
+
+from telecommand.base import CorrelatedTelecommand
+
+
+class CancelOperation(CorrelatedTelecommand):
+    def __init__(self, correlation_id):
+        super(CancelOperation, self).__init__(correlation_id)
+
+    def apid(self):
+        return 0xB4
+
+    def payload(self):
+        return struct.pack('<B', self._correlation_id)
@@ -50,3 +50,14 @@ class SetBitrate(CorrelatedTelecommand):
         return "{}, bitrate={}".format(
             super(SetBitrate, self).__repr__(),
             self._bitrate)
+
+
+class GetReceivePollingStatistics(CorrelatedTelecommand):
+    def __init__(self, correlation_id):
+        super(GetReceivePollingStatistics, self).__init__(correlation_id)
+
+    def apid(self):
+        return 0x2B
+
+    def payload(self):
+        return struct.pack('<B', self._correlation_id)
@@ -25,6 +25,134 @@ class DownloadFile(CorrelatedTelecommand):
             len(self._seqs), self._path)
 
 
+class SelectiveDownloadFile(CorrelatedTelecommand):
+    RANGE_TAG = 0x00
+    BITMAP_TAG = 0x01
+    MAX_SELECTION_SIZE = 180
+
+    def __init__(self, correlation_id, path, first, selection):
+        super(SelectiveDownloadFile, self).__init__(correlation_id)
+        self._path = path
+        self._first = first
+        self._selection = selection
+
+    @classmethod
+    def encode_range(cls, skip, count):
+        return [cls.RANGE_TAG] + ensure_byte_list(struct.pack('<HH', skip, count))
+
+    @classmethod
+    def encode_bitmap(cls, seqs, first, length):
+        bitmap = [0] * length
+        for seq in seqs:
+            bitmap[(seq - first) / 8] |= 1 << ((seq - first) % 8)
+
+        return [cls.BITMAP_TAG, length] + bitmap
+
+    @classmethod
+    def for_all(cls, correlation_id, path):
+        return cls(correlation_id, path, 0, cls.encode_range(0, 0xFFFF))
+
+    @classmethod
+    def for_missing(cls, correlation_id, path, seqs):
+        seqs = sorted(set(seqs))
+        first = seqs[0]
+        selection = []
+        cursor = first
+        i = 0
+
+        while i < len(seqs):
+            run_end = i
+            while run_end + 1 < len(seqs) and seqs[run_end + 1] == seqs[run_end] + 1:
+                run_end += 1
+
+            run_length = min(run_end - i + 1, 0xFFFF)
+            skip = seqs[i] - cursor
+            window = [s for s in seqs[i:] if s < cursor + 8 * 32]
+
+            if skip > 0xFFFF:
+                entry = cls.encode_range(0xFFFF, 0)
+                consumed = 0
+                next_cursor = cursor + 0xFFFF
+            elif run_length >= 4 or skip >= 40 or len(window) == 1:
+                entry = cls.encode_range(skip, run_length)
+                consumed = run_length
+                next_cursor = seqs[i] + run_length
+            else:
+                length = (window[-1] - cursor) / 8 + 1
+                entry = cls.encode_bitmap(window, cursor, length)
+                consumed = len(window)
+                next_cursor = cursor + 8 * length
+
+            if len(selection) + len(entry) > cls.MAX_SELECTION_SIZE:
+                break
+
+            selection += entry
+            cursor = next_cursor
+            i += consumed
+
+        return cls(correlation_id, path, first, selection)
+
+    def apid(self):
+        return 0xB5
+
+    def payload(self):
+        first_bytes = ensure_byte_list(struct.pack('<L', self._first))
+
+        return [self._correlation_id, len(self._path)] + list(self._path) + [0x0] + first_bytes + self._selection
+
+    def __repr__(self):
+        return "{}, cid={:02d}, '{}' from {}".format(
+            super(SelectiveDownloadFile, self).__repr__(),
+            self._correlation_id,
+            self._path, self._first)
+
+
+class DownloadCompressedFile(CorrelatedTelecommand):
+    def __init__(self, correlation_id, path, offset=0, max_parts=0):
+        super(DownloadCompressedFile, self).__init__(correlation_id)
+        self._path = path
+        self._offset = offset
+        self._max_parts = max_parts
+
+    def apid(self):
+        return 0xB6
+
+    def payload(self):
+        offset_bytes = ensure_byte_list(struct.pack('<LB', self._offset, self._max_parts))
+
+        return [self._correlation_id, len(self._path)] + list(self._path) + [0x0] + offset_bytes
+
+    def __repr__(self):
+        return "{}, cid={:02d}, '{}' from {} ({} parts)".format(
+            super(DownloadCompressedFile, self).__repr__(),
+            self._correlation_id,
+            self._path, self._offset, self._max_parts)
+
+
+class DownloadFileWithParity(CorrelatedTelecommand):
+    def __init__(self, correlation_id, path, first=0, count=0, group_size=16, parity_count=2):
+        super(DownloadFileWithParity, self).__init__(correlation_id)
+        self._path = path
+        self._first = first
+        self._count = count
+        self._group_size = group_size
+        self._parity_count = parity_count
+
+    def apid(self):
+        return 0xB7
+
+    def payload(self):
+        parameters = ensure_byte_list(struct.pack('<LHBB', self._first, self._count, self._group_size, self._parity_count))
+
+        return [self._correlation_id, len(self._path)] + list(self._path) + [0x0] + parameters
+
+    def __repr__(self):
+        return "{}, cid={:02d}, '{}' from {} ({} parts, {} parity per {})".format(
+            super(DownloadFileWithParity, self).__repr__(),
+            self._correlation_id,
+            self._path, self._first, self._count, self._parity_count, self._group_size)
+
+
 class RemoveFile(CorrelatedTelecommand):
     def __init__(self, correlation_id, path):
         super(RemoveFile, self).__init__(correlation_id)
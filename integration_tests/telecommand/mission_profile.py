@@ -0,0 +1,19 @@
+import struct
+
+from telecommand.base import CorrelatedTelecommand
+
+
+class GetMissionLoopProfile(CorrelatedTelecommand):
+    MISSION = 0
+    TELEMETRY = 1
+
+    def __init__(self, correlation_id, loop=MISSION, first_entry=0):
+        super(GetMissionLoopProfile, self).__init__(correlation_id)
+        self.loop = loop
+        self.first_entry = first_entry
+
+    def apid(self):
+        return 0x2A
+
+    def payload(self):
+        return struct.pack('<BBB', self._correlation_id, self.loop, self.first_entry)
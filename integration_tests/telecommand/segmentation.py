@@ -0,0 +1,42 @@
+import struct
+
+from telecommand.base import Telecommand, CorrelatedTelecommand
+from utils import ensure_byte_list
+
+
+class UplinkSegment(CorrelatedTelecommand):
+    HEADER_SIZE = 3
+    MAX_SEGMENT_SIZE = Telecommand.MAX_PAYLOAD_SIZE - HEADER_SIZE
+    MAX_SEGMENTS = 8
+
+    def __init__(self, stream_id, index, count, data):
+        super(UplinkSegment, self).__init__(stream_id)
+        self._index = index
+        self._count = count
+        self._data = list(data)
+
+    def apid(self):
+        return 0xB8
+
+    def payload(self):
+        return ensure_byte_list(struct.pack('<BBB', self._correlation_id, self._index, self._count)) + self._data
+
+    def __repr__(self):
+        return "{}, segment {}/{} ({} bytes)".format(
+            super(UplinkSegment, self).__repr__(), self._index, self._count, len(self._data))
+
+
+class UplinkSegmentsStatus(UplinkSegment):
+    def __init__(self, stream_id):
+        super(UplinkSegmentsStatus, self).__init__(stream_id, 0, 0, [])
+
+
+def segment_telecommand(stream_id, telecommand):
+    """Splits telecommand (possibly exceeding single frame) into segments reassembled by OBC"""
+    content = [telecommand.apid()] + ensure_byte_list(telecommand.payload())
+    chunks = [content[i:i + UplinkSegment.MAX_SEGMENT_SIZE] for i in range(0, len(content), UplinkSegment.MAX_SEGMENT_SIZE)]
+
+    if len(chunks) > UplinkSegment.MAX_SEGMENTS:
+        raise ValueError('Telecommand too long: {} segments'.format(len(chunks)))
+
+    return [UplinkSegment(stream_id, i, len(chunks), chunk) for i, chunk in enumerate(chunks)]
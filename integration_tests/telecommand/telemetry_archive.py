@@ -0,0 +1,16 @@
+import struct
+
+from telecommand.base import CorrelatedTelecommand
+
+
+class DownloadTelemetry(CorrelatedTelecommand):
+    def __init__(self, correlation_id, time_from, time_to):
+        super(DownloadTelemetry, self).__init__(correlation_id)
+        self.time_from = time_from
+        self.time_to = time_to
+
+    def apid(self):
+        return 0xB3
+
+    def payload(self):
+        return struct.pack('<BQQ', self._correlation_id, self.time_from, self.time_to)
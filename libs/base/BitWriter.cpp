@@ -188,13 +188,3 @@ bool BitWriter::WriteQuadWord(std::uint64_t value, std::uint8_t length)
 
     return true;
 }
-
-std::enable_if<!std::is_same<unsigned int, std::uint8_t>::value && //
-        !std::is_same<unsigned int, std::uint16_t>::value &&       //
-        !std::is_same<unsigned int, std::uint32_t>::value &&       //
-        !std::is_same<unsigned int, std::uint64_t>::value,         //
-    bool>::type
-    BitWriter::Write(unsigned int value)
-{
-    return WriteQuadWord(value, BitLength<unsigned int>);
-}
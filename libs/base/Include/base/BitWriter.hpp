@@ -9,6 +9,21 @@
 #include "fwd.hpp"
 #include "gsl/span"
 #include "system.h"
+#include "utils.h"
+
+namespace details
+{
+    /**
+     * @brief Checks whether type is unsigned int that is distinct from all fixed width integer types
+     * @tparam T Queried type
+     */
+    template <typename T>
+    constexpr bool IsDistinctUnsignedInt = std::is_same<T, unsigned int>::value && //
+        !std::is_same<unsigned int, std::uint8_t>::value &&                         //
+        !std::is_same<unsigned int, std::uint16_t>::value &&                        //
+        !std::is_same<unsigned int, std::uint32_t>::value &&                        //
+        !std::is_same<unsigned int, std::uint64_t>::value;
+}
 
 /**
  * @brief Buffer bit writer
@@ -137,13 +152,10 @@ class BitWriter
      * @brief Appends integer value to the buffer and moves the current position to the next free bit.
      * @param[in] value Value that should be added to writer output.
      * @return Operation status.
+     * @remark This overload is only available on platforms where unsigned int is not one of the fixed width types
+     * (e.g. arm-none-eabi where std::uint32_t is unsigned long).
      */
-    std::enable_if<!std::is_same<unsigned int, std::uint8_t>::value && //
-            !std::is_same<unsigned int, std::uint16_t>::value &&       //
-            !std::is_same<unsigned int, std::uint32_t>::value &&       //
-            !std::is_same<unsigned int, std::uint64_t>::value,         //
-        bool>::type
-        Write(unsigned int value);
+    template <typename T, typename std::enable_if<details::IsDistinctUnsignedInt<T>, int>::type = 0> bool Write(T value);
 
     /**
      * @brief Appends boolean to the buffer and moves the current position to the next free bit.
@@ -187,7 +199,8 @@ class BitWriter
      * @return Operation status.
      * @remark Overload for fundamental types
      */
-    template <typename T, typename std::enable_if<std::is_fundamental<T>::value, int>::type = 0> bool Write(T value);
+    template <typename T, typename std::enable_if<std::is_fundamental<T>::value && !details::IsDistinctUnsignedInt<T>, int>::type = 0>
+    bool Write(T value);
 
     /**
      * @brief Appends all bits from bitset to buffer
@@ -325,11 +338,17 @@ template <typename T, typename std::enable_if<std::is_enum<T>::value, int>::type
     return Write(num(value));
 }
 
-template <typename T, typename std::enable_if<std::is_fundamental<T>::value, int>::type> inline bool BitWriter::Write(T value)
+template <typename T, typename std::enable_if<std::is_fundamental<T>::value && !details::IsDistinctUnsignedInt<T>, int>::type>
+inline bool BitWriter::Write(T value)
 {
     return Write(static_cast<std::make_unsigned_t<T>>(value));
 }
 
+template <typename T, typename std::enable_if<details::IsDistinctUnsignedInt<T>, int>::type> inline bool BitWriter::Write(T value)
+{
+    return WriteQuadWord(value, BitLength<unsigned int>);
+}
+
 template <std::size_t Size> bool BitWriter::Write(const std::bitset<Size>& value)
 {
     for (auto i = 0U; i < Size; i++)
@@ -0,0 +1,76 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_LZSS_HPP_
+#define LIBS_BASE_INCLUDE_BASE_LZSS_HPP_
+
+#pragma once
+
+#include <cstdint>
+#include <gsl/span>
+
+namespace lzss
+{
+    /**
+     * @defgroup lzss LZSS compression
+     * @ingroup utilities
+     *
+     * @brief Heatshrink-style LZSS compression with fixed memory footprint.
+     *
+     * Compressed data is a stream of tokens packed using @ref BitWriter (least significant bit first):
+     *  - literal: bit '1' followed by 8-bit byte value,
+     *  - back reference: bit '0' followed by @ref WindowBits bit (distance - 1) and @ref LengthBits bit
+     *    (length - @ref MinMatchLength). Referenced bytes may overlap bytes produced by the reference itself,
+     *    therefore runs of repeated bytes are encoded with distance equal to 1.
+     *
+     * Encoder does not allocate any memory, back references are searched directly in the input buffer.
+     * Decoder stops when fewer bits than required for the shortest token remain.
+     * @{
+     */
+
+    /** @brief Number of bits used to encode back reference distance */
+    static constexpr std::uint8_t WindowBits = 8;
+
+    /** @brief Number of bits used to encode back reference length */
+    static constexpr std::uint8_t LengthBits = 4;
+
+    /** @brief Maximal back reference distance */
+    static constexpr std::uint16_t WindowSize = 1 << WindowBits;
+
+    /** @brief Shortest sequence encoded as back reference */
+    static constexpr std::uint8_t MinMatchLength = 2;
+
+    /** @brief Longest sequence encoded as single back reference */
+    static constexpr std::uint8_t MaxMatchLength = MinMatchLength + (1 << LengthBits) - 1;
+
+    /**
+     * @brief Result of compression
+     */
+    struct CompressionResult
+    {
+        /** @brief Number of input bytes encoded in output */
+        std::size_t Consumed;
+        /** @brief Number of output bytes used */
+        std::size_t Produced;
+    };
+
+    /**
+     * @brief Compresses as much input as fits into output buffer
+     * @param[in] input Data to compress
+     * @param[out] output Buffer for compressed data
+     * @return Number of consumed input bytes and produced output bytes
+     *
+     * @remark Each call produces independent compressed block - back references never point before the beginning of
+     * the input.
+     */
+    CompressionResult Compress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output);
+
+    /**
+     * @brief Decompresses single compressed block
+     * @param[in] input Compressed data
+     * @param[out] output Buffer for decompressed data
+     * @return Decompressed data or empty span if input is invalid or does not fit into output buffer
+     */
+    gsl::span<std::uint8_t> Decompress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output);
+
+    /** @} */
+}
+
+#endif /* LIBS_BASE_INCLUDE_BASE_LZSS_HPP_ */
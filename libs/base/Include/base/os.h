@@ -27,11 +27,19 @@ static constexpr std::chrono::milliseconds InfiniteTimeout = std::chrono::millis
 // newlib workaround
 #if defined _NEWLIB_VERSION && defined __ELASTERROR
 #define ELAST __ELASTERROR
+#elif defined __GLIBC__
+// glibc workaround (host build), errno values are well below 256
+#define ELAST 256
 #else
 #error "stdlib does not define ELAST errno value."
 #endif
 #endif
 
+#ifndef EFTYPE
+// EFTYPE is newlib specific
+#define EFTYPE (ELAST + 2)
+#endif
+
 /**
  * @brief Enumerator for all possible operating system error codes.
  */
@@ -0,0 +1,139 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_SNAPSHOT_HPP_
+#define LIBS_BASE_INCLUDE_BASE_SNAPSHOT_HPP_
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @defgroup snapshot Lock-free value snapshot
+ * @ingroup utilities
+ *
+ * @brief Exchange of value between single writer and multiple readers that never blocks any of them.
+ *
+ * Writer publishes new value into the buffer that is not currently visible to readers and then switches readers to it.
+ * Readers use sequence counter (seqlock) to verify that writer did not start overwriting buffer they have just read.
+ * Thanks to double buffering readers have entire period between two subsequent publications to finish reading.
+ *
+ * @{
+ */
+
+/**
+ * @brief Double buffered value snapshot protected by sequence counter
+ * @tparam T Type of stored value. As readers may observe partially overwritten value it should be plain data.
+ * @tparam MaxAttempts Number of attempts reader makes before giving up
+ */
+template <typename T, std::uint8_t MaxAttempts = 3> class Snapshot final
+{
+  public:
+    /**
+     * @brief Ctor
+     */
+    Snapshot();
+
+    /**
+     * @brief Publishes new value
+     * @param[in] value New value
+     *
+     * @remark Only one task is allowed to publish values.
+     */
+    void Publish(const T& value);
+
+    /**
+     * @brief Passes current value to reader
+     * @param[in] reader Callable invoked with const reference to current value
+     * @return True if reader has been invoked with consistent value, false if nothing has been published yet or writer
+     * kept overwriting the value during all attempts.
+     *
+     * @remark Reader can be invoked multiple times and only the result of last invocation is valid when this method
+     * returns true. Reader should not rely on invariants of the value (e.g. pointers stored in it).
+     */
+    template <typename Reader> bool Read(Reader&& reader) const;
+
+    /**
+     * @brief Copies current value
+     * @param[out] value Copy of current value
+     * @return Operation status. See @ref Read.
+     */
+    bool Get(T& value) const;
+
+    /**
+     * @brief Checks whether at least one value has been published
+     * @return True if value is available
+     */
+    bool HasValue() const;
+
+  private:
+    /** @brief Value buffers */
+    std::array<T, 2> _buffers;
+
+    /**
+     * @brief Sequence counter
+     *
+     * Counter is incremented twice for each publication - before and after writing value. Therefore it is odd while
+     * new value is being written and (counter / 2) is the number of completed publications.
+     */
+    std::atomic<std::uint32_t> _sequence;
+};
+
+template <typename T, std::uint8_t MaxAttempts> Snapshot<T, MaxAttempts>::Snapshot() : _buffers(), _sequence(0)
+{
+}
+
+template <typename T, std::uint8_t MaxAttempts> void Snapshot<T, MaxAttempts>::Publish(const T& value)
+{
+    const auto sequence = this->_sequence.load(std::memory_order_relaxed);
+    const auto version = (sequence >> 1) + 1;
+
+    this->_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    this->_buffers[version & 1] = value;
+
+    this->_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+template <typename T, std::uint8_t MaxAttempts>
+template <typename Reader>
+bool Snapshot<T, MaxAttempts>::Read(Reader&& reader) const
+{
+    for (auto attempt = 0; attempt < MaxAttempts; attempt++)
+    {
+        const auto sequence = this->_sequence.load(std::memory_order_acquire);
+        const auto version = sequence >> 1;
+        if (version == 0)
+        {
+            return false;
+        }
+
+        reader(this->_buffers[version & 1]);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // buffer that has just been read is overwritten once writer starts publishing version + 2
+        const auto current = this->_sequence.load(std::memory_order_relaxed);
+        if ((current - (version << 1)) < 3)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, std::uint8_t MaxAttempts> bool Snapshot<T, MaxAttempts>::Get(T& value) const
+{
+    return Read([&value](const T& current) { value = current; });
+}
+
+template <typename T, std::uint8_t MaxAttempts> inline bool Snapshot<T, MaxAttempts>::HasValue() const
+{
+    return (this->_sequence.load(std::memory_order_acquire) >> 1) != 0;
+}
+
+/** @} */
+
+#endif /* LIBS_BASE_INCLUDE_BASE_SNAPSHOT_HPP_ */
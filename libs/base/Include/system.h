@@ -43,6 +43,12 @@ template <typename T, std::size_t size> constexpr inline std::size_t count_of(T
 #define __packed __attribute__((aligned(1)))
 #endif
 
+#ifdef __GLIBC__
+/* sniprintf & vsniprintf are newlib integer-only printf variants, use standard ones on host */
+#define sniprintf snprintf
+#define vsniprintf vsnprintf
+#endif
+
 #ifdef __cplusplus
 #define EXTERNC_BEGIN extern "C" {
 #define EXTERNC_END }
@@ -665,12 +665,12 @@ std::size_t strlen_n(const char* s, std::size_t maxSize);
 
 template <std::size_t N> std::size_t strsafecpy(char (&destination)[N], gsl::cstring_span<> source)
 {
-    return sniprintf(destination, N, "%.*s", source.size(), source.data());
+    return sniprintf(destination, N, "%.*s", static_cast<int>(source.size()), source.data());
 }
 
 template <std::size_t N> std::size_t strsafecpy(char (&destination)[N], const char* source, size_t sourceMaxLength)
 {
-    return sniprintf(destination, N, "%.*s", sourceMaxLength, source);
+    return sniprintf(destination, N, "%.*s", static_cast<int>(sourceMaxLength), source);
 }
 
 #endif
@@ -0,0 +1,121 @@
+#include "base/lzss.hpp"
+#include <algorithm>
+#include "base/BitWriter.hpp"
+
+using namespace lzss;
+
+/** @brief Size of literal token in bits */
+static constexpr std::uint32_t LiteralBits = 1 + 8;
+
+/** @brief Size of back reference token in bits */
+static constexpr std::uint32_t BackReferenceBits = 1 + WindowBits + LengthBits;
+
+static_assert(MinMatchLength * LiteralBits > BackReferenceBits, "Back reference must be shorter than literals it replaces");
+
+CompressionResult lzss::Compress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output)
+{
+    BitWriter writer(output);
+    const std::uint32_t capacity = output.size() * 8;
+    std::size_t position = 0;
+
+    while (position < static_cast<std::size_t>(input.size()))
+    {
+        const auto maxLength = std::min<std::size_t>(MaxMatchLength, input.size() - position);
+        const auto maxDistance = std::min<std::size_t>(WindowSize, position);
+        const auto current = input.data() + position;
+
+        std::size_t bestLength = 0;
+        std::size_t bestDistance = 0;
+
+        for (std::size_t distance = 1; distance <= maxDistance && bestLength < maxLength; distance++)
+        {
+            const auto candidate = current - distance;
+
+            std::size_t length = 0;
+            while (length < maxLength && candidate[length] == current[length])
+            {
+                length++;
+            }
+
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestDistance = distance;
+            }
+        }
+
+        const bool isBackReference = bestLength >= MinMatchLength;
+
+        if (writer.GetBitDataLength() + (isBackReference ? BackReferenceBits : LiteralBits) > capacity)
+        {
+            break;
+        }
+
+        if (isBackReference)
+        {
+            writer.Write(false);
+            writer.WriteWord(bestDistance - 1, WindowBits);
+            writer.WriteWord(bestLength - MinMatchLength, LengthBits);
+            position += bestLength;
+        }
+        else
+        {
+            writer.Write(true);
+            writer.Write(*current);
+            position++;
+        }
+    }
+
+    return {position, writer.GetByteDataLength()};
+}
+
+gsl::span<std::uint8_t> lzss::Decompress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output)
+{
+    const std::size_t totalBits = input.size() * 8;
+    std::size_t bit = 0;
+    std::size_t position = 0;
+
+    auto read = [&input, &bit](std::uint8_t length) {
+        std::uint16_t value = 0;
+        for (std::uint8_t i = 0; i < length; i++, bit++)
+        {
+            value |= ((input[bit / 8] >> (bit % 8)) & 1) << i;
+        }
+
+        return value;
+    };
+
+    while (totalBits - bit >= LiteralBits)
+    {
+        if (read(1) == 1)
+        {
+            if (position == static_cast<std::size_t>(output.size()))
+            {
+                return {};
+            }
+
+            output[position++] = static_cast<std::uint8_t>(read(8));
+            continue;
+        }
+
+        if (totalBits - bit < BackReferenceBits - 1)
+        {
+            break;
+        }
+
+        const std::size_t distance = read(WindowBits) + 1;
+        const std::size_t length = read(LengthBits) + MinMatchLength;
+
+        if (distance > position || position + length > static_cast<std::size_t>(output.size()))
+        {
+            return {};
+        }
+
+        for (std::size_t i = 0; i < length; i++, position++)
+        {
+            output[position] = output[position - distance];
+        }
+    }
+
+    return output.subspan(0, position);
+}
@@ -19,7 +19,7 @@ namespace beacon
     {
         LOG(LOG_LEVEL_INFO, "Send beacon!");
 
-        auto telemetry = this->_telemetry.GetState();
+        const auto& telemetry = this->_telemetry.GetState();
 
         std::chrono::seconds beaconDelay;
 
@@ -0,0 +1,360 @@
+#include "DownlinkQueue.hpp"
+#include <algorithm>
+#include <cstring>
+#include "base/BitWriter.hpp"
+#include "logger/logger.h"
+
+COMM_BEGIN
+
+constexpr std::uint8_t DownlinkQueue::ControlCapacity;
+constexpr std::uint8_t DownlinkQueue::BulkCapacity;
+constexpr std::uint8_t DownlinkQueue::PoolCapacity;
+constexpr std::uint8_t DownlinkQueue::MaxAttempts;
+constexpr std::uint8_t DownlinkQueue::BulkReservedSlots;
+constexpr std::chrono::milliseconds DownlinkQueue::ControlEnqueueTimeout;
+constexpr std::chrono::milliseconds DownlinkQueue::BulkEnqueueTimeout;
+constexpr std::chrono::milliseconds DownlinkQueue::FullBufferDelay;
+constexpr OSEventBits DownlinkQueue::FrameQueued;
+constexpr OSEventBits DownlinkQueue::UrgentFrameQueued;
+
+/** @brief Value reported by transmitter when frame has not been accepted */
+static constexpr std::uint8_t FrameRejected = 0xFF;
+
+/**
+ * @brief Saturates value to maximal value of telemetry field
+ * @param value Value
+ * @param bits Width of telemetry field
+ * @return Saturated value
+ */
+static std::uint8_t Saturate(std::uint32_t value, std::uint8_t bits)
+{
+    return static_cast<std::uint8_t>(std::min<std::uint32_t>(value, (1u << bits) - 1));
+}
+
+/**
+ * @brief Converts counter to logarithmic scale
+ * @param value Counter value
+ * @param bits Width of telemetry field
+ * @return Number of significant bits of counter, saturated to maximal value of telemetry field
+ */
+static std::uint8_t LogScale(std::uint32_t value, std::uint8_t bits)
+{
+    std::uint8_t significantBits = 0;
+    for (; value != 0; value >>= 1)
+    {
+        significantBits++;
+    }
+
+    return Saturate(significantBits, bits);
+}
+
+DownlinkQueueTelemetry::DownlinkQueueTelemetry() : _depth(0), _controlDropped(0), _bulkDropped(0)
+{
+}
+
+DownlinkQueueTelemetry::DownlinkQueueTelemetry(std::uint8_t depth, std::uint32_t controlDropped, std::uint32_t bulkDropped)
+    : _depth(Saturate(depth, decltype(_depth)::Size)),
+      _controlDropped(LogScale(controlDropped, decltype(_controlDropped)::Size)),
+      _bulkDropped(LogScale(bulkDropped, decltype(_bulkDropped)::Size))
+{
+}
+
+std::uint8_t DownlinkQueueTelemetry::Depth() const
+{
+    return this->_depth;
+}
+
+std::uint8_t DownlinkQueueTelemetry::ControlDropped() const
+{
+    return this->_controlDropped;
+}
+
+std::uint8_t DownlinkQueueTelemetry::BulkDropped() const
+{
+    return this->_bulkDropped;
+}
+
+void DownlinkQueueTelemetry::Write(BitWriter& writer) const
+{
+    writer.Write(this->_depth);
+    writer.Write(this->_controlDropped);
+    writer.Write(this->_bulkDropped);
+}
+
+DownlinkQueue::DownlinkQueue(IFlowControlledTransmitter& transmitter, DownlinkFrameClassifier classifier)
+    : _transmitter(transmitter), _classifier(classifier), _depth{}, _dropped{}, _taskHandle(nullptr)
+{
+}
+
+OSResult DownlinkQueue::Initialize()
+{
+    auto result = this->_free.Create();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    for (auto& buffer : this->_pool)
+    {
+        this->_free.Push(&buffer, std::chrono::milliseconds::zero());
+    }
+
+    result = this->_control.Create();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    result = this->_beacon.Create();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    result = this->_bulk.Create();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    result = this->_events.Initialize();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    return System::CreateTask(SenderTask, "Downlink", 2_KB, this, TaskPriority::P4, &this->_taskHandle);
+}
+
+bool DownlinkQueue::SendFrame(gsl::span<const std::uint8_t> frame)
+{
+    if (frame.size() > MaxDownlinkFrameSize)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[downlink] Frame is too long: %d", static_cast<int>(frame.size()));
+        return false;
+    }
+
+    const auto priority = this->_classifier(frame);
+    DownlinkFrameBuffer* buffer = nullptr;
+    if (OS_RESULT_FAILED(this->_free.Pop(buffer, EnqueueTimeout(priority))))
+    {
+        this->_dropped[num(priority)]++;
+        LOG(LOG_LEVEL_WARNING, "[downlink] No free frame buffer, dropping frame");
+        return false;
+    }
+
+    std::memcpy(buffer->data() + DownlinkFrameHeadroom, frame.data(), frame.size());
+    return SendFrameBuffer(*buffer, static_cast<std::uint8_t>(frame.size()));
+}
+
+std::chrono::milliseconds DownlinkQueue::EnqueueTimeout(DownlinkPriority priority)
+{
+    switch (priority)
+    {
+        case DownlinkPriority::Control:
+            return ControlEnqueueTimeout;
+
+        case DownlinkPriority::Bulk:
+            return BulkEnqueueTimeout;
+
+        default:
+            return std::chrono::milliseconds::zero();
+    }
+}
+
+DownlinkFrameBuffer* DownlinkQueue::AcquireFrameBuffer()
+{
+    DownlinkFrameBuffer* buffer = nullptr;
+    if (OS_RESULT_FAILED(this->_free.Pop(buffer, std::chrono::milliseconds::zero())))
+    {
+        return nullptr;
+    }
+
+    return buffer;
+}
+
+void DownlinkQueue::ReleaseFrameBuffer(DownlinkFrameBuffer& buffer)
+{
+    this->_free.Push(&buffer, std::chrono::milliseconds::zero());
+}
+
+bool DownlinkQueue::SendFrameBuffer(DownlinkFrameBuffer& buffer, std::uint8_t frameSize)
+{
+    if (frameSize > MaxDownlinkFrameSize)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[downlink] Frame is too long: %d", frameSize);
+        ReleaseFrameBuffer(buffer);
+        return false;
+    }
+
+    QueuedFrame queued;
+    queued.Buffer = &buffer;
+    queued.Size = frameSize;
+
+    const auto priority = this->_classifier(gsl::make_span(buffer).subspan(DownlinkFrameHeadroom, frameSize));
+    auto& depth = this->_depth[num(priority)];
+
+    OSResult result = OSResult::Success;
+    switch (priority)
+    {
+        case DownlinkPriority::Beacon:
+        {
+            // sender may take queued beacon at any moment, so depth is counted like in other classes instead of being stored
+            QueuedFrame previous;
+            if (OS_RESULT_SUCCEEDED(this->_beacon.Pop(previous, std::chrono::milliseconds::zero())))
+            {
+                depth--;
+                ReleaseFrameBuffer(*previous.Buffer);
+            }
+
+            depth++;
+            result = this->_beacon.Push(queued, std::chrono::milliseconds::zero());
+            break;
+        }
+
+        case DownlinkPriority::Control:
+            depth++;
+            result = this->_control.Push(queued, ControlEnqueueTimeout);
+            break;
+
+        case DownlinkPriority::Bulk:
+            depth++;
+            result = this->_bulk.Push(queued, BulkEnqueueTimeout);
+            break;
+    }
+
+    if (OS_RESULT_FAILED(result))
+    {
+        ReleaseFrameBuffer(buffer);
+        depth--;
+        this->_dropped[num(priority)]++;
+        LOGF(LOG_LEVEL_WARNING, "[downlink] Queue %d is full, dropping frame", num(priority));
+        return false;
+    }
+
+    this->_events.Set(priority == DownlinkPriority::Bulk ? FrameQueued : (FrameQueued | UrgentFrameQueued));
+    return true;
+}
+
+bool DownlinkQueue::TakeNext(QueuedFrame& frame, DownlinkPriority& priority)
+{
+    if (OS_RESULT_SUCCEEDED(this->_control.Pop(frame, std::chrono::milliseconds::zero())))
+    {
+        priority = DownlinkPriority::Control;
+        this->_depth[num(priority)]--;
+        return true;
+    }
+
+    if (OS_RESULT_SUCCEEDED(this->_beacon.Pop(frame, std::chrono::milliseconds::zero())))
+    {
+        priority = DownlinkPriority::Beacon;
+        this->_depth[num(priority)]--;
+        return true;
+    }
+
+    if (OS_RESULT_SUCCEEDED(this->_bulk.Pop(frame, std::chrono::milliseconds::zero())))
+    {
+        priority = DownlinkPriority::Bulk;
+        this->_depth[num(priority)]--;
+        return true;
+    }
+
+    return false;
+}
+
+std::uint8_t DownlinkQueue::Transmit(const QueuedFrame& frame, DownlinkPriority priority)
+{
+    for (auto attempt = 0; attempt < MaxAttempts; attempt++)
+    {
+        std::uint8_t remainingSlots = FrameRejected;
+        if (this->_transmitter.SendFrameInPlace(*frame.Buffer, frame.Size, remainingSlots))
+        {
+            return remainingSlots;
+        }
+
+        LOGF(LOG_LEVEL_WARNING, "[downlink] Frame not accepted (attempt %d)", attempt + 1);
+        System::SleepTask(FullBufferDelay);
+    }
+
+    this->_dropped[num(priority)]++;
+    LOG(LOG_LEVEL_ERROR, "[downlink] Transmitter refused frame, dropping it");
+    return FrameRejected;
+}
+
+void DownlinkQueue::SenderTask(void* param)
+{
+    auto queue = static_cast<DownlinkQueue*>(param);
+    QueuedFrame frame;
+    DownlinkPriority priority;
+
+    for (;;)
+    {
+        if (!queue->TakeNext(frame, priority))
+        {
+            queue->_events.WaitAny(FrameQueued | UrgentFrameQueued, true, InfiniteTimeout);
+            continue;
+        }
+
+        const auto remainingSlots = queue->Transmit(frame, priority);
+        queue->ReleaseFrameBuffer(*frame.Buffer);
+        if (remainingSlots == 0)
+        {
+            // transmitter buffer is full, give it time to send at least one frame
+            System::SleepTask(FullBufferDelay);
+        }
+        else if (priority == DownlinkPriority::Bulk && remainingSlots < BulkReservedSlots)
+        {
+            // keep bulk backlog inside transmitter short, but do not delay urgent frames
+            queue->_events.WaitAny(UrgentFrameQueued, false, FullBufferDelay);
+        }
+    }
+}
+
+bool DownlinkQueue::GetTransmitterTelemetry(TransmitterTelemetry& telemetry)
+{
+    return this->_transmitter.GetTransmitterTelemetry(telemetry);
+}
+
+bool DownlinkQueue::SetTransmitterStateWhenIdle(IdleState requestedState)
+{
+    return this->_transmitter.SetTransmitterStateWhenIdle(requestedState);
+}
+
+bool DownlinkQueue::SetTransmitterBitRate(Bitrate bitrate)
+{
+    return this->_transmitter.SetTransmitterBitRate(bitrate);
+}
+
+bool DownlinkQueue::ResetTransmitter()
+{
+    return this->_transmitter.ResetTransmitter();
+}
+
+DownlinkQueueTelemetry DownlinkQueue::GetQueueTelemetry() const
+{
+    return DownlinkQueueTelemetry(Depth(DownlinkPriority::Control) + Depth(DownlinkPriority::Bulk),
+        Dropped(DownlinkPriority::Control),
+        Dropped(DownlinkPriority::Bulk));
+}
+
+std::uint8_t DownlinkQueue::Depth(DownlinkPriority priority) const
+{
+    return this->_depth[num(priority)];
+}
+
+std::uint32_t DownlinkQueue::Dropped(DownlinkPriority priority) const
+{
+    return this->_dropped[num(priority)];
+}
+
+QueuedResponseFrameHandler::QueuedResponseFrameHandler(IHandleFrame& handler, ITransmitter& downlink)
+    : _handler(handler), _downlink(downlink)
+{
+}
+
+void QueuedResponseFrameHandler::HandleFrame(ITransmitter& /*transmitter*/, Frame& frame)
+{
+    this->_handler.HandleFrame(this->_downlink, frame);
+}
+
+COMM_END
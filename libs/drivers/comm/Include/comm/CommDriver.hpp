@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include "Frame.hpp"
 #include "IBeaconController.hpp"
 #include "ITransmitter.hpp"
+#include "ReceivePolling.hpp"
 #include "base/os.h"
 #include "comm.hpp"
 #include "error_counter/error_counter.hpp"
@@ -20,10 +24,11 @@ COMM_BEGIN
  * perform requested action.
  */
 
-class CommObject final : public ITransmitter,      //
-                         public IBeaconController, //
+class CommObject final : public IFlowControlledTransmitter, //
+                         public IBeaconController,           //
                          public ICommTelemetryProvider,
-                         public ICommHardwareObserver
+                         public ICommHardwareObserver,
+                         public IReceivePollingStatisticsProvider
 {
   public:
     /**
@@ -127,6 +132,47 @@ class CommObject final : public ITransmitter,      //
      */
     virtual bool SendFrame(gsl::span<const std::uint8_t> frame) override final;
 
+    /**
+     * @brief Adds the requested frame to the send queue.
+     *
+     * @param[in] frame Buffer containing frame contents.
+     * @param[out] remainingSlots Number of free slots in transmitter's output buffer, 0xFF if frame has not been accepted.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& remainingSlots) override final;
+
+    /**
+     * @brief Adds frame to the send queue writing transmitter command directly into buffer's headroom.
+     *
+     * @param[in] buffer Buffer containing frame contents after @ref DownlinkFrameHeadroom bytes.
+     * @param[in] frameSize Size of the frame.
+     * @param[out] remainingSlots Number of free slots in transmitter's output buffer, 0xFF if frame has not been accepted.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrameInPlace(DownlinkFrameBuffer& buffer, std::uint8_t frameSize, std::uint8_t& remainingSlots) override final;
+
+    /**
+     * @brief Acquires the only frame buffer owned by the driver.
+     * @return Pointer to frame buffer or nullptr if it is already in use.
+     */
+    virtual DownlinkFrameBuffer* AcquireFrameBuffer() override final;
+
+    /**
+     * @brief Adds frame built in acquired buffer to the send queue and releases the buffer.
+     *
+     * @param[in] buffer Buffer obtained from @ref AcquireFrameBuffer.
+     * @param[in] frameSize Size of the frame.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrameBuffer(DownlinkFrameBuffer& buffer, std::uint8_t frameSize) override final;
+
+    /**
+     * @brief Releases acquired frame buffer.
+     *
+     * @param[in] buffer Buffer obtained from @ref AcquireFrameBuffer.
+     */
+    virtual void ReleaseFrameBuffer(DownlinkFrameBuffer& buffer) override final;
+
     /**
      * @brief Requests the contents of the oldest received frame from the queue.
      *
@@ -223,10 +269,27 @@ class CommObject final : public ITransmitter,      //
      */
     bool PollHardware();
 
+    /**
+     * @brief Requests immediate receiver query regardless of current polling interval.
+     *
+     * Hook for event sources that know about incoming frames earlier than the comm task polls for them (e.g. GPIO
+     * interrupt from receiver).
+     * @remark Must not be used from ISR, use @ref WakeUpISR instead.
+     */
+    void WakeUp();
+
+    /**
+     * @brief Requests immediate receiver query from ISR.
+     * @see WakeUp
+     */
+    void WakeUpISR();
+
     virtual bool GetTelemetry(CommTelemetry& telemetry) final override;
 
     void WaitForComLoop() final override;
 
+    virtual ReceivePollingStatistics GetReceivePollingStatistics() const final override;
+
     /** @brief Error counter type */
     using ErrorCounter = error_counter::ErrorCounter<0>;
 
@@ -236,6 +299,9 @@ class CommObject final : public ITransmitter,      //
     /** @brief Id of semaphore used for receiver synchronization. */
     static constexpr std::uint8_t receiverSemaphoreId = 2;
 
+    /** @brief Maximal number of frames retrieved from receiver before they are passed to frame handler. */
+    static constexpr std::uint8_t ReceivePoolCapacity = 8;
+
   private:
     /** @brief Error reporter type */
     using ErrorReporter = error_counter::AggregatedErrorReporter<ErrorCounter::DeviceId>;
@@ -288,31 +354,54 @@ class CommObject final : public ITransmitter,      //
         error_counter::AggregatedErrorCounter& resultAggregator //
         );
     /**
-     * @brief This procedure will try to download the oldest not yet processed frame from the hardware.
+     * @brief Frame retrieved from the hardware and waiting for processing.
+     */
+    struct PooledFrame
+    {
+        /** @brief Frame descriptor, its payload points into @ref Buffer */
+        Frame Descriptor;
+
+        /** @brief Frame storage, 6 bytes of header followed by frame contents */
+        std::array<std::uint8_t, MaxUplinkFrameSize + 6> Buffer;
+    };
+
+    /**
+     * @brief This procedure is responsible for downloading single frame from the hardware into pool slot.
      *
-     * The passed buffer is used as frame content storage area and should be large enough to fit
-     * the entire frame (with its header). IF the buffer is not long enough to contain the entire frame with
-     * its header then the part of the frame that will not fit into the buffer  will be discarded.
+     * Once the frame is downloaded (or all retries failed) this function will try to remove it from the hardware.
+     * @param[in] slot Pool slot for the frame
+     * @return True if valid frame has been stored in the slot
+     */
+    bool FetchFrame(PooledFrame& slot);
+
+    /**
+     * @brief Downloads the oldest not yet processed frame from the hardware into pool slot.
      *
-     * @param[in] buffer Buffer for the frame contents. This method will try to read at most the number of bytes
-     * that is equal to the passed buffer size, any additional bytes that are send by the device
-     * that will not fit into the passed buffer will be discarded.
-     * @param[in] retryCount Number of frame download & processing retrials. Passing value less than 1
-     * will make this function as no operation.
-     * @param[out] frame Frame object that will be filled with the received frame details. This variable is
-     * valid only in case of success and is left untouched in case of failure.
+     * Slot buffer is large enough for the largest uplink frame, so entire frame is retrieved in single
+     * transaction without querying its size first.
+     * @param[in] slot Pool slot for the frame
      * @param[in] resultAggregator Aggregator for error counter
      * @return Operation status, true in case of success, false otherwise.
      */
-    bool GetFrame(gsl::span<std::uint8_t> buffer, int retryCount, Frame& frame, error_counter::AggregatedErrorCounter& resultAggregator);
+    bool ReceivePooledFrame(PooledFrame& slot, error_counter::AggregatedErrorCounter& resultAggregator);
 
     /**
-     * @brief This procedure is responsible for downloading single frame from the hardware
-     * and pushing it through the frame the processing pipeline.
+     * @brief Queries receiver for frame count and processes reported frames.
      *
-     * Once the frame is processed this function will try to remove it from the hardware.
+     * Up to @ref ReceivePoolCapacity frames are downloaded and removed from the hardware first and only then pushed
+     * through the frame processing pipeline, so the receiver buffer is freed as soon as possible during frame bursts
+     * and slow frame handlers do not interleave with bus transactions.
+     * @return Number of frames removed from receiver
      */
-    void ProcessSingleFrame();
+    std::uint16_t ReceiveFrames();
+
+    /**
+     * @brief Single iteration of comm task.
+     *
+     * Processes incoming frames until receiver is empty, updates polling policy and resets hardware watchdog if
+     * it has not been reset for @ref WatchdogResetPeriod.
+     */
+    void ServiceReceiver();
 
     /**
      * @brief This procedure sets the beacon frame for the passed comm object.
@@ -336,6 +425,22 @@ class CommObject final : public ITransmitter,      //
         error_counter::AggregatedErrorCounter& resultAggregator         //
         );
 
+    /**
+     * @brief Adds frame stored after @ref DownlinkFrameHeadroom bytes of the buffer to the send queue.
+     *
+     * Transmitter command is written into the headroom, so frame contents are passed to I2C bus without copying.
+     * @param[in] buffer Buffer containing headroom followed by frame contents.
+     * @param[in] frameSize Size of the frame.
+     * @param[out] remainingSlots Number of free slots in transmitter's output buffer.
+     * @param[in] resultAggregator Aggregator for error counter
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    bool ScheduleFrameBufferTransmission(DownlinkFrameBuffer& buffer, //
+        std::uint8_t frameSize,                                       //
+        std::uint8_t& remainingSlots,                                 //
+        error_counter::AggregatedErrorCounter& resultAggregator       //
+        );
+
     bool ReceiveFrameInternal(gsl::span<std::uint8_t> buffer, Frame& frame, error_counter::AggregatedErrorCounter& resultAggregator);
     bool RemoveFrameInternal(error_counter::AggregatedErrorCounter& resultAggregator);
     bool ResetInternal(error_counter::AggregatedErrorCounter& resultAggregator);
@@ -391,13 +496,44 @@ class CommObject final : public ITransmitter,      //
     };
 
     std::atomic<LastFrameStatus> _lastFrameStatus;
+
+    /** @brief Buffer in which frames are built in place */
+    DownlinkFrameBuffer _frameBuffer;
+
+    /** @brief Flag indicating that frame buffer has been acquired */
+    std::atomic<bool> _frameBufferInUse;
+
+    /** @brief Frames retrieved from receiver in the current batch */
+    std::array<PooledFrame, ReceivePoolCapacity> _receivePool;
+
+    /** @brief Policy deciding how often receiver is queried */
+    AdaptiveReceivePolling _receivePolling;
+
+    /** @brief Time of last hardware watchdog reset done by comm task */
+    std::chrono::milliseconds _lastWatchdogReset;
+
+    /** @brief Interval between hardware watchdog resets done by comm task */
+    static constexpr std::chrono::milliseconds WatchdogResetPeriod = std::chrono::milliseconds(1000);
 };
 
 inline bool CommObject::SendFrame(gsl::span<const std::uint8_t> frame)
 {
-    error_counter::AggregatedErrorReporter<0> errorContext(_error);
     std::uint8_t remainingBufferSize;
-    return ScheduleFrameTransmission(frame, remainingBufferSize, errorContext.Counter());
+    return SendFrame(frame, remainingBufferSize);
+}
+
+inline bool CommObject::SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& remainingSlots)
+{
+    error_counter::AggregatedErrorReporter<0> errorContext(_error);
+    remainingSlots = 0xFF;
+    return ScheduleFrameTransmission(frame, remainingSlots, errorContext.Counter());
+}
+
+inline bool CommObject::SendFrameInPlace(DownlinkFrameBuffer& buffer, std::uint8_t frameSize, std::uint8_t& remainingSlots)
+{
+    error_counter::AggregatedErrorReporter<0> errorContext(_error);
+    remainingSlots = 0xFF;
+    return ScheduleFrameBufferTransmission(buffer, frameSize, remainingSlots, errorContext.Counter());
 }
 
 inline void CommObject::SetFrameHandler(IHandleFrame& handler)
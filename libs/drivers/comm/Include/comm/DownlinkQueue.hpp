@@ -0,0 +1,335 @@
+#ifndef LIBS_DRIVERS_COMM_DOWNLINK_QUEUE_HPP
+#define LIBS_DRIVERS_COMM_DOWNLINK_QUEUE_HPP
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "IHandleFrame.hpp"
+#include "ITransmitter.hpp"
+#include "base/os.h"
+#include "comm.hpp"
+#include "gsl/span"
+#include "utils.h"
+
+COMM_BEGIN
+
+/**
+ * @brief Procedure that assigns priority class to downlink frame.
+ * @param[in] frame Complete downlink frame
+ * @return Frame priority class
+ */
+using DownlinkFrameClassifier = DownlinkPriority (*)(gsl::span<const std::uint8_t> frame);
+
+/**
+ * @brief Downlink queue telemetry
+ * @telemetry_element
+ *
+ * Beacon class is not counted as queued beacon is replaced by the newer one instead of being dropped.
+ *
+ * Dropped frame counters are reported in logarithmic scale so that bursts of dropped frames can be told apart within
+ * 3 bits: 0 means no dropped frames, value n means between 2^(n-1) and 2^n - 1 dropped frames and 7 means 64 or more.
+ */
+class DownlinkQueueTelemetry
+{
+  public:
+    /**
+     * @brief ctor.
+     */
+    DownlinkQueueTelemetry();
+
+    /**
+     * @brief ctor.
+     * @param[in] depth Number of control and bulk frames waiting for transmission
+     * @param[in] controlDropped Number of control frames dropped since startup
+     * @param[in] bulkDropped Number of bulk frames dropped since startup
+     */
+    DownlinkQueueTelemetry(std::uint8_t depth, std::uint32_t controlDropped, std::uint32_t bulkDropped);
+
+    /**
+     * @brief Returns number of frames waiting for transmission.
+     * @return Queue depth (saturated to 2 bits).
+     */
+    std::uint8_t Depth() const;
+
+    /**
+     * @brief Returns number of dropped control frames.
+     * @return Dropped frame count in logarithmic scale.
+     */
+    std::uint8_t ControlDropped() const;
+
+    /**
+     * @brief Returns number of dropped bulk frames.
+     * @return Dropped frame count in logarithmic scale.
+     */
+    std::uint8_t BulkDropped() const;
+
+    /**
+     * @brief Write the downlink queue telemetry to passed buffer writer object.
+     * @param[in] writer Buffer writer object that should be used to write the serialized state.
+     */
+    void Write(BitWriter& writer) const;
+
+    /**
+     * @brief Returns size of the serialized state in bits.
+     * @return Size of the serialized state in bits.
+     */
+    static constexpr std::uint32_t BitSize();
+
+  private:
+    BitValue<std::uint8_t, 2> _depth;
+    BitValue<std::uint8_t, 3> _controlDropped;
+    BitValue<std::uint8_t, 3> _bulkDropped;
+};
+
+constexpr std::uint32_t DownlinkQueueTelemetry::BitSize()
+{
+    return Aggregate<decltype(_depth), decltype(_controlDropped), decltype(_bulkDropped)>;
+}
+
+static_assert(DownlinkQueueTelemetry::BitSize() == 8, "Incorrect telemetry format");
+
+/**
+ * @brief Interface of object that provides downlink queue telemetry.
+ */
+struct IDownlinkQueueTelemetryProvider
+{
+    /**
+     * @brief Acquires current downlink queue telemetry.
+     * @return Downlink queue telemetry.
+     */
+    virtual DownlinkQueueTelemetry GetQueueTelemetry() const = 0;
+};
+
+/**
+ * @brief Bounded queues of downlink frames with dedicated sender task.
+ * @ingroup LowerCommDriver
+ *
+ * Producers enqueue frames without waiting for the I2C transfer to the transmitter. Each frame is assigned priority
+ * class and placed in separate queue. Sender task always passes to the transmitter frame from the most urgent
+ * non-empty class and uses number of free slots reported by the transmitter to pace transmissions:
+ *  - once transmitter buffer is full sender waits for @ref FullBufferDelay before sending next frame,
+ *  - bulk frames are passed to transmitter only while it has at least @ref BulkReservedSlots free slots so that
+ *    control responses never wait behind long backlog of bulk frames inside the transmitter.
+ *
+ * Frames are dropped (and counted) when queue is full or transmitter keeps refusing them. Queued beacon is replaced
+ * by the newer one.
+ *
+ * Frames are stored in fixed pool of @ref DownlinkFrameBuffer buffers and queues hold only pointers to them. Producers
+ * can build frame directly in pooled buffer (see @ref AcquireFrameBuffer) and transmitter receives the same buffer, so
+ * frame contents are written once and never copied between producer, queue and I2C transfer.
+ */
+class DownlinkQueue final : public ITransmitter, public IDownlinkQueueTelemetryProvider, private NotCopyable, private NotMoveable
+{
+  public:
+    /**
+     * @brief Ctor
+     * @param[in] transmitter Transmitter that sends frames
+     * @param[in] classifier Procedure that assigns priority class to frames
+     */
+    DownlinkQueue(IFlowControlledTransmitter& transmitter, DownlinkFrameClassifier classifier);
+
+    /**
+     * @brief Creates queues and starts sender task
+     * @return Operation result
+     */
+    OSResult Initialize();
+
+    /**
+     * @brief Adds frame to the queue of its priority class.
+     *
+     * Beacon never waits for free space in queue. Control frames wait up to @ref ControlEnqueueTimeout and bulk frames
+     * up to @ref BulkEnqueueTimeout for free frame buffer and free space in queue, so bursts of frames are throttled
+     * to transmission speed instead of being dropped, while producer is never blocked indefinitely.
+     *
+     * @param[in] frame Buffer containing frame contents.
+     * @return true if frame has been queued, false if it is too long or it could not be queued before timeout.
+     * Caller can report failure to ground station.
+     */
+    virtual bool SendFrame(gsl::span<const std::uint8_t> frame) override;
+
+    /**
+     * @brief Takes free buffer from the pool without waiting.
+     * @return Pointer to frame buffer or nullptr if all buffers are in use.
+     */
+    virtual DownlinkFrameBuffer* AcquireFrameBuffer() override;
+
+    /**
+     * @brief Adds frame built in pooled buffer to the queue of its priority class.
+     *
+     * Queuing rules are the same as for @ref SendFrame. Buffer is returned to the pool when frame has been transmitted
+     * or dropped.
+     *
+     * @param[in] buffer Buffer obtained from @ref AcquireFrameBuffer.
+     * @param[in] frameSize Size of the frame stored after @ref DownlinkFrameHeadroom bytes.
+     * @return true if frame has been queued, false if it is too long or the queue is full.
+     */
+    virtual bool SendFrameBuffer(DownlinkFrameBuffer& buffer, std::uint8_t frameSize) override;
+
+    /**
+     * @brief Returns buffer to the pool.
+     * @param[in] buffer Buffer obtained from @ref AcquireFrameBuffer.
+     */
+    virtual void ReleaseFrameBuffer(DownlinkFrameBuffer& buffer) override;
+
+    virtual bool GetTransmitterTelemetry(TransmitterTelemetry& telemetry) override;
+
+    virtual bool SetTransmitterStateWhenIdle(IdleState requestedState) override;
+
+    virtual bool SetTransmitterBitRate(Bitrate bitrate) override;
+
+    virtual bool ResetTransmitter() override;
+
+    virtual DownlinkQueueTelemetry GetQueueTelemetry() const override;
+
+    /**
+     * @brief Returns number of frames waiting for transmission in single priority class.
+     * @param[in] priority Priority class
+     * @return Number of queued frames
+     */
+    std::uint8_t Depth(DownlinkPriority priority) const;
+
+    /**
+     * @brief Returns number of frames from single priority class dropped since startup.
+     * @param[in] priority Priority class
+     * @return Number of dropped frames
+     */
+    std::uint32_t Dropped(DownlinkPriority priority) const;
+
+    /** @brief Maximal number of control frames waiting for transmission */
+    static constexpr std::uint8_t ControlCapacity = 4;
+
+    /** @brief Maximal number of bulk frames waiting for transmission */
+    static constexpr std::uint8_t BulkCapacity = 12;
+
+    /**
+     * @brief Number of frame buffers
+     *
+     * Every queue can be full while sender task transmits one frame and few producers build their next frames.
+     */
+    static constexpr std::uint8_t PoolCapacity = ControlCapacity + 1 + BulkCapacity + 1 + 3;
+
+    /** @brief Number of attempts to pass single frame to transmitter */
+    static constexpr std::uint8_t MaxAttempts = 5;
+
+    /** @brief Number of transmitter slots that are kept free for control frames and beacon */
+    static constexpr std::uint8_t BulkReservedSlots = 32;
+
+    /** @brief Maximal time control frame producer waits for free space in queue (one frame at 1200bps) */
+    static constexpr std::chrono::milliseconds ControlEnqueueTimeout = std::chrono::milliseconds(2000);
+
+    /** @brief Maximal time bulk frame producer waits for free space in queue */
+    static constexpr std::chrono::milliseconds BulkEnqueueTimeout = std::chrono::milliseconds(20000);
+
+    /** @brief Time after which transmitter with full buffer is expected to accept next frame (one frame at 1200bps) */
+    static constexpr std::chrono::milliseconds FullBufferDelay = std::chrono::milliseconds(2000);
+
+  private:
+    /**
+     * @brief Single queued frame
+     */
+    struct QueuedFrame
+    {
+        /** @brief Pooled buffer holding frame contents */
+        DownlinkFrameBuffer* Buffer;
+        /** @brief Frame length */
+        std::uint8_t Size;
+    };
+
+    /** @brief Event set when any frame has been queued */
+    static constexpr OSEventBits FrameQueued = 1 << 0;
+
+    /** @brief Event set when control frame or beacon has been queued */
+    static constexpr OSEventBits UrgentFrameQueued = 1 << 1;
+
+    /**
+     * @brief Returns maximal time producer of frame waits for free space in queue
+     * @param[in] priority Priority class of frame
+     * @return Enqueue timeout
+     */
+    static std::chrono::milliseconds EnqueueTimeout(DownlinkPriority priority);
+
+    /**
+     * @brief Takes frame from the most urgent non-empty queue
+     * @param[out] frame Frame
+     * @param[out] priority Priority class of the frame
+     * @return true if frame has been taken, false if all queues are empty
+     */
+    bool TakeNext(QueuedFrame& frame, DownlinkPriority& priority);
+
+    /**
+     * @brief Passes single frame to transmitter, retrying when it is not accepted
+     * @param[in] frame Frame to transmit
+     * @param[in] priority Priority class of the frame
+     * @return Number of free slots in transmitter buffer after accepting the frame or 0xFF if frame has been dropped
+     */
+    std::uint8_t Transmit(const QueuedFrame& frame, DownlinkPriority priority);
+
+    /**
+     * @brief Sender task entry point.
+     * @param[in] param Pointer to downlink queue
+     */
+    [[noreturn]] static void SenderTask(void* param);
+
+    /** @brief Transmitter */
+    IFlowControlledTransmitter& _transmitter;
+
+    /** @brief Frame classifier */
+    DownlinkFrameClassifier _classifier;
+
+    /** @brief Frame buffers */
+    std::array<DownlinkFrameBuffer, PoolCapacity> _pool;
+
+    /** @brief Buffers that are not used by any frame */
+    Queue<DownlinkFrameBuffer*, PoolCapacity> _free;
+
+    /** @brief Queued control frames */
+    Queue<QueuedFrame, ControlCapacity> _control;
+
+    /** @brief Most recent beacon */
+    Queue<QueuedFrame, 1> _beacon;
+
+    /** @brief Queued bulk frames */
+    Queue<QueuedFrame, BulkCapacity> _bulk;
+
+    /** @brief Events used to wake up sender task */
+    EventGroup _events;
+
+    /** @brief Number of frames in each queue */
+    std::array<std::atomic<std::uint8_t>, DownlinkPriorityCount> _depth;
+
+    /** @brief Number of dropped frames in each priority class */
+    std::array<std::atomic<std::uint32_t>, DownlinkPriorityCount> _dropped;
+
+    /** @brief Sender task handle */
+    OSTaskHandle _taskHandle;
+};
+
+/**
+ * @brief Frame handler decorator that sends all responses through downlink queue
+ * @ingroup LowerCommDriver
+ */
+class QueuedResponseFrameHandler final : public IHandleFrame
+{
+  public:
+    /**
+     * @brief Ctor
+     * @param[in] handler Decorated frame handler
+     * @param[in] downlink Transmitter used for responses
+     */
+    QueuedResponseFrameHandler(IHandleFrame& handler, ITransmitter& downlink);
+
+    virtual void HandleFrame(ITransmitter& transmitter, Frame& frame) override;
+
+  private:
+    /** @brief Decorated frame handler */
+    IHandleFrame& _handler;
+    /** @brief Transmitter used for responses */
+    ITransmitter& _downlink;
+};
+
+COMM_END
+
+#endif
@@ -21,6 +21,30 @@ struct ITransmitter
      */
     virtual bool SendFrame(gsl::span<const std::uint8_t> frame) = 0;
 
+    /**
+     * @brief Acquires transmitter-owned buffer in which single frame can be built in place.
+     *
+     * Acquired buffer must be returned to the transmitter with either @ref SendFrameBuffer or @ref ReleaseFrameBuffer.
+     * @return Pointer to frame buffer or nullptr if there is no free buffer.
+     */
+    virtual DownlinkFrameBuffer* AcquireFrameBuffer() = 0;
+
+    /**
+     * @brief Adds frame built in acquired buffer to the send queue and returns buffer to the transmitter.
+     *
+     * @param[in] buffer Buffer obtained from @ref AcquireFrameBuffer.
+     * @param[in] frameSize Size of the frame stored after @ref DownlinkFrameHeadroom bytes.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrameBuffer(DownlinkFrameBuffer& buffer, std::uint8_t frameSize) = 0;
+
+    /**
+     * @brief Returns acquired buffer to the transmitter without sending it.
+     *
+     * @param[in] buffer Buffer obtained from @ref AcquireFrameBuffer.
+     */
+    virtual void ReleaseFrameBuffer(DownlinkFrameBuffer& buffer) = 0;
+
     /**
      * @brief Queries the comm driver for the transmitter telemetry.
      *
@@ -55,6 +79,35 @@ struct ITransmitter
     virtual bool ResetTransmitter() = 0;
 };
 
+/**
+ * @brief Transmitter that reports how many frames it is still able to accept.
+ * @ingroup LowerCommDriver
+ */
+struct IFlowControlledTransmitter : public ITransmitter
+{
+    using ITransmitter::SendFrame;
+
+    /**
+     * @brief Adds the requested frame to the send queue.
+     *
+     * @param[in] frame Buffer containing frame contents.
+     * @param[out] remainingSlots Number of free slots in transmitter's output buffer, 0xFF if frame has not been accepted.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& remainingSlots) = 0;
+
+    /**
+     * @brief Adds frame to the send queue using buffer with reserved headroom.
+     *
+     * Transmitter may overwrite headroom bytes, frame contents are not copied. Buffer remains owned by the caller.
+     * @param[in] buffer Buffer containing @ref DownlinkFrameHeadroom reserved bytes followed by frame contents.
+     * @param[in] frameSize Size of the frame.
+     * @param[out] remainingSlots Number of free slots in transmitter's output buffer, 0xFF if frame has not been accepted.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrameInPlace(DownlinkFrameBuffer& buffer, std::uint8_t frameSize, std::uint8_t& remainingSlots) = 0;
+};
+
 COMM_END
 
 #endif /* LIBS_DRIVERS_COMM_ITRANSMITTER_HPP */
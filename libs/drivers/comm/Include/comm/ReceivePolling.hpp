@@ -0,0 +1,119 @@
+#ifndef LIBS_DRIVERS_COMM_RECEIVE_POLLING_HPP
+#define LIBS_DRIVERS_COMM_RECEIVE_POLLING_HPP
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "comm.hpp"
+#include "utils.h"
+
+COMM_BEGIN
+
+/** @brief Number of receive latency histogram buckets */
+constexpr std::uint8_t ReceiveLatencyBucketCount = 7;
+
+/**
+ * @brief Snapshot of adaptive receive polling state
+ */
+struct ReceivePollingStatistics
+{
+    /** @brief Current interval between subsequent receiver queries */
+    std::chrono::milliseconds Interval;
+
+    /**
+     * @brief Receive latency histogram
+     *
+     * Latency of received frame is estimated as time elapsed since previous receiver query as frame could have arrived
+     * at any time in between. Bucket i counts frames with latency not greater than @ref AdaptiveReceivePolling::LatencyBucketLimits[i],
+     * last bucket counts all remaining frames. Counters saturate at 0xFFFF.
+     */
+    std::array<std::uint16_t, ReceiveLatencyBucketCount> Latency;
+};
+
+/**
+ * @brief Interface of object that provides receive polling statistics
+ */
+struct IReceivePollingStatisticsProvider
+{
+    /**
+     * @brief Returns current receive polling statistics
+     * @return Receive polling statistics
+     */
+    virtual ReceivePollingStatistics GetReceivePollingStatistics() const = 0;
+};
+
+/**
+ * @brief Policy deciding how often comm receiver is queried for incoming frames
+ *
+ * Receiver is queried frequently (every @ref FastInterval) for @ref PassWindow after the last received frame as more
+ * frames are expected during communication session. Outside of session interval is doubled after every empty query up
+ * to @ref MaxInterval to save I2C bandwidth.
+ *
+ * @remark Only one task is allowed to update the policy, statistics can be read concurrently.
+ */
+class AdaptiveReceivePolling final : private NotCopyable, private NotMoveable
+{
+  public:
+    /**
+     * @brief Ctor
+     */
+    AdaptiveReceivePolling();
+
+    /**
+     * @brief Returns time to wait before next receiver query
+     * @return Polling interval
+     */
+    std::chrono::milliseconds Interval() const;
+
+    /**
+     * @brief Updates policy with result of receiver query
+     * @param[in] now Time of the query
+     * @param[in] framesReceived Number of frames received in the query
+     */
+    void Update(std::chrono::milliseconds now, std::uint16_t framesReceived);
+
+    /**
+     * @brief Returns current statistics
+     * @return Receive polling statistics
+     */
+    ReceivePollingStatistics Statistics() const;
+
+    /** @brief Polling interval used during communication session */
+    static constexpr std::chrono::milliseconds FastInterval = std::chrono::milliseconds(50);
+
+    /** @brief Maximal polling interval when no frames are received */
+    static constexpr std::chrono::milliseconds MaxInterval = std::chrono::milliseconds(2000);
+
+    /** @brief Time after last received frame during which receiver is polled with @ref FastInterval */
+    static constexpr std::chrono::milliseconds PassWindow = std::chrono::milliseconds(30000);
+
+    /** @brief Upper limits (inclusive, in ms) of receive latency histogram buckets except for the last one */
+    static constexpr std::array<std::uint16_t, ReceiveLatencyBucketCount - 1> LatencyBucketLimits{{50, 100, 250, 500, 1000, 2000}};
+
+  private:
+    /**
+     * @brief Records latency of received frames in histogram
+     * @param[in] latency Receive latency
+     * @param[in] frames Number of frames
+     */
+    void RecordLatency(std::chrono::milliseconds latency, std::uint16_t frames);
+
+    /** @brief Current polling interval in ms */
+    std::atomic<std::uint16_t> _interval;
+
+    /** @brief Time of previous receiver query */
+    std::chrono::milliseconds _lastQuery;
+
+    /** @brief Time until which receiver is polled with @ref FastInterval */
+    std::chrono::milliseconds _passEnd;
+
+    /** @brief Receive latency histogram */
+    std::array<std::atomic<std::uint16_t>, ReceiveLatencyBucketCount> _latency;
+};
+
+COMM_END
+
+#endif /* LIBS_DRIVERS_COMM_RECEIVE_POLLING_HPP */
@@ -1,6 +1,7 @@
 #ifndef SRC_DEVICES_COMM_H_
 #define SRC_DEVICES_COMM_H_
 
+#include <array>
 #include <cstdint>
 #include <gsl/span>
 #include "base/fwd.hpp"
@@ -51,12 +52,16 @@ COMM_BEGIN
 class Frame;
 class Beacon;
 class CommTelemetry;
+class DownlinkQueueTelemetry;
 class CommObject;
 
 struct IHandleFrame;
 struct ITransmitter;
+struct IFlowControlledTransmitter;
+class DownlinkQueue;
 struct IBeaconController;
 struct ICommTelemetryProvider;
+struct IDownlinkQueueTelemetryProvider;
 
 /**
  * @brief Maximum allowed single frame content length.
@@ -71,6 +76,34 @@ constexpr std::uint16_t MaxUplinkFrameSize = 200u;
  */
 constexpr std::uint16_t PrefferedBufferSize = MaxDownlinkFrameSize + 20;
 
+/**
+ * @brief Number of bytes reserved in front of downlink frame for transmitter command.
+ */
+constexpr std::uint8_t DownlinkFrameHeadroom = 1;
+
+/**
+ * @brief Buffer in which single downlink frame is built in place.
+ *
+ * Frame contents start after @ref DownlinkFrameHeadroom bytes, so buffer can be passed to transmitter hardware
+ * without copying the frame.
+ */
+using DownlinkFrameBuffer = std::array<std::uint8_t, DownlinkFrameHeadroom + MaxDownlinkFrameSize>;
+
+/**
+ * @brief Priority class of downlink frame
+ *
+ * Classes are listed from the most to the least urgent one.
+ */
+enum class DownlinkPriority : std::uint8_t
+{
+    Control = 0, //!< Short responses to telecommands
+    Beacon = 1,  //!< Beacon, only the most recent one is worth sending
+    Bulk = 2,    //!< Large data transfers (files, memory dumps, archived telemetry)
+};
+
+/** @brief Number of downlink priority classes */
+constexpr std::uint8_t DownlinkPriorityCount = 3;
+
 /** Transmitter state enumerator. */
 enum class IdleState
 {
@@ -0,0 +1,68 @@
+#include "ReceivePolling.hpp"
+#include <algorithm>
+#include <limits>
+
+COMM_BEGIN
+
+constexpr std::chrono::milliseconds AdaptiveReceivePolling::FastInterval;
+constexpr std::chrono::milliseconds AdaptiveReceivePolling::MaxInterval;
+constexpr std::chrono::milliseconds AdaptiveReceivePolling::PassWindow;
+constexpr std::array<std::uint16_t, ReceiveLatencyBucketCount - 1> AdaptiveReceivePolling::LatencyBucketLimits;
+
+AdaptiveReceivePolling::AdaptiveReceivePolling()
+    : _interval(static_cast<std::uint16_t>(FastInterval.count())),
+      _lastQuery(std::chrono::milliseconds::zero()),
+      _passEnd(std::chrono::milliseconds::zero())
+{
+    for (auto& bucket : this->_latency)
+    {
+        bucket = 0;
+    }
+}
+
+std::chrono::milliseconds AdaptiveReceivePolling::Interval() const
+{
+    return std::chrono::milliseconds(this->_interval.load());
+}
+
+void AdaptiveReceivePolling::Update(std::chrono::milliseconds now, std::uint16_t framesReceived)
+{
+    if (framesReceived > 0)
+    {
+        RecordLatency(now - this->_lastQuery, framesReceived);
+
+        this->_passEnd = now + PassWindow;
+        this->_interval = static_cast<std::uint16_t>(FastInterval.count());
+    }
+    else if (now >= this->_passEnd)
+    {
+        const auto next = std::min<std::uint32_t>(2u * this->_interval.load(), MaxInterval.count());
+        this->_interval = static_cast<std::uint16_t>(next);
+    }
+
+    this->_lastQuery = now;
+}
+
+void AdaptiveReceivePolling::RecordLatency(std::chrono::milliseconds latency, std::uint16_t frames)
+{
+    const auto limit = std::lower_bound(LatencyBucketLimits.begin(), LatencyBucketLimits.end(), latency.count());
+    auto& bucket = this->_latency[std::distance(LatencyBucketLimits.begin(), limit)];
+
+    const auto count = std::min<std::uint32_t>(bucket.load() + frames, std::numeric_limits<std::uint16_t>::max());
+    bucket = static_cast<std::uint16_t>(count);
+}
+
+ReceivePollingStatistics AdaptiveReceivePolling::Statistics() const
+{
+    ReceivePollingStatistics statistics;
+    statistics.Interval = Interval();
+
+    for (std::size_t i = 0; i < this->_latency.size(); i++)
+    {
+        statistics.Latency[i] = this->_latency[i].load();
+    }
+
+    return statistics;
+}
+
+COMM_END
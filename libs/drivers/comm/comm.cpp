@@ -5,6 +5,7 @@
 */
 #include "comm.hpp"
 #include <stdnoreturn.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
@@ -51,10 +52,15 @@ CommObject::CommObject(error_counter::ErrorCounting& errors, II2CBus& low)
       _pollingTaskHandle(nullptr),                                                 //
       transmitterSemaphore(System::CreateBinarySemaphore(transmitterSemaphoreId)), //
       receiverSemaphore(System::CreateBinarySemaphore(receiverSemaphoreId)),       //
-      _lastFrameStatus{{0, 0}}
+      _lastFrameStatus{{0, 0}},                                                     //
+      _frameBufferInUse(false),                                                    //
+      _lastWatchdogReset(0ms)
 {
 }
 
+constexpr std::chrono::milliseconds CommObject::WatchdogResetPeriod;
+constexpr std::uint8_t CommObject::ReceivePoolCapacity;
+
 /**
  * @brief Enumerator of all flags used for communication with comm task
  * @ingroup LowerCommDriver
@@ -64,7 +70,8 @@ enum TaskFlag
     TaskFlagPauseRequest = 1,
     TaskFlagAck = 2,
     TaskFlagRunning = 4,
-    TaskFlagPing = 8
+    TaskFlagPing = 8,
+    TaskFlagWakeUp = 16
 };
 
 bool CommObject::SendCommand(Address address, uint8_t command, AggregatedErrorCounter& resultAggregator)
@@ -558,14 +565,28 @@ bool CommObject::ScheduleFrameTransmission(
         return false;
     }
 
-    std::uint8_t cmd[PrefferedBufferSize];
-    cmd[0] = num(TransmitterCommand::SendFrame);
-    memcpy(cmd + 1, frame.data(), frame.size());
+    DownlinkFrameBuffer buffer;
+    memcpy(buffer.data() + DownlinkFrameHeadroom, frame.data(), frame.size());
+
+    return ScheduleFrameBufferTransmission(
+        buffer, static_cast<std::uint8_t>(frame.size()), remainingBufferSize, resultAggregator);
+}
+
+bool CommObject::ScheduleFrameBufferTransmission(
+    DownlinkFrameBuffer& buffer, std::uint8_t frameSize, std::uint8_t& remainingBufferSize, AggregatedErrorCounter& resultAggregator)
+{
+    if (frameSize > MaxDownlinkFrameSize)
+    {
+        LOGF(LOG_LEVEL_ERROR, "Frame payload is too long. Allowed: %d, Requested: '%d'.", MaxDownlinkFrameSize, frameSize);
+        return false;
+    }
+
+    buffer[0] = num(TransmitterCommand::SendFrame);
 
-    const bool status = SendBufferWithResponse(Address::Transmitter, //
-        gsl::span<const std::uint8_t>(cmd, 1 + frame.size()),        //
-        gsl::span<std::uint8_t>(&remainingBufferSize, 1),            //
-        resultAggregator                                             //
+    const bool status = SendBufferWithResponse(Address::Transmitter,           //
+        gsl::make_span(buffer).subspan(0, DownlinkFrameHeadroom + frameSize), //
+        gsl::span<std::uint8_t>(&remainingBufferSize, 1),                     //
+        resultAggregator                                                      //
         );
     if (!status)
     {
@@ -604,6 +625,32 @@ bool CommObject::ScheduleFrameTransmission(
     return status && remainingBufferSize != 0xff;
 }
 
+DownlinkFrameBuffer* CommObject::AcquireFrameBuffer()
+{
+    if (this->_frameBufferInUse.exchange(true))
+    {
+        return nullptr;
+    }
+
+    return &this->_frameBuffer;
+}
+
+bool CommObject::SendFrameBuffer(DownlinkFrameBuffer& buffer, std::uint8_t frameSize)
+{
+    std::uint8_t remainingSlots;
+    const auto status = SendFrameInPlace(buffer, frameSize, remainingSlots);
+    ReleaseFrameBuffer(buffer);
+    return status;
+}
+
+void CommObject::ReleaseFrameBuffer(DownlinkFrameBuffer& buffer)
+{
+    if (&buffer == &this->_frameBuffer)
+    {
+        this->_frameBufferInUse = false;
+    }
+}
+
 Option<bool> CommObject::SetBeacon(const Beacon& beaconData)
 {
     ErrorReporter errorContext(_error);
@@ -722,76 +769,143 @@ bool CommObject::ResetWatchdogTransmitter()
 
 bool CommObject::PollHardware()
 {
-    bool anyFrame = false;
+    const bool anyFrame = ReceiveFrames() > 0;
+
+    if (!ResetWatchdogReceiver() && !ResetWatchdogTransmitter())
+    {
+        LOG(LOG_LEVEL_ERROR, "[comm] Unable to reset comm watchdog. ");
+    }
 
+    return anyFrame;
+}
+
+std::uint16_t CommObject::ReceiveFrames()
+{
     auto frameResponse = this->GetFrameCount();
     if (!frameResponse.status)
     {
         LOG(LOG_LEVEL_ERROR, "[comm] Unable to get receiver frame count. ");
+        return 0;
+    }
+
+    if (frameResponse.frameCount == 0)
+    {
+        return 0;
     }
-    else if (frameResponse.frameCount > 0)
+
+    LOGF(LOG_LEVEL_INFO, "[comm] Got %d frames", static_cast<int>(frameResponse.frameCount));
+
+    const auto batchSize = std::min<std::uint16_t>(frameResponse.frameCount, ReceivePoolCapacity);
+    std::uint8_t fetched = 0;
+    for (std::uint16_t i = 0; i < batchSize; i++)
     {
-        anyFrame = true;
-        LOGF(LOG_LEVEL_INFO, "[comm] Got %d frames", static_cast<int>(frameResponse.frameCount));
-        for (decltype(frameResponse.frameCount) i = 0; i < frameResponse.frameCount; i++)
+        if (FetchFrame(this->_receivePool[fetched]))
         {
-            ProcessSingleFrame();
+            fetched++;
         }
     }
 
-    if (!ResetWatchdogReceiver() && !ResetWatchdogTransmitter())
+    auto handler = this->_frameHandler;
+    if (handler != nullptr)
     {
-        LOG(LOG_LEVEL_ERROR, "[comm] Unable to reset comm watchdog. ");
+        for (std::uint8_t i = 0; i < fetched; i++)
+        {
+            handler->HandleFrame(*this, this->_receivePool[i].Descriptor);
+        }
     }
 
-    return anyFrame;
+    return batchSize;
 }
 
-bool CommObject::GetFrame(gsl::span<std::uint8_t> buffer, int retryCount, Frame& frame, AggregatedErrorCounter& resultAggregator)
+void CommObject::ServiceReceiver()
 {
-    for (int i = 0; i < retryCount; ++i)
+    std::uint16_t frames;
+    do
     {
-        const bool status = ReceiveFrameInternal(buffer, frame, resultAggregator);
-        if (!status)
-        {
-            LOG(LOG_LEVEL_ERROR, "[comm] Unable to receive frame. ");
-        }
-        else if (!frame.Verify())
-        {
-            LOGF(LOG_LEVEL_ERROR,
-                "[comm] Received invalid frame. Size: %d, Doppler: 0x%X, RSSI: 0x%X. ",
-                static_cast<int>(frame.FullSize()),
-                static_cast<int>(frame.Doppler()),
-                static_cast<int>(frame.Rssi()));
-        }
-        else
+        frames = ReceiveFrames();
+        this->_receivePolling.Update(System::GetUptime(), frames);
+    } while (frames > 0);
+
+    const auto now = System::GetUptime();
+    if (now - this->_lastWatchdogReset >= WatchdogResetPeriod)
+    {
+        if (!ResetWatchdogReceiver() && !ResetWatchdogTransmitter())
         {
-            return true;
+            LOG(LOG_LEVEL_ERROR, "[comm] Unable to reset comm watchdog. ");
         }
+
+        this->_lastWatchdogReset = now;
+    }
+}
+
+void CommObject::WakeUp()
+{
+    this->_pollingTaskFlags.Set(TaskFlagWakeUp);
+}
+
+void CommObject::WakeUpISR()
+{
+    this->_pollingTaskFlags.SetISR(TaskFlagWakeUp);
+}
+
+ReceivePollingStatistics CommObject::GetReceivePollingStatistics() const
+{
+    return this->_receivePolling.Statistics();
+}
+
+bool CommObject::ReceivePooledFrame(PooledFrame& slot, AggregatedErrorCounter& resultAggregator)
+{
+    const bool status = this->SendCommandWithResponse(Address::Receiver, num(ReceiverCommand::GetFrame), slot.Buffer, resultAggregator);
+    if (!status)
+    {
+        return status;
     }
 
-    return false;
+    Reader reader(slot.Buffer);
+    const auto fullSize = reader.ReadWordLE();
+    const auto doppler = reader.ReadWordLE();
+    const auto rssi = reader.ReadWordLE();
+    const auto size = std::min<std::size_t>(fullSize, reader.RemainingSize());
+
+    auto contents = gsl::make_span(slot.Buffer).subspan(slot.Buffer.size() - reader.RemainingSize(), size);
+    this->_lastFrameStatus = {doppler, rssi};
+
+    slot.Descriptor = Frame(doppler, rssi, fullSize, contents);
+    return status;
 }
 
-void CommObject::ProcessSingleFrame()
+bool CommObject::FetchFrame(PooledFrame& slot)
 {
     ErrorReporter errorContext(_error);
 
-    Frame frame;
-    std::uint8_t buffer[PrefferedBufferSize];
-    const bool status = GetFrame(buffer, 3, frame, errorContext.Counter());
-    if (status && frame.Verify())
+    bool status = false;
+    for (int i = 0; i < 3 && !status; ++i)
     {
-        LOGF(LOG_LEVEL_INFO, "[comm] Received frame %d bytes. ", static_cast<int>(frame.Size()));
-        auto handler = this->_frameHandler;
-        if (handler != nullptr)
-            handler->HandleFrame(*this, frame);
+        if (!ReceivePooledFrame(slot, errorContext.Counter()))
+        {
+            LOG(LOG_LEVEL_ERROR, "[comm] Unable to receive frame. ");
+        }
+        else if (!slot.Descriptor.Verify())
+        {
+            LOGF(LOG_LEVEL_ERROR,
+                "[comm] Received invalid frame. Size: %d, Doppler: 0x%X, RSSI: 0x%X. ",
+                static_cast<int>(slot.Descriptor.FullSize()),
+                static_cast<int>(slot.Descriptor.Doppler()),
+                static_cast<int>(slot.Descriptor.Rssi()));
+        }
+        else
+        {
+            LOGF(LOG_LEVEL_INFO, "[comm] Received frame %d bytes. ", static_cast<int>(slot.Descriptor.Size()));
+            status = true;
+        }
     }
 
     if (!this->RemoveFrameInternal(errorContext.Counter()))
     {
         LOG(LOG_LEVEL_ERROR, "[comm] Unable to remove frame from receiver. ");
     }
+
+    return status;
 }
 
 void CommObject::WaitForComLoop()
@@ -806,12 +920,14 @@ void CommObject::CommTask(void* param)
     comm->_pollingTaskFlags.Set(TaskFlagRunning);
 
     comm->PollHardware();
+    comm->_lastWatchdogReset = System::GetUptime();
 
     for (;;)
     {
         comm->_pollingTaskFlags.Set(TaskFlagPing);
-        const OSEventBits result = comm->_pollingTaskFlags.WaitAny(TaskFlagPauseRequest, true, 1s);
-        if (result == TaskFlagPauseRequest)
+        const OSEventBits result =
+            comm->_pollingTaskFlags.WaitAny(TaskFlagPauseRequest | TaskFlagWakeUp, true, comm->_receivePolling.Interval());
+        if ((result & TaskFlagPauseRequest) != 0)
         {
             LOG(LOG_LEVEL_WARNING, "Comm task paused");
             comm->_pollingTaskFlags.Clear(TaskFlagRunning);
@@ -821,9 +937,7 @@ void CommObject::CommTask(void* param)
         }
         else
         {
-            while (comm->PollHardware())
-            {
-            }
+            comm->ServiceReceiver();
         }
     }
 }
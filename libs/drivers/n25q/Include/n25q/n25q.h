@@ -427,6 +427,46 @@ namespace devices
                 gsl::span<uint8_t> redundantBuffer1,
                 gsl::span<uint8_t> redundantBuffer2);
 
+            /**
+             * @brief Reads data protected by checksum from memory starting from given address.
+             * @param[in] address Start address
+             * @param[out] outputBuffer Output buffer
+             * @param[out] redundantBuffer1 First buffer used for redundant read
+             * @param[out] redundantBuffer2 Second buffer used for redundant read
+             * @retval OSResult::Success Valid copy of data has been read
+             * @retval OSResult::InvalidMessage None of the copies matched the checksum, outputBuffer holds voted data
+             * @return Operation result
+             *
+             * Data must have been written with checksum appended by @ref AppendChecksum, so last @ref ChecksumSize
+             * bytes of each buffer hold checksum of preceding data. All buffers should have the same length. If not,
+             * the length of shortest buffer will be used as data size.
+             *
+             * Only first chip is read if its data match the checksum (or are erased). Otherwise second and third chip
+             * are read in turn and first valid copy is placed in outputBuffer. If none of the copies is valid, bitwise
+             * triple modular redundancy is performed using data from all 3 drivers and the read is reported as failed,
+             * because voted data cannot be verified.
+             */
+            OSResult ReadMemoryWithChecksum(std::size_t address,
+                gsl::span<uint8_t> outputBuffer,
+                gsl::span<uint8_t> redundantBuffer1,
+                gsl::span<uint8_t> redundantBuffer2);
+
+            /**
+             * @brief Stores checksum of data in last @ref ChecksumSize bytes of buffer
+             * @param[in,out] buffer Data followed by space for checksum
+             */
+            static void AppendChecksum(gsl::span<uint8_t> buffer);
+
+            /**
+             * @brief Checks whether data match checksum stored in last @ref ChecksumSize bytes of buffer
+             * @param[in] buffer Data followed by checksum
+             * @return true if checksum matches or whole buffer is erased
+             */
+            static bool VerifyChecksum(gsl::span<const uint8_t> buffer);
+
+            /** @brief Size of checksum (CRC16) */
+            static constexpr std::size_t ChecksumSize = 2;
+
             /**
              * @brief Erases all 3 chips.
              * @return Operation result
@@ -466,7 +506,9 @@ namespace devices
              * In case of failure in one of them, subsequent writes are aborted and memory is left partially written
              *
              * Operation can take up to 5ms per page.
-             * The operation is performed in parallel on 3 chips.
+             * The operation is performed in parallel on 3 chips. Writes are pipelined: next page is sent to chip as soon as
+             * that chip finishes previous one, so one chip is programming while the others receive data. As a consequence,
+             * when page fails, first chips may have already started programming the next page.
              */
             OperationResult WriteMemory(size_t address, gsl::span<const uint8_t> buffer);
 
@@ -0,0 +1,221 @@
+#ifndef LIBS_DRIVERS_N25Q_INCLUDE_N25Q_SIMULATED_H_
+#define LIBS_DRIVERS_N25Q_INCLUDE_N25Q_SIMULATED_H_
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <gsl/span>
+#include "n25q.h"
+#include "utils.h"
+
+namespace devices
+{
+    namespace n25q
+    {
+        /**
+         * @defgroup n25q_simulated Simulated N25Q flash memory
+         * @ingroup n25q
+         *
+         * Host-only N25Q chip kept in memory, used to run file system stack without hardware
+         *
+         * @{
+         */
+
+        /**
+         * @brief Timing of simulated N25Q chip
+         */
+        struct SimulatedN25QTiming
+        {
+            /** @brief SPI clock frequency in Hz */
+            std::uint32_t SPIClock;
+            /** @brief Page program time */
+            std::chrono::microseconds PageProgram;
+            /** @brief Subsector (4KB) erase time */
+            std::chrono::microseconds SubSectorErase;
+            /** @brief Sector (64KB) erase time */
+            std::chrono::microseconds SectorErase;
+            /** @brief Chip erase time */
+            std::chrono::microseconds ChipErase;
+        };
+
+        /** @brief Typical N25Q128 timing (datasheet) with SPI clock used on OBC */
+        constexpr SimulatedN25QTiming TypicalN25QTiming{
+            20_MHz, std::chrono::microseconds(500), std::chrono::milliseconds(250), std::chrono::milliseconds(700), std::chrono::seconds(170)};
+
+        /**
+         * @brief Simulated time shared by chips connected to the same SPI bus
+         *
+         * SPI transfers to any chip advance time. Program and erase operations run in background in each chip
+         * so busy periods of different chips may overlap.
+         */
+        struct SimulatedClock
+        {
+            /** @brief Time elapsed since beginning of simulation */
+            std::chrono::nanoseconds Now{0};
+        };
+
+        /**
+         * @brief Operation counters of simulated N25Q chip
+         */
+        struct SimulatedN25QCounters
+        {
+            /** @brief Number of bytes read */
+            std::uint64_t BytesRead;
+            /** @brief Number of page program operations */
+            std::uint32_t PagePrograms;
+            /** @brief Number of bytes programmed */
+            std::uint64_t BytesProgrammed;
+            /** @brief Number of bytes that were programmed with bits that were not erased */
+            std::uint32_t ProgramViolations;
+            /** @brief Number of subsector erase operations */
+            std::uint32_t SubSectorErases;
+            /** @brief Number of sector erase operations */
+            std::uint32_t SectorErases;
+            /** @brief Number of chip erase operations */
+            std::uint32_t ChipErases;
+            /** @brief Time spent by chip on program and erase operations */
+            std::chrono::nanoseconds BusyTime;
+            /** @brief Time spent waiting for program or erase operation to finish */
+            std::chrono::nanoseconds WaitTime;
+        };
+
+        /**
+         * @brief N25Q chip simulated in host memory (or memory-mapped file)
+         *
+         * Memory behaves as NOR flash: page program only clears bits and wraps around page boundary, erase sets
+         * whole subsector/sector to 0xFF. Operations take no host time, instead they advance @ref SimulatedClock:
+         * SPI transfers immediately and program/erase operations when their result is awaited or when next
+         * command is issued to busy chip. Erase count of each subsector is tracked to measure wear.
+         */
+        class SimulatedN25QDriver final : public IN25QDriver, private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Constructs chip kept in host memory
+             * @param[in] clock Simulated time
+             * @param[in] timing Chip timing
+             * @param[in] size Memory size
+             */
+            SimulatedN25QDriver(SimulatedClock& clock, const SimulatedN25QTiming& timing = TypicalN25QTiming, std::size_t size = 16_MB);
+
+            /**
+             * @brief Constructs chip kept in memory-mapped file, so its contents are preserved between runs
+             * @param[in] clock Simulated time
+             * @param[in] path Path to image file, created (erased) if it does not exist
+             * @param[in] timing Chip timing
+             * @param[in] size Memory size
+             */
+            SimulatedN25QDriver(
+                SimulatedClock& clock, const char* path, const SimulatedN25QTiming& timing = TypicalN25QTiming, std::size_t size = 16_MB);
+
+            /** @brief Unmaps image file */
+            ~SimulatedN25QDriver();
+
+            virtual OSResult ReadMemory(std::size_t address, gsl::span<uint8_t> buffer) override;
+            virtual OperationWaiter BeginWritePage(size_t address, ptrdiff_t offset, gsl::span<const uint8_t> page) override;
+            virtual OperationWaiter BeginEraseSubSector(size_t address) override;
+            virtual OperationWaiter BeginEraseSector(size_t address) override;
+            virtual OperationWaiter BeginEraseChip() override;
+            virtual OperationResult Reset() override;
+
+            /**
+             * @brief Advances simulated time until pending operation finishes
+             * @param[in] timeout Ignored, simulated operations always finish
+             * @param[in] status Ignored
+             * @return Always @ref OperationResult::Success
+             */
+            virtual OperationResult WaitForOperation(std::chrono::milliseconds timeout, FlagStatus status) override;
+
+            /**
+             * @brief Returns memory contents
+             * @return Memory contents
+             */
+            inline gsl::span<const std::uint8_t> Memory() const;
+
+            /**
+             * @brief Returns operation counters
+             * @return Operation counters
+             */
+            inline const SimulatedN25QCounters& Counters() const;
+
+            /**
+             * @brief Clears operation counters (erase counts of subsectors are preserved)
+             */
+            void ResetCounters();
+
+            /**
+             * @brief Returns number of times subsector was erased
+             * @param[in] address Address within subsector
+             * @return Erase count
+             */
+            std::uint32_t EraseCount(std::size_t address) const;
+
+            /**
+             * @brief Returns highest erase count of all subsectors
+             * @return Erase count
+             */
+            std::uint32_t MaxEraseCount() const;
+
+            /** @brief Page size */
+            static constexpr std::size_t PageSize = 256;
+
+            /** @brief Subsector size */
+            static constexpr std::size_t SubSectorSize = 4_KB;
+
+            /** @brief Sector size */
+            static constexpr std::size_t SectorSize = 64_KB;
+
+          private:
+            /**
+             * @brief Advances time until pending operation finishes
+             */
+            void WaitIdle();
+
+            /**
+             * @brief Advances time by SPI transfer of given number of bytes, waits if chip is busy
+             * @param[in] bytes Number of bytes transferred (including command and address)
+             */
+            void Transfer(std::size_t bytes);
+
+            /**
+             * @brief Erases memory and starts background operation
+             * @param[in] address Address within erased area
+             * @param[in] size Size of erased area
+             * @param[in] duration Operation time
+             * @return Operation waiter
+             */
+            OperationWaiter Erase(std::size_t address, std::size_t size, std::chrono::microseconds duration);
+
+            /** @brief Simulated time */
+            SimulatedClock& _clock;
+            /** @brief Timing */
+            const SimulatedN25QTiming _timing;
+            /** @brief Memory kept in host memory */
+            std::vector<std::uint8_t> _ram;
+            /** @brief Memory contents */
+            gsl::span<std::uint8_t> _memory;
+            /** @brief Image file descriptor, -1 if memory is kept in host memory */
+            int _file;
+            /** @brief Time when pending operation finishes */
+            std::chrono::nanoseconds _busyUntil;
+            /** @brief Erase count of each subsector */
+            std::vector<std::uint32_t> _eraseCounts;
+            /** @brief Operation counters */
+            SimulatedN25QCounters _counters;
+        };
+
+        gsl::span<const std::uint8_t> SimulatedN25QDriver::Memory() const
+        {
+            return this->_memory;
+        }
+
+        const SimulatedN25QCounters& SimulatedN25QDriver::Counters() const
+        {
+            return this->_counters;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_DRIVERS_N25Q_INCLUDE_N25Q_SIMULATED_H_ */
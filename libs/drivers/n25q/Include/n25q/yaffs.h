@@ -1,6 +1,7 @@
 #ifndef LIBS_DRIVERS_N25Q_INCLUDE_N25Q_YAFFS_H_
 #define LIBS_DRIVERS_N25Q_INCLUDE_N25Q_YAFFS_H_
 
+#include <algorithm>
 #include "base/os.h"
 #include "fs/yaffs.h"
 #include "logger/logger.h"
@@ -30,6 +31,44 @@ namespace devices
             Sector     //!< Sector
         };
 
+        /**
+         * @brief Verification of chunks read from redundant memories
+         */
+        enum class ChunkVerification
+        {
+            Voting,  //!< Copies from two chips are compared, third chip is read on mismatch
+            Checksum //!< Each chunk ends with checksum, other chips are read only if copy from first chip is corrupted
+        };
+
+        /**
+         * @brief Yaffs device options trading RAM for flash wear and mount time
+         */
+        struct YaffsDeviceOptions
+        {
+            /**
+             * @brief Number of short-op cache entries, 0 disables cache
+             *
+             * Each entry takes single chunk of heap memory and buffers partial chunk writes so consecutive small
+             * writes to the same file result in single chunk program instead of one program per write.
+             */
+            std::uint8_t ShortOpCaches;
+
+            /**
+             * @brief Enables checkpoint
+             *
+             * Checkpoint (saved on sync) allows mounting device without scanning all blocks.
+             */
+            bool Checkpoints;
+
+            /**
+             * @brief Verification of read chunks
+             *
+             * @ref ChunkVerification::Checksum halves amount of data read from memories, but takes part of each chunk
+             * so memory has to be formatted when switching between modes.
+             */
+            ChunkVerification Verification;
+        };
+
         /**
          * @brief Yaffs driver for N25Q flash memory
          * @tparam blockMapping Block mapping
@@ -43,8 +82,9 @@ namespace devices
              * @brief Constructs @ref N25QYaffsDevice instance
              * @param[in] mountPoint Mount point (absolute path)
              * @param[in] driver N25Q driver to use
+             * @param[in] options Device options
              */
-            N25QYaffsDevice(const char* mountPoint, RedundantN25QDriver& driver);
+            N25QYaffsDevice(const char* mountPoint, RedundantN25QDriver& driver, const YaffsDeviceOptions& options);
 
             /**
              * @brief Mounts device
@@ -128,6 +168,10 @@ namespace devices
             RedundantN25QDriver& _driver;
             /** @brief Block mapping */
             const BlockMapping _blockMapping;
+            /** @brief Verification of read chunks */
+            const ChunkVerification _verification;
+            /** @brief Buffer for chunk with checksum */
+            alignas(4) std::array<std::uint8_t, ChunkSize> _chunkBuffer;
             /** @brief First buffer for redundant reads */
             alignas(4) std::array<std::uint8_t, ChunkSize> _redundantReadBuffer1;
             /** @brief Second buffer for redundant reads */
@@ -150,9 +194,11 @@ namespace devices
         };
 
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
-        N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::N25QYaffsDevice(const char* mountPoint, RedundantN25QDriver& driver)
-            : _driver(driver), //
-              _blockMapping(blockMapping)
+        N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::N25QYaffsDevice(
+            const char* mountPoint, RedundantN25QDriver& driver, const YaffsDeviceOptions& options)
+            : _driver(driver),             //
+              _blockMapping(blockMapping), //
+              _verification(options.Verification)
         {
             memset(&this->_device, 0, sizeof(this->_device));
 
@@ -161,13 +207,21 @@ namespace devices
             this->_device.param.inband_tags = true;
             this->_device.param.is_yaffs2 = true;
             this->_device.param.total_bytes_per_chunk = ChunkSize;
-            this->_device.param.chunks_per_block = BlockSize<blockMapping>::value / this->_device.param.total_bytes_per_chunk;
+            if (this->_verification == ChunkVerification::Checksum)
+            {
+                this->_device.param.total_bytes_per_chunk -= RedundantN25QDriver::ChecksumSize;
+            }
+
+            this->_device.param.chunks_per_block = BlockSize<blockMapping>::value / ChunkSize;
             this->_device.param.spare_bytes_per_chunk = 0;
             this->_device.param.start_block = 1;
             this->_device.param.n_reserved_blocks = 3;
             this->_device.param.no_tags_ecc = true;
             this->_device.param.always_check_erased = true;
             this->_device.param.disable_bad_block_marking = true;
+            this->_device.param.n_caches = options.ShortOpCaches;
+            this->_device.param.skip_checkpt_rd = !options.Checkpoints;
+            this->_device.param.skip_checkpt_wr = !options.Checkpoints;
 
             this->_device.driver_context = this;
             this->_device.drv.drv_read_chunk_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::ReadChunk;
@@ -176,10 +230,8 @@ namespace devices
             this->_device.drv.drv_mark_bad_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::MarkBadBlock;
             this->_device.drv.drv_check_bad_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::CheckBadBlock;
 
-            auto blockSize = this->_device.param.chunks_per_block * this->_device.param.total_bytes_per_chunk;
-
-            this->_device.param.end_block = TotalSize / blockSize //
-                - this->_device.param.start_block                 //
+            this->_device.param.end_block = TotalSize / BlockSize<blockMapping>::value //
+                - this->_device.param.start_block                                      //
                 - this->_device.param.n_reserved_blocks;
         }
 
@@ -232,13 +284,39 @@ namespace devices
 
             *ecc_result = yaffs_ecc_result::YAFFS_ECC_RESULT_NO_ERROR;
 
-            auto baseAddress = nand_chunk * dev->param.total_bytes_per_chunk;
+            auto baseAddress = nand_chunk * ChunkSize;
+
+            if (This->_verification == ChunkVerification::Checksum)
+            {
+                const auto result = This->_driver.ReadMemoryWithChecksum(
+                    baseAddress, This->_chunkBuffer, This->_redundantReadBuffer1, This->_redundantReadBuffer2);
+
+                if (result == OSResult::InvalidMessage)
+                {
+                    // voted data is still passed to yaffs, but the chunk is reported as unrecoverable
+                    LOGF(LOG_LEVEL_ERROR, "[Device %s] Chunk %d does not match checksum", dev->param.name, nand_chunk);
+                    *ecc_result = yaffs_ecc_result::YAFFS_ECC_RESULT_UNFIXED;
+                    std::copy_n(This->_chunkBuffer.begin(), data_len, data);
+                    return YAFFS_FAIL;
+                }
+
+                if (OS_RESULT_FAILED(result))
+                {
+                    return YAFFS_FAIL;
+                }
+
+                std::copy_n(This->_chunkBuffer.begin(), data_len, data);
+                return YAFFS_OK;
+            }
 
             gsl::span<uint8_t> outputBuffer(data, data_len);
             gsl::span<uint8_t> redundantBuffer1(This->_redundantReadBuffer1.data(), data_len);
             gsl::span<uint8_t> redundantBuffer2(This->_redundantReadBuffer2.data(), data_len);
 
-            This->_driver.ReadMemory(baseAddress, outputBuffer, redundantBuffer1, redundantBuffer2);
+            if (OS_RESULT_FAILED(This->_driver.ReadMemory(baseAddress, outputBuffer, redundantBuffer1, redundantBuffer2)))
+            {
+                return YAFFS_FAIL;
+            }
 
             return YAFFS_OK;
         }
@@ -261,10 +339,25 @@ namespace devices
 
             auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
 
-            auto baseAddress = nand_chunk * dev->param.total_bytes_per_chunk;
+            auto baseAddress = nand_chunk * ChunkSize;
 
             gsl::span<const uint8_t> buffer(data, data_len);
 
+            if (This->_verification == ChunkVerification::Checksum)
+            {
+                if (static_cast<u32>(data_len) > dev->param.total_bytes_per_chunk)
+                {
+                    LOGF(LOG_LEVEL_ERROR, "Trying to write to large page: %d bytes", data_len);
+                    return YAFFS_FAIL;
+                }
+
+                auto end = std::copy_n(data, data_len, This->_chunkBuffer.begin());
+                std::fill(end, This->_chunkBuffer.end() - RedundantN25QDriver::ChecksumSize, 0xFF);
+                RedundantN25QDriver::AppendChecksum(This->_chunkBuffer);
+
+                buffer = This->_chunkBuffer;
+            }
+
             auto result = This->_driver.WriteMemory(baseAddress, buffer);
 
             if (result != OperationResult::Success)
@@ -283,7 +376,7 @@ namespace devices
 
             LOGF(LOG_LEVEL_INFO, "[Device %s] Erasing block %d", dev->param.name, block_no);
 
-            auto baseAddress = block_no * dev->param.chunks_per_block * dev->param.total_bytes_per_chunk;
+            auto baseAddress = block_no * BlockSize<blockMapping>::value;
 
             auto result = OperationResult::Failure;
 
@@ -2,6 +2,7 @@
 #include <array>
 #include <cstring>
 
+#include "base/crc.h"
 #include "base/os.h"
 
 #include "n25q.h"
@@ -12,9 +13,22 @@ using std::ptrdiff_t;
 using gsl::span;
 
 using namespace devices::n25q;
+
+constexpr std::size_t RedundantN25QDriver::ChecksumSize;
 using redundancy::Vote;
 using redundancy::CorrectBuffer;
 
+/**
+ * @brief Votes on results of the same operation performed on all 3 chips
+ * @param[in] results Results of operation
+ * @return Voted result, @ref OperationResult::Failure if there is no majority
+ */
+static OperationResult VoteResults(const std::array<OperationResult, 3>& results)
+{
+    auto votedResult = Vote(results[0], results[1], results[2]);
+    return votedResult.HasValue ? votedResult.Value : OperationResult::Failure;
+}
+
 RedundantN25QDriver::RedundantN25QDriver(         //
     error_counter::IErrorCounting& errorCounting, //
     std::array<IN25QDriver*, 3> n25qDrivers)
@@ -71,6 +85,85 @@ OSResult RedundantN25QDriver::ReadMemory( //
     return OSResult::Success;
 }
 
+OSResult RedundantN25QDriver::ReadMemoryWithChecksum( //
+    std::size_t address,                              //
+    gsl::span<uint8_t> outputBuffer,                  //
+    gsl::span<uint8_t> redundantBuffer1,              //
+    gsl::span<uint8_t> redundantBuffer2)
+{
+    auto bufferLength = std::min(outputBuffer.length(), std::min(redundantBuffer1.length(), redundantBuffer2.length()));
+
+    auto normalizedOutputBuffer = outputBuffer.subspan(0, bufferLength);
+
+    auto r = _n25qDrivers[0]->ReadMemory(address, normalizedOutputBuffer);
+
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    if (VerifyChecksum(normalizedOutputBuffer))
+    {
+        _error.Success();
+        return OSResult::Success;
+    }
+
+    _error.Failure();
+
+    auto normalizedRedundantBuffer1 = redundantBuffer1.subspan(0, bufferLength);
+    auto normalizedRedundantBuffer2 = redundantBuffer2.subspan(0, bufferLength);
+
+    r = _n25qDrivers[1]->ReadMemory(address, normalizedRedundantBuffer1);
+
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    if (VerifyChecksum(normalizedRedundantBuffer1))
+    {
+        std::copy(normalizedRedundantBuffer1.begin(), normalizedRedundantBuffer1.end(), normalizedOutputBuffer.begin());
+        return OSResult::Success;
+    }
+
+    r = _n25qDrivers[2]->ReadMemory(address, normalizedRedundantBuffer2);
+
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    if (VerifyChecksum(normalizedRedundantBuffer2))
+    {
+        std::copy(normalizedRedundantBuffer2.begin(), normalizedRedundantBuffer2.end(), normalizedOutputBuffer.begin());
+        return OSResult::Success;
+    }
+
+    CorrectBuffer(normalizedOutputBuffer, normalizedRedundantBuffer1, normalizedRedundantBuffer2);
+
+    return OSResult::InvalidMessage;
+}
+
+void RedundantN25QDriver::AppendChecksum(gsl::span<uint8_t> buffer)
+{
+    auto crc = CRC_calc(buffer.subspan(0, buffer.size() - ChecksumSize));
+
+    buffer[buffer.size() - 2] = crc & 0xFF;
+    buffer[buffer.size() - 1] = crc >> 8;
+}
+
+bool RedundantN25QDriver::VerifyChecksum(gsl::span<const uint8_t> buffer)
+{
+    auto crc = CRC_calc(buffer.subspan(0, buffer.size() - ChecksumSize));
+
+    if (buffer[buffer.size() - 2] == (crc & 0xFF) && buffer[buffer.size() - 1] == (crc >> 8))
+    {
+        return true;
+    }
+
+    return std::all_of(buffer.begin(), buffer.end(), [](uint8_t value) { return value == 0xFF; });
+}
+
 OperationResult RedundantN25QDriver::EraseChip()
 {
     auto d1Wait = _n25qDrivers[0]->BeginEraseChip();
@@ -139,32 +232,57 @@ OperationResult RedundantN25QDriver::EraseSector(size_t address)
 
 OperationResult RedundantN25QDriver::WriteMemory(size_t address, gsl::span<const uint8_t> buffer)
 {
-    for (ptrdiff_t offset = 0; offset < buffer.size(); offset += N25QDriver::PageSize)
+    if (buffer.empty())
     {
-        auto page = buffer.subspan(offset, min(N25QDriver::PageSize, buffer.size() - offset));
+        _error.Success();
+        return OperationResult::Success;
+    }
 
-        auto d1Waiter = _n25qDrivers[0]->BeginWritePage(address, offset, page);
-        auto d2Waiter = _n25qDrivers[1]->BeginWritePage(address, offset, page);
-        auto d3Waiter = _n25qDrivers[2]->BeginWritePage(address, offset, page);
+    std::array<OperationWaiter, 3> waiters{{
+        OperationWaiter(nullptr, std::chrono::milliseconds(0), FlagStatus::ProgramError), //
+        OperationWaiter(nullptr, std::chrono::milliseconds(0), FlagStatus::ProgramError), //
+        OperationWaiter(nullptr, std::chrono::milliseconds(0), FlagStatus::ProgramError)  //
+    }};
+    std::array<OperationResult, 3> results{};
 
-        auto d1Result = d1Waiter.Wait();
-        auto d2Result = d2Waiter.Wait();
-        auto d3Result = d3Waiter.Wait();
+    for (ptrdiff_t offset = 0; offset < buffer.size(); offset += N25QDriver::PageSize)
+    {
+        auto page = buffer.subspan(offset, min(N25QDriver::PageSize, buffer.size() - offset));
 
-        auto votedResult = Vote(d1Result, d2Result, d3Result);
-        if (!votedResult.HasValue)
+        // Each chip waits only for its own previous page, so it programs while next chips receive their data
+        for (std::size_t i = 0; i < waiters.size(); i++)
         {
-            _error.Failure();
-            return OperationResult::Failure;
+            if (offset > 0)
+            {
+                results[i] = waiters[i].Wait();
+            }
+
+            waiters[i] = _n25qDrivers[i]->BeginWritePage(address, offset, page);
         }
 
-        if (votedResult.Value != OperationResult::Success)
+        if (offset > 0)
         {
-            _error.Failure();
-            return votedResult.Value;
+            auto votedResult = VoteResults(results);
+            if (votedResult != OperationResult::Success)
+            {
+                _error.Failure();
+                return votedResult;
+            }
         }
     }
 
+    for (std::size_t i = 0; i < waiters.size(); i++)
+    {
+        results[i] = waiters[i].Wait();
+    }
+
+    auto votedResult = VoteResults(results);
+    if (votedResult != OperationResult::Success)
+    {
+        _error.Failure();
+        return votedResult;
+    }
+
     _error.Success();
     return OperationResult::Success;
 }
@@ -0,0 +1,212 @@
+#include "simulated.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include "logger/logger.h"
+
+using std::uint8_t;
+using std::uint32_t;
+using gsl::span;
+using namespace devices::n25q;
+using namespace std::chrono_literals;
+
+constexpr std::size_t SimulatedN25QDriver::PageSize;
+constexpr std::size_t SimulatedN25QDriver::SubSectorSize;
+constexpr std::size_t SimulatedN25QDriver::SectorSize;
+
+SimulatedN25QDriver::SimulatedN25QDriver(SimulatedClock& clock, const SimulatedN25QTiming& timing, std::size_t size)
+    : _clock(clock),                         //
+      _timing(timing),                       //
+      _ram(size, 0xFF),                      //
+      _memory(_ram),                         //
+      _file(-1),                             //
+      _busyUntil(0),                         //
+      _eraseCounts(size / SubSectorSize, 0), //
+      _counters{}                            //
+{
+}
+
+SimulatedN25QDriver::SimulatedN25QDriver(SimulatedClock& clock, const char* path, const SimulatedN25QTiming& timing, std::size_t size)
+    : _clock(clock),                         //
+      _timing(timing),                       //
+      _file(-1),                             //
+      _busyUntil(0),                         //
+      _eraseCounts(size / SubSectorSize, 0), //
+      _counters{}                            //
+{
+    auto file = open(path, O_RDWR | O_CREAT, 0644);
+    struct stat fileStat;
+
+    if (file < 0 || fstat(file, &fileStat) != 0)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[Simulated N25Q] Unable to open %s, using memory", path);
+        this->_ram.assign(size, 0xFF);
+        this->_memory = this->_ram;
+        return;
+    }
+
+    auto created = static_cast<std::size_t>(fileStat.st_size) != size;
+    if (created && ftruncate(file, size) != 0)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[Simulated N25Q] Unable to resize %s, using memory", path);
+        close(file);
+        this->_ram.assign(size, 0xFF);
+        this->_memory = this->_ram;
+        return;
+    }
+
+    auto mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (mapping == MAP_FAILED)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[Simulated N25Q] Unable to map %s, using memory", path);
+        close(file);
+        this->_ram.assign(size, 0xFF);
+        this->_memory = this->_ram;
+        return;
+    }
+
+    this->_file = file;
+    this->_memory = span<uint8_t>(static_cast<uint8_t*>(mapping), size);
+
+    if (created)
+    {
+        std::fill(this->_memory.begin(), this->_memory.end(), 0xFF);
+    }
+}
+
+SimulatedN25QDriver::~SimulatedN25QDriver()
+{
+    if (this->_file >= 0)
+    {
+        munmap(this->_memory.data(), this->_memory.size());
+        close(this->_file);
+    }
+}
+
+OSResult SimulatedN25QDriver::ReadMemory(std::size_t address, span<uint8_t> buffer)
+{
+    this->Transfer(4 + buffer.size());
+
+    auto source = this->_memory.subspan(address, buffer.size());
+    std::copy(source.begin(), source.end(), buffer.begin());
+
+    this->_counters.BytesRead += buffer.size();
+    return OSResult::Success;
+}
+
+OperationWaiter SimulatedN25QDriver::BeginWritePage(size_t address, ptrdiff_t offset, span<const uint8_t> page)
+{
+    this->Transfer(1);
+    this->Transfer(4 + page.size());
+
+    auto start = address + offset;
+    auto pageBase = start - start % PageSize;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(page.size()); i++)
+    {
+        auto& cell = this->_memory[pageBase + (start + i) % PageSize];
+        if ((page[i] & ~cell) != 0)
+        {
+            this->_counters.ProgramViolations++;
+        }
+
+        cell &= page[i];
+    }
+
+    this->_counters.PagePrograms++;
+    this->_counters.BytesProgrammed += page.size();
+    this->_counters.BusyTime += this->_timing.PageProgram;
+    this->_busyUntil = this->_clock.Now + this->_timing.PageProgram;
+
+    return OperationWaiter(this, 0ms, FlagStatus::ProgramError);
+}
+
+OperationWaiter SimulatedN25QDriver::BeginEraseSubSector(size_t address)
+{
+    this->_counters.SubSectorErases++;
+    return this->Erase(address, SubSectorSize, this->_timing.SubSectorErase);
+}
+
+OperationWaiter SimulatedN25QDriver::BeginEraseSector(size_t address)
+{
+    this->_counters.SectorErases++;
+    return this->Erase(address, SectorSize, this->_timing.SectorErase);
+}
+
+OperationWaiter SimulatedN25QDriver::BeginEraseChip()
+{
+    this->_counters.ChipErases++;
+    return this->Erase(0, this->_memory.size(), this->_timing.ChipErase);
+}
+
+OperationResult SimulatedN25QDriver::Reset()
+{
+    this->_busyUntil = this->_clock.Now;
+
+    this->Transfer(1);
+    this->Transfer(1);
+
+    return OperationResult::Success;
+}
+
+OperationResult SimulatedN25QDriver::WaitForOperation(std::chrono::milliseconds timeout, FlagStatus status)
+{
+    UNUSED(timeout, status);
+
+    this->WaitIdle();
+    this->Transfer(2);
+
+    return OperationResult::Success;
+}
+
+void SimulatedN25QDriver::ResetCounters()
+{
+    this->_counters = SimulatedN25QCounters{};
+}
+
+uint32_t SimulatedN25QDriver::EraseCount(std::size_t address) const
+{
+    return this->_eraseCounts[address / SubSectorSize];
+}
+
+uint32_t SimulatedN25QDriver::MaxEraseCount() const
+{
+    return *std::max_element(this->_eraseCounts.begin(), this->_eraseCounts.end());
+}
+
+void SimulatedN25QDriver::WaitIdle()
+{
+    if (this->_clock.Now < this->_busyUntil)
+    {
+        this->_counters.WaitTime += this->_busyUntil - this->_clock.Now;
+        this->_clock.Now = this->_busyUntil;
+    }
+}
+
+void SimulatedN25QDriver::Transfer(std::size_t bytes)
+{
+    this->WaitIdle();
+    this->_clock.Now += std::chrono::nanoseconds(bytes * 8 * 1000000000ULL / this->_timing.SPIClock);
+}
+
+OperationWaiter SimulatedN25QDriver::Erase(std::size_t address, std::size_t size, std::chrono::microseconds duration)
+{
+    this->Transfer(1);
+    this->Transfer(4);
+
+    address -= address % size;
+    auto area = this->_memory.subspan(address, size);
+    std::fill(area.begin(), area.end(), 0xFF);
+
+    for (auto i = address / SubSectorSize; i < (address + size) / SubSectorSize; i++)
+    {
+        this->_eraseCounts[i]++;
+    }
+
+    this->_counters.BusyTime += duration;
+    this->_busyUntil = this->_clock.Now + duration;
+
+    return OperationWaiter(this, 0ms, FlagStatus::EraseError);
+}
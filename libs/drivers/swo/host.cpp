@@ -0,0 +1,27 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include "swo.h"
+
+// Host builds have no SWO, output is redirected to standard error stream
+
+void SwoEnable(void)
+{
+}
+
+void SwoPutsOnChannel(uint8_t /*channel*/, const char* str)
+{
+    fputs(str, stderr);
+}
+
+void SwoPrintfOnChannel(uint8_t channel, const char* format, ...)
+{
+    va_list arguments;
+    va_start(arguments, format);
+    SwoVPrintfOnChannel(channel, format, arguments);
+    va_end(arguments);
+}
+
+void SwoVPrintfOnChannel(uint8_t /*channel*/, const char* format, va_list arguments)
+{
+    vfprintf(stderr, format, arguments);
+}
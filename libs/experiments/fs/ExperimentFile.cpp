@@ -19,7 +19,7 @@ ExperimentFile::~ExperimentFile()
     }
 }
 
-ExperimentFile::ExperimentFile(ExperimentFile&& other)
+ExperimentFile::ExperimentFile(ExperimentFile&& other) noexcept
     : _buffer(other._buffer), _time(other._time), _writer(_buffer), _hasPayloadInFrame(other._hasPayloadInFrame),
       onFlush(OnFlushDelegate::make_delegate<ExperimentFile, &ExperimentFile::DoNothing>(this))
 {
@@ -72,6 +72,37 @@ namespace services
         /** @brief Read/Write operation result */
         using IOResult = IOOperationResult<gsl::span<const uint8_t>>;
 
+        /**
+         * @brief File system usage statistics
+         */
+        struct FileSystemStatistics
+        {
+            /** @brief Free space in bytes, 0xffffffff if device is not mounted */
+            std::uint32_t FreeBytes;
+            /** @brief Number of erased blocks */
+            std::uint32_t ErasedBlocks;
+            /** @brief Number of garbage collections performed since mount */
+            std::uint32_t GarbageCollections;
+            /** @brief Number of opened files */
+            std::uint32_t OpenHandles;
+        };
+
+        /**
+         * @brief Usage of directory (including its subdirectories)
+         */
+        struct DirectoryUsage
+        {
+            /** @brief Number of files */
+            std::uint32_t Files;
+            /** @brief Number of subdirectories */
+            std::uint32_t Directories;
+            /** @brief Total size of files in bytes */
+            std::uint32_t Size;
+        };
+
+        /** @brief Type that represents directory usage query status. */
+        using DirectoryUsageResult = IOOperationResult<DirectoryUsage>;
+
         /**
          * @brief Enumerator of all possible file opening modes.
          */
@@ -278,6 +309,23 @@ namespace services
              * @return The specified device's free space in bytes or 0xffffffff in case of errors.
              */
             virtual std::uint32_t GetFreeSpace(const char* devicePath) = 0;
+
+            /**
+             * @brief Returns usage statistics of device mounted at root directory.
+             * @return Statistics
+             *
+             * Statistics are updated when file is opened or closed, on sync and after operations that modify directory
+             * structure, so reading them does not access the device. Data written to file that is still open is not
+             * reflected until the file is closed.
+             */
+            virtual FileSystemStatistics GetStatistics() = 0;
+
+            /**
+             * @brief Sums up number and size of files in directory and all its subdirectories.
+             * @param[in] path Directory path
+             * @return Directory usage on success.
+             */
+            virtual DirectoryUsageResult GetDirectoryUsage(const char* path) = 0;
         };
 
         /**
@@ -47,6 +47,11 @@ namespace services
         class YaffsFileSystem final : public IFileSystem, public IYaffsDeviceOperations
         {
           public:
+            /**
+             * @brief Ctor
+             */
+            YaffsFileSystem();
+
             /**
              * @brief Initializes file system interface
              */
@@ -72,12 +77,24 @@ namespace services
             virtual OSResult Seek(FileHandle file, SeekOrigin origin, FileSize offset) override;
 
             virtual std::uint32_t GetFreeSpace(const char* devicePath) override;
+            virtual FileSystemStatistics GetStatistics() override;
+            virtual DirectoryUsageResult GetDirectoryUsage(const char* path) override;
 
             virtual OSResult ClearDevice(yaffs_dev* device) override;
 
             virtual void Sync() override;
 
             virtual OSResult AddDeviceAndMount(yaffs_dev* device) override;
+
+          private:
+            /**
+             * @brief Refreshes statistics of root device after operation that could have modified it
+             * @param[in] openHandlesChange Change of number of opened files caused by the operation
+             */
+            void UpdateStatistics(std::int32_t openHandlesChange = 0);
+
+            /** @brief Statistics of root device */
+            FileSystemStatistics _statistics;
         };
     }
 }
@@ -1,7 +1,9 @@
 #include "yaffs.hpp"
 #include <stdbool.h>
+#include <limits>
 #include <logger/logger.h>
 #include "yaffs.h"
+#include "yaffs_osglue.h"
 
 using namespace services::fs;
 
@@ -19,6 +21,10 @@ static inline OSResult YaffsTranslateError(int error)
     }
 }
 
+YaffsFileSystem::YaffsFileSystem() : _statistics{std::numeric_limits<std::uint32_t>::max(), 0, 0, 0}
+{
+}
+
 char* YaffsFileSystem::ReadDirectory(DirectoryHandle directory)
 {
     struct yaffs_dirent* entry = yaffs_readdir((yaffs_DIR*)directory);
@@ -36,18 +42,22 @@ FileOpenResult YaffsFileSystem::Open(const char* path, FileOpen openFlag, FileAc
 {
     const int status = yaffs_open(path, num(openFlag) | num(accessMode), S_IRWXU);
 
+    this->UpdateStatistics(status != -1 ? 1 : 0);
+
     return FileOpenResult(YaffsTranslateError(status), status);
 }
 
 OSResult YaffsFileSystem::Unlink(const char* path)
 {
     auto status = yaffs_unlink(path);
+    this->UpdateStatistics();
     return YaffsTranslateError(status);
 }
 
 OSResult YaffsFileSystem::Move(const char* from, const char* to)
 {
     auto status = yaffs_rename(from, to);
+    this->UpdateStatistics();
     return YaffsTranslateError(status);
 }
 
@@ -96,6 +106,8 @@ OSResult YaffsFileSystem::Copy(const char* from, const char* to)
     const int destCloseStatus = yaffs_close(destFile);
     const int srcCloseStatus = yaffs_close(srcFile);
 
+    this->UpdateStatistics();
+
     if (destCloseStatus == -1)
     {
         return YaffsTranslateError(destCloseStatus);
@@ -106,7 +118,8 @@ OSResult YaffsFileSystem::Copy(const char* from, const char* to)
 
 OSResult YaffsFileSystem::TruncateFile(FileHandle file, FileSize length)
 {
-    return YaffsTranslateError(yaffs_ftruncate(file, length));
+    const int status = yaffs_ftruncate(file, length);
+    return YaffsTranslateError(status);
 }
 
 IOResult YaffsFileSystem::Write(FileHandle file, gsl::span<const std::uint8_t> buffer)
@@ -135,7 +148,11 @@ IOResult YaffsFileSystem::Read(FileHandle file, gsl::span<std::uint8_t> buffer)
 
 OSResult YaffsFileSystem::Close(FileHandle file)
 {
-    return YaffsTranslateError(yaffs_close(file));
+    const int status = yaffs_close(file);
+
+    this->UpdateStatistics(status != -1 ? -1 : 0);
+
+    return YaffsTranslateError(status);
 }
 
 DirectoryOpenResult YaffsFileSystem::OpenDirectory(const char* directory)
@@ -182,6 +199,7 @@ OSResult YaffsFileSystem::MakeDirectory(const char* path)
 
             if (status < 0)
             {
+                this->UpdateStatistics();
                 return YaffsTranslateError(status);
             }
         }
@@ -189,6 +207,8 @@ OSResult YaffsFileSystem::MakeDirectory(const char* path)
         *p = '/';
     }
 
+    this->UpdateStatistics();
+
     return YaffsTranslateError(status);
 }
 
@@ -196,6 +216,8 @@ OSResult YaffsFileSystem::Format(const char* mountPoint)
 {
     const int status = yaffs_format(mountPoint, true, true, true);
 
+    this->UpdateStatistics();
+
     return YaffsTranslateError(status);
 }
 
@@ -273,7 +295,11 @@ OSResult YaffsFileSystem::ClearDevice(yaffs_dev* device)
 {
     auto root = yaffs_root(device);
 
-    return RemoveDirectoryContents(root);
+    auto result = RemoveDirectoryContents(root);
+
+    this->UpdateStatistics();
+
+    return result;
 }
 
 void YaffsFileSystem::Sync()
@@ -288,6 +314,8 @@ void YaffsFileSystem::Sync()
     }
 
     LOG(LOG_LEVEL_DEBUG, "All devices synced");
+
+    this->UpdateStatistics();
 }
 
 void YaffsFileSystem::Initialize()
@@ -352,11 +380,121 @@ std::uint32_t YaffsFileSystem::GetFreeSpace(const char* devicePath)
     return yaffs_freespace(devicePath);
 }
 
+FileSystemStatistics YaffsFileSystem::GetStatistics()
+{
+    yaffsfs_Lock();
+    const auto statistics = this->_statistics;
+    yaffsfs_Unlock();
+
+    return statistics;
+}
+
+void YaffsFileSystem::UpdateStatistics(std::int32_t openHandlesChange)
+{
+    yaffsfs_Lock();
+
+    this->_statistics.OpenHandles += openHandlesChange;
+
+    auto device = static_cast<yaffs_dev*>(yaffs_getdev("/"));
+
+    if (device != nullptr && device->is_mounted)
+    {
+        this->_statistics.FreeBytes = yaffs_get_n_free_chunks(device) * device->data_bytes_per_chunk;
+        this->_statistics.ErasedBlocks = device->n_erased_blocks;
+        this->_statistics.GarbageCollections = device->all_gcs;
+    }
+    else
+    {
+        this->_statistics.FreeBytes = std::numeric_limits<std::uint32_t>::max();
+        this->_statistics.ErasedBlocks = 0;
+        this->_statistics.GarbageCollections = 0;
+    }
+
+    yaffsfs_Unlock();
+}
+
+/**
+ * @brief Recursively sums up usage of all objects in directory
+ * @param directory Directory
+ * @param usage Usage to which objects in directory are added
+ * @param depth Recursion depth counter
+ * @return Operation result
+ * @remark Yaffs lock has to be held by the caller, so directory entries are walked directly instead of using
+ * yaffs_readdir which takes the lock itself.
+ */
+static OSResult SumDirectoryUsage(yaffs_obj* directory, DirectoryUsage& usage, int depth = 0)
+{
+    if (depth > RecursionLimit)
+        return OSResult::PathTooLong;
+
+    auto result = OSResult::Success;
+
+    list_head* entry;
+
+    list_for_each(entry, &directory->variant.dir_variant.children)
+    {
+        yaffs_obj* obj = list_entry(entry, yaffs_obj, siblings);
+
+        if (obj->obj_id == YAFFS_OBJECTID_LOSTNFOUND)
+        {
+            continue;
+        }
+
+        if (obj->variant_type == YAFFS_OBJECT_TYPE_FILE)
+        {
+            usage.Files++;
+            usage.Size += yaffs_get_obj_length(obj);
+        }
+        else if (obj->variant_type == YAFFS_OBJECT_TYPE_DIRECTORY)
+        {
+            usage.Directories++;
+
+            result = SumDirectoryUsage(obj, usage, depth + 1);
+            if (OS_RESULT_FAILED(result))
+            {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+DirectoryUsageResult YaffsFileSystem::GetDirectoryUsage(const char* path)
+{
+    DirectoryUsage usage{0, 0, 0};
+
+    yaffsfs_Lock();
+
+    yaffs_obj* directory = yaffsfs_FindObject(nullptr, path, 0, 1, nullptr, nullptr, nullptr);
+
+    OSResult result;
+
+    if (directory == nullptr)
+    {
+        result = OSResult::NotFound;
+    }
+    else if (directory->variant_type != YAFFS_OBJECT_TYPE_DIRECTORY)
+    {
+        result = OSResult::NotADirectory;
+    }
+    else
+    {
+        result = SumDirectoryUsage(directory, usage);
+    }
+
+    yaffsfs_Unlock();
+
+    return DirectoryUsageResult(result, usage);
+}
+
 OSResult YaffsFileSystem::AddDeviceAndMount(yaffs_dev* device)
 {
     yaffs_add_device(device);
     int result = yaffs_mount(device->param.name);
 
+    this->UpdateStatistics();
+
     if (result == 0)
     {
         LOGF(LOG_LEVEL_DEBUG, "Mounted %s", device->param.name);
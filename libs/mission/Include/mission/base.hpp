@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstdint>
 #include "system.h"
+#include "utils.h"
 
 namespace mission
 {
@@ -109,6 +110,31 @@ namespace mission
         Failure
     };
 
+    /**
+     * @brief Enumerator of resources used by mission state update descriptors.
+     *
+     * When parallel update is enabled descriptors that use different resources are run concurrently.
+     * Descriptors that use the same resource are always run one after another in the declaration order.
+     */
+    enum class UpdateResource : std::uint8_t
+    {
+        /** @brief Descriptor requires exclusive access to the whole system. It is never run concurrently with anything else. */
+        Exclusive = 0,
+        /** @brief Descriptor performs only computation/access to internal MCU peripherals */
+        Cpu = 1,
+        /** @brief Descriptor communicates with devices on system I2C bus */
+        SystemBus = 2,
+        /** @brief Descriptor communicates with devices on payload I2C bus */
+        PayloadBus = 3,
+        /** @brief Descriptor communicates with devices on SPI bus */
+        Spi = 4
+    };
+
+    /**
+     * @brief Number of update resources
+     */
+    static constexpr std::uint8_t UpdateResourceCount = 5;
+
     /**
      * @brief Type of procedure that updates mission state.
      * @param[in,out] state System state object to update.
@@ -142,6 +168,14 @@ namespace mission
          */
         void* param;
 
+        /**
+         * @brief Resource used by update procedure.
+         *
+         * Descriptors that share no resource may be run concurrently. Update procedures that are run concurrently must
+         * modify disjoint parts of the state.
+         */
+        UpdateResource resource = UpdateResource::Exclusive;
+
         /**
          * @brief performs system state update
          * @param state System state
@@ -278,6 +312,15 @@ namespace mission
      */
     template <typename State> using ConditionProc = bool (*)(const State& state, void* param);
 
+    /**
+     * @brief Type of the procedure that determines when action will be due.
+     * @param[in] state Reference to the state object.
+     * @param[in] param Pointer to action specific context.
+     * @return Time remaining until the action should be performed. None if the action is already due or its due time
+     * depends on conditions other than time.
+     */
+    template <typename State> using NextDueProc = Option<std::chrono::milliseconds> (*)(const State& state, void* param);
+
     /**
      * @brief Structure that describes mission action.
      * @tparam State Type of the state this action operates on.
@@ -306,6 +349,13 @@ namespace mission
          */
         void* param;
 
+        /**
+         * @brief Pointer to procedure that determines when action will be due.
+         *
+         * Optional. Actions that do not provide it are evaluated with the fixed mission loop period.
+         */
+        NextDueProc<State> nextDue = nullptr;
+
         /**
          * @brief Evaluates condition for this action
          * @param state System state
@@ -313,6 +363,13 @@ namespace mission
          */
         inline bool EvaluateCondition(const State& state);
 
+        /**
+         * @brief Determines when action will be due
+         * @param state System state
+         * @return Time remaining until action is due. None if it is not known.
+         */
+        inline Option<std::chrono::milliseconds> NextDue(const State& state);
+
         /**
          * @brief Executes action
          * @param state System state
@@ -338,6 +395,16 @@ namespace mission
         }
     }
 
+    template <typename State> inline Option<std::chrono::milliseconds> ActionDescriptor<State>::NextDue(const State& state)
+    {
+        if (this->nextDue == nullptr)
+        {
+            return None<std::chrono::milliseconds>();
+        }
+
+        return this->nextDue(state, this->param);
+    }
+
     /**
      * @brief Packs number of actions into single action that can plug into mission loop
      * @tparam State System state
@@ -446,6 +513,17 @@ namespace mission
          */
         virtual void NotifyTimeChanged(std::chrono::milliseconds timeCorrection) = 0;
     };
+
+    /**
+     * @brief Interface that is used for waking up mission loop ahead of its schedule.
+     */
+    struct IMissionLoopWakeUp
+    {
+        /**
+         * @brief Requests mission loop iteration as soon as possible (without waiting for it to finish).
+         */
+        virtual void WakeUp() = 0;
+    };
 }
 
 #endif
@@ -3,9 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include "base.hpp"
 #include "gsl/span"
+#include "parallel.hpp"
+#include "profile.hpp"
 
 namespace mission
 {
@@ -18,14 +23,19 @@ namespace mission
      * @brief Invokes all the system state update descriptors.
      * @param[in,out] state System state to update
      * @param[in] descriptors List of update descriptors to run.
+     * @param[in] probe Probe measuring execution time of each descriptor.
      * @return System state update result.
      */
-    template <typename State> UpdateResult SystemStateUpdate(State& state, gsl::span<UpdateDescriptor<State>> descriptors)
+    template <typename State, typename Probe = NullProbe>
+    UpdateResult SystemStateUpdate(State& state, gsl::span<UpdateDescriptor<State>> descriptors, Probe probe = Probe())
     {
         UpdateResult result = UpdateResult::Ok;
+        std::size_t index = 0;
         for (const auto& descriptor : descriptors)
         {
+            const auto start = probe.Begin();
             auto descriptorResult = descriptor.Execute(state);
+            probe.End(index++, start);
             if (descriptorResult == UpdateResult::Warning)
             {
                 result = UpdateResult::Warning;
@@ -40,26 +50,145 @@ namespace mission
         return result;
     }
 
+    /**
+     * @brief Combines results of two update descriptors.
+     * @param[in] left First result
+     * @param[in] right Second result
+     * @return More severe of two results
+     */
+    constexpr UpdateResult CombineUpdateResults(UpdateResult left, UpdateResult right)
+    {
+        return (left == UpdateResult::Failure || right == UpdateResult::Failure)
+            ? UpdateResult::Failure
+            : ((left == UpdateResult::Warning || right == UpdateResult::Warning) ? UpdateResult::Warning : UpdateResult::Ok);
+    }
+
+    /**
+     * @brief Group of consecutive non-exclusive update descriptors executed concurrently.
+     */
+    template <typename State, typename Probe> struct ParallelUpdateStage
+    {
+        /** @brief System state */
+        State& state;
+        /** @brief Descriptors from stage */
+        gsl::span<UpdateDescriptor<State>> descriptors;
+        /** @brief Index of first descriptor from stage */
+        std::size_t offset;
+        /** @brief Probe measuring execution time of each descriptor */
+        Probe probe;
+        /** @brief Result of each lane */
+        std::array<UpdateResult, UpdateResourceCount> results;
+    };
+
+    /**
+     * @brief Executes all descriptors from stage that use given resource.
+     * @param[in] context Stage (@ref ParallelUpdateStage)
+     * @param[in] lane Executed lane
+     */
+    template <typename State, typename Probe> void RunUpdateLane(void* context, UpdateResource lane)
+    {
+        auto stage = static_cast<ParallelUpdateStage<State, Probe>*>(context);
+        auto& result = stage->results[num(lane)];
+
+        for (std::ptrdiff_t i = 0; i < stage->descriptors.size(); i++)
+        {
+            const auto& descriptor = stage->descriptors[i];
+            if (descriptor.resource != lane)
+            {
+                continue;
+            }
+
+            const auto start = stage->probe.Begin();
+            auto descriptorResult = descriptor.Execute(stage->state);
+            stage->probe.End(stage->offset + i, start);
+
+            result = CombineUpdateResults(result, descriptorResult);
+            if (result == UpdateResult::Failure)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Invokes all the system state update descriptors running descriptors that use different resources concurrently.
+     * @param[in,out] state System state to update
+     * @param[in] descriptors List of update descriptors to run.
+     * @param[in] pool Worker pool used to execute lanes.
+     * @param[in] probe Probe measuring execution time of each descriptor.
+     * @return System state update result.
+     *
+     * Consecutive descriptors that do not require exclusive access form a stage. Stage is executed on all used lanes
+     * at once and joined before executing next descriptor. Exclusive descriptors are executed alone, in the declaration order.
+     * On failure the lane that failed is stopped, the remaining lanes finish the stage and no further descriptors are executed.
+     */
+    template <typename State, typename Probe = NullProbe>
+    UpdateResult SystemStateParallelUpdate(
+        State& state, gsl::span<UpdateDescriptor<State>> descriptors, IUpdateWorkerPool& pool, Probe probe = Probe())
+    {
+        UpdateResult result = UpdateResult::Ok;
+        std::ptrdiff_t index = 0;
+        while (index < descriptors.size() && result != UpdateResult::Failure)
+        {
+            const auto& descriptor = descriptors[index];
+            if (descriptor.resource == UpdateResource::Exclusive)
+            {
+                const auto start = probe.Begin();
+                result = CombineUpdateResults(result, descriptor.Execute(state));
+                probe.End(index, start);
+                index++;
+                continue;
+            }
+
+            std::ptrdiff_t end = index;
+            UpdateLanes lanes = 0;
+            while (end < descriptors.size() && descriptors[end].resource != UpdateResource::Exclusive)
+            {
+                lanes |= LaneOf(descriptors[end].resource);
+                end++;
+            }
+
+            ParallelUpdateStage<State, Probe> stage{state, descriptors.subspan(index, end - index), static_cast<std::size_t>(index), probe, {}};
+            stage.results.fill(UpdateResult::Ok);
+
+            pool.Run(RunUpdateLane<State, Probe>, &stage, lanes);
+
+            for (auto laneResult : stage.results)
+            {
+                result = CombineUpdateResults(result, laneResult);
+            }
+
+            index = end;
+        }
+
+        return result;
+    }
+
     /**
      * @brief Performs system state verification.
      * @param[in] state State to verify.
      * @param[in] descriptors List of verification descriptors to run.
      * @param[out] results Verification results. Must be initialized to array of the same length as descriptors.
+     * @param[in] probe Probe measuring execution time of each descriptor.
      * @return Overall verification result
      *
      * @remark Always runs all descriptors.
      */
-    template <typename State>
+    template <typename State, typename Probe = NullProbe>
     VerifyResult SystemStateVerify(const State& state, //
         gsl::span<const VerifyDescriptor<State>> descriptors,
-        gsl::span<VerifyDescriptorResult> results)
+        gsl::span<VerifyDescriptorResult> results,
+        Probe probe = Probe())
     {
         VerifyResult result = VerifyResult::Ok;
         const uint16_t count = 0;
+        std::size_t index = 0;
         for (const auto& descriptor : descriptors)
         {
             auto& target = results[count];
+            const auto start = probe.Begin();
             target = descriptor.verifyProc(state, descriptor.param);
+            probe.End(index++, start);
             if (target.Result() == VerifyResult::Failure)
             {
                 result = VerifyResult::Failure;
@@ -99,6 +228,31 @@ namespace mission
 
         return target.subspan(0, runnableIdx);
     }
+    /**
+     * @brief Determines how long mission loop can wait before next iteration.
+     * @param[in] state Current system state.
+     * @param[in] actions List of available action descriptors.
+     * @param[in] fallbackPeriod Period used when at least one action does not know when it will be due.
+     * @param[in] idlePeriod Maximum wait time when all actions know when they will be due.
+     * @return Time until the earliest action will be due, limited by fallback or idle period.
+     */
+    template <typename State>
+    std::chrono::milliseconds SystemDetermineNextIteration(const State& state, //
+        gsl::span<ActionDescriptor<State>> actions,
+        std::chrono::milliseconds fallbackPeriod,
+        std::chrono::milliseconds idlePeriod)
+    {
+        auto delay = idlePeriod;
+
+        for (auto& descriptor : actions)
+        {
+            const auto due = descriptor.NextDue(state);
+            delay = std::min(delay, due.HasValue ? due.Value : fallbackPeriod);
+        }
+
+        return delay;
+    }
+
     /**
      * @brief Executes specified actions.
      * @param[in] state System state
@@ -111,6 +265,24 @@ namespace mission
             descriptor->Execute(state);
         }
     }
+
+    /**
+     * @brief Executes specified actions measuring execution time of each of them.
+     * @param[in] state System state
+     * @param[in] actions List of action descriptors to run.
+     * @param[in] all List of all action descriptors, used to determine index of executed action.
+     * @param[in] probe Probe measuring execution time of each action.
+     */
+    template <typename State, typename Probe>
+    void SystemDispatchActions(State& state, gsl::span<ActionDescriptor<State>*> actions, const ActionDescriptor<State>* all, Probe probe)
+    {
+        for (auto descriptor : actions)
+        {
+            const auto start = probe.Begin();
+            descriptor->Execute(state);
+            probe.End(static_cast<std::size_t>(descriptor - all), start);
+        }
+    }
 }
 /** @} */
 
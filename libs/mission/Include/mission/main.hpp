@@ -12,6 +12,8 @@
 #include "gsl/span"
 #include "logger/logger.h"
 #include "logic.hpp"
+#include "parallel.hpp"
+#include "profile.hpp"
 #include "traits.hpp"
 
 using namespace std::chrono_literals;
@@ -98,7 +100,8 @@ namespace mission
      * @tparam T Parameter pack that defines currently supported actions. All actions from this list should be able to
      * operate on a state whose type is State.
      */
-    template <typename State, typename... T> struct MissionLoop final : public IHasState<State>, public T..., INotifyTimeChanged
+    template <typename State, typename... T>
+    struct MissionLoop final : public IHasState<State>, public T..., INotifyTimeChanged, IMissionLoopWakeUp, IMissionLoopProfile
     {
       public:
         /**
@@ -161,6 +164,18 @@ namespace mission
          */
         typedef std::array<VerifyDescriptor<State>, CountVerify> VerifyList;
 
+#ifdef MISSION_LOOP_PROFILING
+        /**
+         * @brief Type of profiler measuring execution time of descriptors.
+         */
+        typedef MissionLoopProfiler<CountUpdate + CountVerify + CountAction> Profiler;
+#else
+        /**
+         * @brief Type of profiler measuring execution time of descriptors (profiling disabled).
+         */
+        typedef NullMissionLoopProfiler Profiler;
+#endif
+
         /**
          * @brief ctor.
          *
@@ -179,6 +194,11 @@ namespace mission
          */
         template <typename... Args> MissionLoop(Args&&... args);
 
+        /**
+         * @brief Minimal time period between two subsequent mission iterations.
+         */
+        static constexpr std::chrono::milliseconds MinimumIterationPeriod = std::chrono::seconds(1);
+
         /**
          * @brief Initializes mission loop task.
          * @param[in] timePeriod Time period between two subsequent mission interations.
@@ -186,6 +206,16 @@ namespace mission
          */
         bool Initialize(std::chrono::milliseconds timePeriod);
 
+        /**
+         * @brief Initializes mission loop task.
+         * @param[in] timePeriod Time period between two subsequent mission interations used when at least one action does not
+         * report when it will be due.
+         * @param[in] maxIdlePeriod Maximum time period between two subsequent mission iterations when all actions report when
+         * they will be due.
+         * @return Operation status, true on success, false otherwise.
+         */
+        bool Initialize(std::chrono::milliseconds timePeriod, std::chrono::milliseconds maxIdlePeriod);
+
         /**
          * @brief Suspends indefinitely execution of mission loop.
          */
@@ -208,6 +238,19 @@ namespace mission
          */
         void RequestSingleIteration();
 
+        /**
+         * @brief Requests mission loop iteration as soon as possible.
+         *
+         * @remark Subsequent iterations are never closer to each other than @ref MinimumIterationPeriod
+         */
+        virtual void WakeUp() override;
+
+        /**
+         * @brief Returns time the mission loop will wait after last iteration before running next one.
+         * @return Delay of next iteration
+         */
+        std::chrono::milliseconds NextIterationDelay() const;
+
         /**
          * @brief Current mission state accessor.
          * @return Reference to current mission state.
@@ -229,6 +272,20 @@ namespace mission
          * */
         virtual void NotifyTimeChanged(std::chrono::milliseconds timeCorrection) override;
 
+        /**
+         * @brief Enables parallel execution of update descriptors.
+         * @param[in] pool Worker pool used to execute update descriptors that use independent resources.
+         *
+         * @remark Without worker pool all update descriptors are executed sequentially in the declaration order.
+         */
+        void EnableParallelUpdate(IUpdateWorkerPool& pool);
+
+        virtual gsl::span<const DescriptorTiming> Timings() const override;
+
+        virtual void ResetTimings() override;
+
+        virtual void SetOverrunThreshold(std::chrono::milliseconds threshold) override;
+
       private:
         /**
          * @brief Flag signaled when mission loop execution should be suspended.
@@ -244,6 +301,11 @@ namespace mission
 
         static constexpr std::uint32_t RunOnceFinishedFlag = 0x8;
 
+        /**
+         * @brief Flag signaled when mission loop iteration should be performed ahead of schedule.
+         */
+        static constexpr std::uint32_t WakeUpFlag = 0x10;
+
         /**
          * @brief Initializes all descriptor lists.
          */
@@ -278,6 +340,11 @@ namespace mission
          */
         void TaskLoop();
 
+        /**
+         * @brief Runs single scheduled mission loop iteration.
+         */
+        void RunIteration();
+
         /**
          * @brief Mission loop entry point.
          * @param[in] param Task context.
@@ -291,6 +358,15 @@ namespace mission
         /** @brief Time period between subsequent mission iterations. */
         std::chrono::milliseconds iterationPeriod;
 
+        /** @brief Maximum time period between subsequent mission iterations when all actions report their due time. */
+        std::chrono::milliseconds idlePeriod;
+
+        /** @brief Delay of next mission iteration. */
+        std::chrono::milliseconds nextIterationDelay;
+
+        /** @brief Uptime at which last mission iteration has been started. */
+        std::chrono::milliseconds lastIterationAt;
+
         /** Current mission state. */
         State state;
 
@@ -308,9 +384,20 @@ namespace mission
 
         /** Handle to event group used for controlling the state of mission loop execution. */
         OSEventGroupHandle eventGroup;
+
+        /** Execution time statistics of descriptors. */
+        Profiler profiler;
+
+        /** Worker pool used for parallel update. Null if update is executed sequentially. */
+        IUpdateWorkerPool* updatePool;
     };
 
-    template <typename State, typename... T> MissionLoop<State, T...>::MissionLoop() : taskHandle(nullptr), eventGroup(nullptr)
+    template <typename State, typename... T> constexpr std::chrono::milliseconds MissionLoop<State, T...>::MinimumIterationPeriod;
+
+    template <typename State, typename... T>
+    MissionLoop<State, T...>::MissionLoop()
+        : iterationPeriod(0ms), idlePeriod(0ms), nextIterationDelay(0ms), lastIterationAt(0ms), taskHandle(nullptr), eventGroup(nullptr),
+          updatePool(nullptr)
     {
         Setup();
     }
@@ -319,8 +406,13 @@ namespace mission
     template <typename... Args>
     MissionLoop<State, T...>::MissionLoop(Args&&... args) //
         : T(std::forward<Args>(args))...,
+          iterationPeriod(0ms),
+          idlePeriod(0ms),
+          nextIterationDelay(0ms),
+          lastIterationAt(0ms),
           taskHandle(nullptr),
-          eventGroup(nullptr)
+          eventGroup(nullptr),
+          updatePool(nullptr)
     {
         static_assert(sizeof...(Args) == sizeof...(T), "Number of arguments must be equal to number of mission components");
         Setup();
@@ -331,6 +423,21 @@ namespace mission
         Process<0, IsUpdate, GetUpdateDescriptor, UpdateList, T...>(updates, HasMore<T...>());
         Process<0, IsAction, GetActionDescriptor, ActionList, T...>(actions, HasMore<T...>());
         Process<0, IsVerify, GetVerifyDescriptor, VerifyList, T...>(verifications, HasMore<T...>());
+
+        for (std::size_t i = 0; i < CountUpdate; i++)
+        {
+            profiler.Assign(i, ProfiledElement::Update, updates[i].name);
+        }
+
+        for (std::size_t i = 0; i < CountVerify; i++)
+        {
+            profiler.Assign(CountUpdate + i, ProfiledElement::Verify, verifications[i].name);
+        }
+
+        for (std::size_t i = 0; i < CountAction; i++)
+        {
+            profiler.Assign(CountUpdate + CountVerify + i, ProfiledElement::Action, actions[i].name);
+        }
     }
 
     template <typename State, typename... T>
@@ -364,8 +471,17 @@ namespace mission
     }
 
     template <typename State, typename... T> bool MissionLoop<State, T...>::Initialize(std::chrono::milliseconds timePeriod)
+    {
+        return Initialize(timePeriod, timePeriod);
+    }
+
+    template <typename State, typename... T>
+    bool MissionLoop<State, T...>::Initialize(std::chrono::milliseconds timePeriod, std::chrono::milliseconds maxIdlePeriod)
     {
         this->iterationPeriod = timePeriod;
+        this->idlePeriod = maxIdlePeriod;
+        this->nextIterationDelay = timePeriod;
+        this->profiler.OverrunThreshold(timePeriod);
         this->eventGroup = System::CreateEventGroup();
         if (this->eventGroup == nullptr)
         {
@@ -447,13 +563,19 @@ namespace mission
         std::array<VerifyDescriptorResult, CountVerify> detailedVerifyResult;
         LOG(LOG_LEVEL_TRACE, "Updating system state");
 
-        auto updateResult = SystemStateUpdate(state, gsl::make_span(updates));
+        auto iterationProbe = profiler.Iteration();
+        const auto iterationStart = iterationProbe.Begin();
+
+        auto updateResult = (updatePool != nullptr) //
+            ? SystemStateParallelUpdate(state, gsl::make_span(updates), *updatePool, profiler.Phase(0))
+            : SystemStateUpdate(state, gsl::make_span(updates), profiler.Phase(0));
 
         LOGF(LOG_LEVEL_TRACE, "System state update result %d", static_cast<int>(updateResult));
 
         auto verifyResult = SystemStateVerify(state,                 //
             gsl::span<const VerifyDescriptor<State>>(verifications), //
-            gsl::make_span(detailedVerifyResult));
+            gsl::make_span(detailedVerifyResult),                      //
+            profiler.Phase(CountUpdate));
 
         LOGF(LOG_LEVEL_TRACE, "Verify result %d", static_cast<int>(verifyResult));
 
@@ -463,7 +585,14 @@ namespace mission
 
         LOGF(LOG_LEVEL_TRACE, "Executing %d actions", static_cast<int>(runableSpan.size()));
 
-        SystemDispatchActions(state, runableSpan);
+        SystemDispatchActions(state, runableSpan, actions.data(), profiler.Phase(CountUpdate + CountVerify));
+
+        this->nextIterationDelay = std::max(MinimumIterationPeriod, //
+            SystemDetermineNextIteration(state, gsl::make_span(actions), this->iterationPeriod, this->idlePeriod));
+
+        LOGF(LOG_LEVEL_TRACE, "Next iteration in %ld ms", static_cast<long>(this->nextIterationDelay.count()));
+
+        iterationProbe.End(0, iterationStart);
     }
 
     template <typename State, typename... T> void MissionLoop<State, T...>::RequestSingleIteration()
@@ -482,6 +611,19 @@ namespace mission
         }
     }
 
+    template <typename State, typename... T> void MissionLoop<State, T...>::WakeUp()
+    {
+        if (this->eventGroup != nullptr)
+        {
+            System::EventGroupSetBits(this->eventGroup, WakeUpFlag);
+        }
+    }
+
+    template <typename State, typename... T> std::chrono::milliseconds MissionLoop<State, T...>::NextIterationDelay() const
+    {
+        return this->nextIterationDelay;
+    }
+
     template <typename State, typename... T> void MissionLoop<State, T...>::MissionLoopControlTask(void* param)
     {
         auto missionState = static_cast<MissionLoop<State, T...>*>(param);
@@ -494,14 +636,14 @@ namespace mission
 
         for (;;)
         {
-            const OSEventBits result =
-                System::EventGroupWaitForBits(this->eventGroup, RunOnceRequestFlag | PauseRequestFlag, false, false, this->iterationPeriod);
+            const OSEventBits result = System::EventGroupWaitForBits(
+                this->eventGroup, RunOnceRequestFlag | PauseRequestFlag | WakeUpFlag, false, false, this->nextIterationDelay);
 
             if (has_flag(result, RunOnceRequestFlag))
             {
                 LOG(LOG_LEVEL_DEBUG, "Running mission loop task once");
 
-                RunOnce();
+                RunIteration();
                 System::EventGroupClearBits(this->eventGroup, RunOnceRequestFlag);
                 System::EventGroupSetBits(this->eventGroup, RunOnceFinishedFlag);
             }
@@ -514,13 +656,32 @@ namespace mission
                 System::SuspendTask(nullptr);
             }
 
-            if (result == 0)
+            if (has_flag(result, WakeUpFlag))
+            {
+                System::EventGroupClearBits(this->eventGroup, WakeUpFlag);
+
+                const auto sinceLastIteration = System::GetUptime() - this->lastIterationAt;
+                if (sinceLastIteration < MinimumIterationPeriod)
+                {
+                    System::SleepTask(MinimumIterationPeriod - sinceLastIteration);
+                }
+
+                LOG(LOG_LEVEL_DEBUG, "Mission loop woken up");
+                RunIteration();
+            }
+            else if (result == 0)
             {
-                RunOnce();
+                RunIteration();
             }
         }
     }
 
+    template <typename State, typename... T> void MissionLoop<State, T...>::RunIteration()
+    {
+        this->lastIterationAt = System::GetUptime();
+        RunOnce();
+    }
+
     template <typename State, typename... T>
     inline const typename MissionLoop<State, T...>::StateType& MissionLoop<State, T...>::GetState() const noexcept
     {
@@ -533,6 +694,26 @@ namespace mission
         return this->state;
     }
 
+    template <typename State, typename... T> void MissionLoop<State, T...>::EnableParallelUpdate(IUpdateWorkerPool& pool)
+    {
+        this->updatePool = &pool;
+    }
+
+    template <typename State, typename... T> gsl::span<const DescriptorTiming> MissionLoop<State, T...>::Timings() const
+    {
+        return this->profiler.Timings();
+    }
+
+    template <typename State, typename... T> void MissionLoop<State, T...>::ResetTimings()
+    {
+        this->profiler.Reset();
+    }
+
+    template <typename State, typename... T> void MissionLoop<State, T...>::SetOverrunThreshold(std::chrono::milliseconds threshold)
+    {
+        this->profiler.OverrunThreshold(threshold);
+    }
+
     template <typename State, typename... T> bool MissionLoop<State, T...>::EnableAutostart()
     {
         if (!EnableAutostartDisabledTasks<0, T...>())
@@ -579,6 +760,7 @@ namespace mission
     template <typename State, typename... T> void MissionLoop<State, T...>::NotifyTimeChanged(std::chrono::milliseconds timeCorrection)
     {
         NotifyTimeChanged<0, T...>(timeCorrection);
+        WakeUp();
     }
 
     template <typename State, typename... T>
@@ -0,0 +1,123 @@
+#ifndef LIBS_MISSION_INCLUDE_MISSION_PARALLEL_HPP_
+#define LIBS_MISSION_INCLUDE_MISSION_PARALLEL_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "base.hpp"
+#include "base/os.h"
+#include "utils.h"
+
+namespace mission
+{
+    /**
+     * @defgroup mission_parallel Parallel state update
+     * @ingroup mission_loop
+     * @brief Concurrent execution of update descriptors that use independent resources.
+     *
+     * Each update resource (except @ref UpdateResource::Exclusive) is assigned a lane. Lanes are executed concurrently
+     * while descriptors from single lane are executed one after another.
+     * @{
+     */
+
+    /**
+     * @brief Set of update lanes (bit mask indexed by @ref UpdateResource)
+     */
+    using UpdateLanes = std::uint8_t;
+
+    /**
+     * @brief Returns lane mask for single resource
+     * @param resource Update resource
+     * @return Lane mask
+     */
+    constexpr UpdateLanes LaneOf(UpdateResource resource)
+    {
+        return static_cast<UpdateLanes>(1 << num(resource));
+    }
+
+    /**
+     * @brief Procedure that executes all descriptors from single lane
+     * @param[in] context Job context
+     * @param[in] lane Lane to execute
+     */
+    using UpdateLaneJob = void (*)(void* context, UpdateResource lane);
+
+    /**
+     * @brief Pool of workers executing update lanes concurrently
+     */
+    struct IUpdateWorkerPool
+    {
+        /**
+         * @brief Executes job on selected lanes and waits until all of them finish
+         * @param[in] job Job to execute
+         * @param[in] context Job context
+         * @param[in] lanes Lanes to execute
+         */
+        virtual void Run(UpdateLaneJob job, void* context, UpdateLanes lanes) = 0;
+    };
+
+    /**
+     * @brief Worker pool with single task for each bus lane.
+     *
+     * @ref UpdateResource::Cpu lane is executed by the calling task.
+     */
+    class UpdateWorkerPool final : public IUpdateWorkerPool, private NotCopyable, private NotMoveable
+    {
+      public:
+        /**
+         * @brief Ctor
+         */
+        UpdateWorkerPool();
+
+        /**
+         * @brief Creates worker tasks
+         * @return Operation result
+         */
+        OSResult Initialize();
+
+        virtual void Run(UpdateLaneJob job, void* context, UpdateLanes lanes) override;
+
+      private:
+        /** @brief Number of worker tasks */
+        static constexpr std::uint8_t WorkerCount = UpdateResourceCount - 2;
+
+        /** @brief Offset of 'lane finished' bits in event group */
+        static constexpr std::uint8_t FinishedShift = 8;
+
+        /**
+         * @brief Single worker
+         */
+        struct Worker
+        {
+            /** @brief Owning pool */
+            UpdateWorkerPool* Pool;
+            /** @brief Lane executed by worker */
+            UpdateResource Lane;
+            /** @brief Worker task handle */
+            OSTaskHandle Handle;
+        };
+
+        /**
+         * @brief Worker task procedure
+         * @param[in] param Worker
+         */
+        static void WorkerTask(void* param);
+
+        /** @brief Workers */
+        std::array<Worker, WorkerCount> _workers;
+
+        /** @brief Event group used to start lanes and signal their completion */
+        EventGroup _events;
+
+        /** @brief Currently executed job */
+        UpdateLaneJob _job;
+
+        /** @brief Context of currently executed job */
+        void* _context;
+    };
+
+    /** @} */
+}
+
+#endif /* LIBS_MISSION_INCLUDE_MISSION_PARALLEL_HPP_ */
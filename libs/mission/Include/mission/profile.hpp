@@ -0,0 +1,363 @@
+#ifndef LIBS_MISSION_INCLUDE_MISSION_PROFILE_HPP_
+#define LIBS_MISSION_INCLUDE_MISSION_PROFILE_HPP_
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include "base/os.h"
+#include "gsl/span"
+
+namespace mission
+{
+    /**
+     * @defgroup mission_profile Mission loop profiling
+     * @ingroup mission_loop
+     * @brief Optional measurement of execution time of mission loop descriptors.
+     *
+     * Profiling is enabled at compile time by defining MISSION_LOOP_PROFILING (CMake option ENABLE_MISSION_LOOP_PROFILING).
+     * When disabled mission loop uses @ref NullMissionLoopProfiler that does not measure anything and is optimized out.
+     * @{
+     */
+
+    /**
+     * @brief Kind of profiled mission loop element
+     */
+    enum class ProfiledElement : std::uint8_t
+    {
+        Update = 0,   //!< Update descriptor
+        Verify = 1,   //!< Verify descriptor
+        Action = 2,   //!< Action descriptor
+        Iteration = 3 //!< Whole mission loop iteration
+    };
+
+    /**
+     * @brief Execution time statistics of single mission loop element
+     */
+    struct DescriptorTiming
+    {
+        /** @brief Ctor */
+        DescriptorTiming();
+
+        /**
+         * @brief Records single execution
+         * @param duration Execution time
+         * @param overrunThreshold Execution time above which execution is counted as overrun
+         */
+        void Record(std::chrono::milliseconds duration, std::chrono::milliseconds overrunThreshold);
+
+        /** @brief Clears gathered statistics */
+        void Reset();
+
+        /**
+         * @brief Returns average execution time
+         * @return Average execution time or 0 if element has not been executed yet
+         */
+        std::chrono::milliseconds Average() const;
+
+        /** @brief Descriptor name */
+        const char* Name;
+        /** @brief Element kind */
+        ProfiledElement Kind;
+        /** @brief Shortest execution time */
+        std::chrono::milliseconds Min;
+        /** @brief Longest execution time */
+        std::chrono::milliseconds Max;
+        /** @brief Most recent execution time */
+        std::chrono::milliseconds Last;
+        /** @brief Sum of all execution times */
+        std::chrono::milliseconds Total;
+        /** @brief Number of executions */
+        std::uint32_t Runs;
+        /** @brief Number of executions that exceeded overrun threshold */
+        std::uint16_t Overruns;
+    };
+
+    inline DescriptorTiming::DescriptorTiming() : Name(""), Kind(ProfiledElement::Update)
+    {
+        Reset();
+    }
+
+    inline void DescriptorTiming::Record(std::chrono::milliseconds duration, std::chrono::milliseconds overrunThreshold)
+    {
+        if (this->Runs == 0 || duration < this->Min)
+        {
+            this->Min = duration;
+        }
+
+        this->Max = std::max(this->Max, duration);
+        this->Last = duration;
+        this->Total += duration;
+        this->Runs++;
+
+        if (duration > overrunThreshold && this->Overruns < std::numeric_limits<std::uint16_t>::max())
+        {
+            this->Overruns++;
+        }
+    }
+
+    inline void DescriptorTiming::Reset()
+    {
+        this->Min = std::chrono::milliseconds::zero();
+        this->Max = std::chrono::milliseconds::zero();
+        this->Last = std::chrono::milliseconds::zero();
+        this->Total = std::chrono::milliseconds::zero();
+        this->Runs = 0;
+        this->Overruns = 0;
+    }
+
+    inline std::chrono::milliseconds DescriptorTiming::Average() const
+    {
+        if (this->Runs == 0)
+        {
+            return std::chrono::milliseconds::zero();
+        }
+
+        return this->Total / this->Runs;
+    }
+
+    /**
+     * @brief Interface giving access to mission loop execution time statistics
+     */
+    struct IMissionLoopProfile
+    {
+        /**
+         * @brief Returns statistics of all descriptors followed by statistics of whole iteration
+         * @return Statistics list. Empty if profiling is disabled
+         */
+        virtual gsl::span<const DescriptorTiming> Timings() const = 0;
+
+        /** @brief Clears gathered statistics */
+        virtual void ResetTimings() = 0;
+
+        /**
+         * @brief Sets execution time above which descriptor execution is counted as overrun
+         * @param threshold Overrun threshold
+         */
+        virtual void SetOverrunThreshold(std::chrono::milliseconds threshold) = 0;
+    };
+
+    /**
+     * @brief Probe that does not measure anything
+     */
+    struct NullProbe
+    {
+        /**
+         * @brief Marks beginning of descriptor execution
+         * @return Dummy token
+         */
+        constexpr int Begin() const
+        {
+            return 0;
+        }
+
+        /**
+         * @brief Marks end of descriptor execution
+         */
+        void End(std::size_t /*index*/, int /*token*/) const
+        {
+        }
+    };
+
+    /**
+     * @brief Profiler that does not gather any statistics. Used when profiling is disabled.
+     */
+    struct NullMissionLoopProfiler
+    {
+        /**
+         * @brief Assigns name to profiled element
+         */
+        void Assign(std::size_t /*index*/, ProfiledElement /*kind*/, const char* /*name*/)
+        {
+        }
+
+        /**
+         * @brief Returns probe for single mission loop phase
+         * @return Probe
+         */
+        NullProbe Phase(std::size_t /*offset*/)
+        {
+            return NullProbe();
+        }
+
+        /**
+         * @brief Returns probe for whole iteration
+         * @return Probe
+         */
+        NullProbe Iteration()
+        {
+            return NullProbe();
+        }
+
+        /**
+         * @brief Returns gathered statistics
+         * @return Empty list
+         */
+        gsl::span<const DescriptorTiming> Timings() const
+        {
+            return gsl::span<const DescriptorTiming>();
+        }
+
+        /** @brief Clears gathered statistics */
+        void Reset()
+        {
+        }
+
+        /** @brief Sets overrun threshold */
+        void OverrunThreshold(std::chrono::milliseconds /*threshold*/)
+        {
+        }
+    };
+
+    /**
+     * @brief Profiler gathering execution time statistics for fixed number of descriptors
+     * @tparam Count Number of descriptors
+     *
+     * Last entry holds statistics of whole mission loop iteration.
+     */
+    template <std::size_t Count> class MissionLoopProfiler
+    {
+      public:
+        /**
+         * @brief Probe measuring descriptors from single mission loop phase
+         */
+        class Probe
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param profiler Profiler that receives measurements
+             * @param offset Index of first descriptor from phase
+             */
+            Probe(MissionLoopProfiler& profiler, std::size_t offset);
+
+            /**
+             * @brief Marks beginning of descriptor execution
+             * @return Start time
+             */
+            std::chrono::milliseconds Begin() const;
+
+            /**
+             * @brief Marks end of descriptor execution
+             * @param index Index of descriptor within phase
+             * @param start Start time returned by @ref Begin
+             */
+            void End(std::size_t index, std::chrono::milliseconds start) const;
+
+          private:
+            /** @brief Profiler */
+            MissionLoopProfiler& _profiler;
+            /** @brief Index of first descriptor from phase */
+            std::size_t _offset;
+        };
+
+        /** @brief Ctor */
+        MissionLoopProfiler();
+
+        /**
+         * @brief Assigns name to profiled element
+         * @param index Element index
+         * @param kind Element kind
+         * @param name Element name
+         */
+        void Assign(std::size_t index, ProfiledElement kind, const char* name);
+
+        /**
+         * @brief Returns probe for single mission loop phase
+         * @param offset Index of first descriptor from phase
+         * @return Probe
+         */
+        Probe Phase(std::size_t offset);
+
+        /**
+         * @brief Returns probe for whole iteration
+         * @return Probe
+         */
+        Probe Iteration();
+
+        /**
+         * @brief Returns gathered statistics
+         * @return Statistics of all elements
+         */
+        gsl::span<const DescriptorTiming> Timings() const;
+
+        /** @brief Clears gathered statistics */
+        void Reset();
+
+        /**
+         * @brief Sets overrun threshold
+         * @param threshold Execution time above which execution is counted as overrun
+         */
+        void OverrunThreshold(std::chrono::milliseconds threshold);
+
+      private:
+        /** @brief Statistics of all descriptors and whole iteration */
+        std::array<DescriptorTiming, Count + 1> _timings;
+
+        /** @brief Overrun threshold */
+        std::chrono::milliseconds _overrunThreshold;
+    };
+
+    template <std::size_t Count>
+    MissionLoopProfiler<Count>::Probe::Probe(MissionLoopProfiler& profiler, std::size_t offset) : _profiler(profiler), _offset(offset)
+    {
+    }
+
+    template <std::size_t Count> inline std::chrono::milliseconds MissionLoopProfiler<Count>::Probe::Begin() const
+    {
+        return System::GetUptime();
+    }
+
+    template <std::size_t Count>
+    inline void MissionLoopProfiler<Count>::Probe::End(std::size_t index, std::chrono::milliseconds start) const
+    {
+        this->_profiler._timings[this->_offset + index].Record(System::GetUptime() - start, this->_profiler._overrunThreshold);
+    }
+
+    template <std::size_t Count> MissionLoopProfiler<Count>::MissionLoopProfiler() : _overrunThreshold(std::chrono::milliseconds::max())
+    {
+        this->_timings[Count].Name = "iteration";
+        this->_timings[Count].Kind = ProfiledElement::Iteration;
+    }
+
+    template <std::size_t Count> void MissionLoopProfiler<Count>::Assign(std::size_t index, ProfiledElement kind, const char* name)
+    {
+        this->_timings[index].Name = name;
+        this->_timings[index].Kind = kind;
+    }
+
+    template <std::size_t Count> inline typename MissionLoopProfiler<Count>::Probe MissionLoopProfiler<Count>::Phase(std::size_t offset)
+    {
+        return Probe(*this, offset);
+    }
+
+    template <std::size_t Count> inline typename MissionLoopProfiler<Count>::Probe MissionLoopProfiler<Count>::Iteration()
+    {
+        return Probe(*this, Count);
+    }
+
+    template <std::size_t Count> gsl::span<const DescriptorTiming> MissionLoopProfiler<Count>::Timings() const
+    {
+        return gsl::make_span(this->_timings);
+    }
+
+    template <std::size_t Count> void MissionLoopProfiler<Count>::Reset()
+    {
+        for (auto& timing : this->_timings)
+        {
+            timing.Reset();
+        }
+    }
+
+    template <std::size_t Count> void MissionLoopProfiler<Count>::OverrunThreshold(std::chrono::milliseconds threshold)
+    {
+        this->_overrunThreshold = threshold;
+    }
+
+    /** @} */
+}
+
+#endif /* LIBS_MISSION_INCLUDE_MISSION_PROFILE_HPP_ */
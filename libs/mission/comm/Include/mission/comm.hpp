@@ -126,6 +126,14 @@ namespace mission
          */
         static bool Condition(const SystemState& state, void* param);
 
+        /**
+         * @brief Determines when next periodic message will be due
+         * @param state System state
+         * @param param Pointer to this task object
+         * @return Time remaining until next periodic message
+         */
+        static Option<std::chrono::milliseconds> NextDue(const SystemState& state, void* param);
+
         /**
          * @brief Sends period messages
          * @param state System state
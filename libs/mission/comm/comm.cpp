@@ -97,10 +97,36 @@ namespace mission
         action.param = this;
         action.condition = Condition;
         action.actionProc = Action;
+        action.nextDue = NextDue;
 
         return action;
     }
 
+    Option<std::chrono::milliseconds> SendMessageTask::NextDue(const SystemState& state, void* param)
+    {
+        auto This = static_cast<SendMessageTask*>(param);
+
+        if (!state.AntennaState.IsDeployed() || !This->_lastSentAt.HasValue)
+        {
+            return None<std::chrono::milliseconds>();
+        }
+
+        state::MessageState settings;
+
+        if (!state.PersistentState.Get(settings))
+        {
+            return None<std::chrono::milliseconds>();
+        }
+
+        const auto dueAt = This->_lastSentAt.Value + settings.Interval();
+        if (dueAt <= state.Time)
+        {
+            return None<std::chrono::milliseconds>();
+        }
+
+        return Some<std::chrono::milliseconds>(dueAt - state.Time);
+    }
+
     bool SendMessageTask::Condition(const SystemState& state, void* param)
     {
         auto This = static_cast<SendMessageTask*>(param);
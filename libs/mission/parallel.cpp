@@ -0,0 +1,79 @@
+#include "parallel.hpp"
+
+namespace mission
+{
+    UpdateWorkerPool::UpdateWorkerPool()
+        : _workers{{{this, UpdateResource::SystemBus, nullptr}, //
+              {this, UpdateResource::PayloadBus, nullptr},      //
+              {this, UpdateResource::Spi, nullptr}}},
+          _job(nullptr),
+          _context(nullptr)
+    {
+    }
+
+    OSResult UpdateWorkerPool::Initialize()
+    {
+        auto result = this->_events.Initialize();
+        if (OS_RESULT_FAILED(result))
+        {
+            return result;
+        }
+
+        for (auto& worker : this->_workers)
+        {
+            result = System::CreateTask(WorkerTask, "UpdateWorker", 4_KB, &worker, TaskPriority::P4, &worker.Handle);
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+        }
+
+        return OSResult::Success;
+    }
+
+    void UpdateWorkerPool::Run(UpdateLaneJob job, void* context, UpdateLanes lanes)
+    {
+        this->_job = job;
+        this->_context = context;
+
+        OSEventBits started = 0;
+        for (const auto& worker : this->_workers)
+        {
+            if ((lanes & LaneOf(worker.Lane)) != 0)
+            {
+                started |= LaneOf(worker.Lane);
+            }
+        }
+
+        if (started != 0)
+        {
+            this->_events.Set(started);
+        }
+
+        if ((lanes & LaneOf(UpdateResource::Cpu)) != 0)
+        {
+            job(context, UpdateResource::Cpu);
+        }
+
+        if (started != 0)
+        {
+            this->_events.WaitAll(started << FinishedShift, true, InfiniteTimeout);
+        }
+    }
+
+    void UpdateWorkerPool::WorkerTask(void* param)
+    {
+        auto worker = static_cast<Worker*>(param);
+        auto pool = worker->Pool;
+        const OSEventBits startBit = LaneOf(worker->Lane);
+
+        for (;;)
+        {
+            pool->_events.WaitAny(startBit, true, InfiniteTimeout);
+
+            pool->_job(pool->_context, worker->Lane);
+
+            pool->_events.Set(startBit << FinishedShift);
+        }
+    }
+}
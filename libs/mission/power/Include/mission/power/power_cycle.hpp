@@ -78,6 +78,14 @@ namespace mission
              */
             static bool Condition(const SystemState& state, void* param);
 
+            /**
+             * @brief Determines when power cycle will be due
+             * @param state System state
+             * @param param Pointer to this task
+             * @return Time remaining until power cycle
+             */
+            static Option<std::chrono::milliseconds> NextDue(const SystemState& state, void* param);
+
             /**
              * @brief Performs power cycle
              * @param state Not used
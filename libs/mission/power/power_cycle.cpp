@@ -20,11 +20,30 @@ namespace mission
             action.name = "Periodic power cycle";
             action.actionProc = Action;
             action.condition = Condition;
+            action.nextDue = NextDue;
             action.param = this;
 
             return action;
         }
 
+        Option<std::chrono::milliseconds> PeriodicPowerCycleTask::NextDue(const SystemState& state, void* param)
+        {
+            auto This = static_cast<PeriodicPowerCycleTask*>(param);
+
+            if (!This->_bootTime.HasValue)
+            {
+                return None<std::chrono::milliseconds>();
+            }
+
+            const auto dueAt = This->_bootTime.Value + PowerCycleTime;
+            if (dueAt <= state.Time)
+            {
+                return None<std::chrono::milliseconds>();
+            }
+
+            return Some<std::chrono::milliseconds>(dueAt - state.Time);
+        }
+
         bool PeriodicPowerCycleTask::Condition(const SystemState& state, void* param)
         {
             auto This = static_cast<PeriodicPowerCycleTask*>(param);
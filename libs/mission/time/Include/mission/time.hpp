@@ -162,6 +162,14 @@ namespace mission
          */
         static bool CorrectTimeCondition(const SystemState& state, void* param);
 
+        /**
+         * @brief Determines when time correction action will be due.
+         * @param[in] state Reference to global mission state.
+         * @param[in] param Current execution context.
+         * @return Time remaining until next time correction.
+         */
+        static Option<std::chrono::milliseconds> CorrectTimeNextDue(const SystemState& state, void* param);
+
         /**
          * @brief Time correction action, that will correct current time based on the external RTC.
          * @param[in] state Reference to global mission state.
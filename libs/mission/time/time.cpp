@@ -71,6 +71,7 @@ namespace mission
         descriptor.param = this;
         descriptor.condition = CorrectTimeCondition;
         descriptor.actionProc = CorrectTimeProxy;
+        descriptor.nextDue = CorrectTimeNextDue;
         return descriptor;
     }
 
@@ -96,6 +97,23 @@ namespace mission
         return (state.Time - timeState.LastMissionTime()) >= TimeCorrectionPeriod;
     }
 
+    Option<milliseconds> TimeTask::CorrectTimeNextDue(const SystemState& state, void* /*param*/)
+    {
+        state::TimeState timeState;
+        if (!state.PersistentState.Get(timeState))
+        {
+            return None<milliseconds>();
+        }
+
+        const auto dueAt = timeState.LastMissionTime() + TimeCorrectionPeriod;
+        if (dueAt <= state.Time)
+        {
+            return None<milliseconds>();
+        }
+
+        return Some(dueAt - state.Time);
+    }
+
     void TimeTask::CorrectTimeProxy(SystemState& state, void* param)
     {
         TimeTask* This = static_cast<TimeTask*>(param);
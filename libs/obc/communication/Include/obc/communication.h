@@ -6,7 +6,10 @@
 #include <tuple>
 #include "adcs/adcs.hpp"
 #include "comm/CommDriver.hpp"
+#include "comm/DownlinkQueue.hpp"
+#include "comm/IHandleFrame.hpp"
 #include "i2c/i2c.h"
+#include "mission/base.hpp"
 #include "mission/comm.hpp"
 #include "mission/time.hpp"
 #include "obc/experiments.hpp"
@@ -14,6 +17,7 @@
 #include "obc/telecommands/adcs.hpp"
 #include "obc/telecommands/antenna.hpp"
 #include "obc/telecommands/boot_settings.hpp"
+#include "obc/telecommands/cancel.hpp"
 #include "obc/telecommands/comm.hpp"
 #include "obc/telecommands/compile_info.hpp"
 #include "obc/telecommands/eps.hpp"
@@ -23,6 +27,7 @@
 #include "obc/telecommands/flash.hpp"
 #include "obc/telecommands/i2c.hpp"
 #include "obc/telecommands/memory.hpp"
+#include "obc/telecommands/mission_profile.hpp"
 #include "obc/telecommands/periodic_message.hpp"
 #include "obc/telecommands/photo.hpp"
 #include "obc/telecommands/ping.hpp"
@@ -31,6 +36,7 @@
 #include "obc/telecommands/sail.hpp"
 #include "obc/telecommands/state.hpp"
 #include "obc/telecommands/suns.hpp"
+#include "obc/telecommands/telemetry_archive.hpp"
 #include "obc/telecommands/time.hpp"
 #include "program_flash/fwd.hpp"
 #include "telecommunication/telecommand_handling.h"
@@ -60,20 +66,22 @@ namespace obc
         TelecommandsHolder(Telecommands&&... telecommands);
 
         /**
-         * @brief Gets list of telecommands
-         * @return List of telecommands
+         * @brief Gets telecommand dispatch table
+         * @return Dispatch table indexed by command code
          */
-        gsl::span<telecommunication::uplink::IHandleTeleCommand*> Get();
+        const telecommunication::uplink::TelecommandTable& Get() const;
 
       private:
         /**
-         * @brief Initialize pointers - single step
+         * @brief Initialize dispatch table - single step
+         *
+         * Entry position is taken from telecommand type so no lookup is needed at runtime.
          */
         template <std::size_t N, typename Head, typename... Rest> void InitPtr()
         {
             auto& ref = std::get<N>(this->_telecommands);
 
-            this->_pointers[N] = reinterpret_cast<telecommunication::uplink::IHandleTeleCommand*>(&ref);
+            this->_table[Head::Code] = &ref;
 
             InitPtr<N + 1, Rest...>();
         }
@@ -87,8 +95,8 @@ namespace obc
 
         /** @brief Telecommand instances */
         std::tuple<Telecommands...> _telecommands;
-        /** @brief Pointers to telecommands */
-        std::array<telecommunication::uplink::IHandleTeleCommand*, sizeof...(Telecommands)> _pointers;
+        /** @brief Telecommand dispatch table */
+        telecommunication::uplink::TelecommandTable _table;
 
         /**
          * @brief Checks if command codes are unique
@@ -117,14 +125,15 @@ namespace obc
     };
 
     template <typename... Telecommands>
-    TelecommandsHolder<Telecommands...>::TelecommandsHolder(Telecommands&&... telecommands) : _telecommands{telecommands...}
+    TelecommandsHolder<Telecommands...>::TelecommandsHolder(Telecommands&&... telecommands) : _telecommands{telecommands...}, _table{}
     {
         InitPtr<0, Telecommands...>();
     }
 
-    template <typename... Telecommands> gsl::span<telecommunication::uplink::IHandleTeleCommand*> TelecommandsHolder<Telecommands...>::Get()
+    template <typename... Telecommands>
+    const telecommunication::uplink::TelecommandTable& TelecommandsHolder<Telecommands...>::Get() const
     {
-        return this->_pointers;
+        return this->_table;
     }
 
     /** @brief Typedef with all supported telecommands */
@@ -170,7 +179,38 @@ namespace obc
         obc::telecommands::SetBuiltinDetumblingBlockMaskTelecommand,
         obc::telecommands::SetAdcsModeTelecommand,
         obc::telecommands::StopSailDeployment,
-        obc::telecommands::ReadMemoryTelecommand>;
+        obc::telecommands::ReadMemoryTelecommand,
+        obc::telecommands::GetMissionLoopProfileTelecommand,
+        obc::telecommands::DownloadTelemetryTelecommand,
+        obc::telecommands::GetReceivePollingStatisticsTelecommand,
+        obc::telecommands::SelectiveDownloadFileTelecommand,
+        obc::telecommands::DownloadCompressedFileTelecommand,
+        obc::telecommands::DownloadFileWithParityTelecommand>;
+
+    /**
+     * @brief Frame handler that wakes up mission loop after each handled frame.
+     *
+     * Telecommands usually change state that is examined by mission actions, waking up mission loop
+     * allows them to react without waiting for next scheduled iteration.
+     */
+    class WakeUpMissionFrameHandler final : public devices::comm::IHandleFrame
+    {
+      public:
+        /**
+         * @brief Ctor
+         * @param[in] handler Frame handler that processes frames
+         * @param[in] wakeUp Mission loop wake up interface
+         */
+        WakeUpMissionFrameHandler(devices::comm::IHandleFrame& handler, mission::IMissionLoopWakeUp& wakeUp);
+
+        virtual void HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame) override;
+
+      private:
+        /** @brief Frame handler that processes frames */
+        devices::comm::IHandleFrame& _handler;
+        /** @brief Mission loop wake up interface */
+        mission::IMissionLoopWakeUp& _wakeUp;
+    };
 
     /**
      * @brief OBC <-> Earth communication
@@ -201,6 +241,10 @@ namespace obc
          * @param[in] photo Reference to service capable of taking photos
          * @param[in] epsDriver Reference to EPS driver object
          * @param[in] adcsCoordinator Reference to Adcs subsystem controller
+         * @param[in] missionProfile Mission loop execution time statistics
+         * @param[in] telemetryProfile Telemetry acquisition loop execution time statistics
+         * @param[in] missionWakeUp Interface used to wake up mission loop after receiving telecommand
+         * @param[in] telemetryArchive Archive of saved telemetry entries
          */
         OBCCommunication(obc::FDIR& fdir,
             devices::comm::CommObject& commDriver,
@@ -223,7 +267,11 @@ namespace obc
             devices::gyro::IGyroscopeDriver& gyro,
             services::photo::IPhotoService& photo,
             devices::eps::IEPSDriver& epsDriver,
-            adcs::IAdcsCoordinator& adcsCoordinator);
+            adcs::IAdcsCoordinator& adcsCoordinator,
+            mission::IMissionLoopProfile& missionProfile,
+            mission::IMissionLoopProfile& telemetryProfile,
+            mission::IMissionLoopWakeUp& missionWakeUp,
+            mission::ITelemetryArchive& telemetryArchive);
 
         /**
          * @brief Initializes all communication at runlevel 1
@@ -238,14 +286,35 @@ namespace obc
         /** @brief Comm driver */
         devices::comm::CommObject& Comm;
 
+        /** @brief Queue of frames waiting for transmission */
+        devices::comm::DownlinkQueue Downlink;
+
         /** @brief Uplink protocol decoder */
         telecommunication::uplink::UplinkProtocol UplinkProtocolDecoder;
 
+        /** @brief Token used to cancel long running telecommands */
+        telecommunication::uplink::CancellationToken Cancellation;
+
+        /** @brief Telecommand that cancels long running telecommand, executed directly by comm task */
+        obc::telecommands::CancelOperationTelecommand CancelTelecommand;
+
         /** @brief Object aggregating supported telecommands */
         Telecommands SupportedTelecommands;
 
+        /** @brief Reassembly of telecommands uplinked in many segments */
+        telecommunication::uplink::SegmentReassembly Reassembly;
+
         /** @brief Incoming telecommand handler */
         telecommunication::uplink::IncomingTelecommandHandler TelecommandHandler;
+
+        /** @brief Frame handler that wakes up mission loop after processing telecommand */
+        WakeUpMissionFrameHandler FrameHandler;
+
+        /** @brief Queue of telecommands executed by background worker task */
+        telecommunication::uplink::AsyncTelecommandHandler TelecommandExecution;
+
+        /** @brief Frame handler that sends telecommand responses through downlink queue */
+        devices::comm::QueuedResponseFrameHandler ResponseHandler;
     };
 
     /** @} */
@@ -33,12 +33,18 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
     devices::gyro::IGyroscopeDriver& gyro,
     services::photo::IPhotoService& photo,
     devices::eps::IEPSDriver& epsDriver,
-    adcs::IAdcsCoordinator& adcsCoordinator)
+    adcs::IAdcsCoordinator& adcsCoordinator,
+    mission::IMissionLoopProfile& missionProfile,
+    mission::IMissionLoopProfile& telemetryProfile,
+    mission::IMissionLoopWakeUp& missionWakeUp,
+    mission::ITelemetryArchive& telemetryArchive)
     : Comm(commDriver),                                                                                                               //
+      Downlink(commDriver, telecommunication::downlink::FramePriority),                                                               //
       UplinkProtocolDecoder(settings::CommSecurityCode),                                                                              //
+      CancelTelecommand(Cancellation),                                                                                                //
       SupportedTelecommands(                                                                                                          //
           PingTelecommand(),                                                                                                          //
-          DownloadFileTelecommand(fs),                                                                                                //
+          DownloadFileTelecommand(fs, Cancellation),                                                                                  //
           EnterIdleStateTelecommand(currentTime, idleStateController),                                                                //
           RemoveFileTelecommand(fs),                                                                                                  //
           SetTimeCorrectionConfigTelecommand(stateContainer),                                                                         //
@@ -84,15 +90,45 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
           SetBuiltinDetumblingBlockMaskTelecommand(stateContainer, adcsCoordinator),                               //
           SetAdcsModeTelecommand(adcsCoordinator),                                                                 //
           StopSailDeployment(stateContainer),
-          obc::telecommands::ReadMemoryTelecommand() //
-          ),                                         //
-      TelecommandHandler(UplinkProtocolDecoder, SupportedTelecommands.Get())
+          obc::telecommands::ReadMemoryTelecommand(Cancellation),                      //
+          GetMissionLoopProfileTelecommand(missionProfile, telemetryProfile),          //
+          DownloadTelemetryTelecommand(telemetryArchive, Cancellation),                //
+          GetReceivePollingStatisticsTelecommand(commDriver),                          //
+          SelectiveDownloadFileTelecommand(fs, Cancellation),                          //
+          DownloadCompressedFileTelecommand(fs, Cancellation),                         //
+          DownloadFileWithParityTelecommand(fs, Cancellation)                          //
+          ),                                                                           //
+      TelecommandHandler(UplinkProtocolDecoder, SupportedTelecommands.Get(), Reassembly),
+      FrameHandler(TelecommandHandler, missionWakeUp),
+      TelecommandExecution(FrameHandler, UplinkProtocolDecoder, CancelTelecommand, Cancellation),
+      ResponseHandler(TelecommandExecution, Downlink)
 {
 }
 
+WakeUpMissionFrameHandler::WakeUpMissionFrameHandler(devices::comm::IHandleFrame& handler, mission::IMissionLoopWakeUp& wakeUp)
+    : _handler(handler), _wakeUp(wakeUp)
+{
+}
+
+void WakeUpMissionFrameHandler::HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame)
+{
+    this->_handler.HandleFrame(transmitter, frame);
+    this->_wakeUp.WakeUp();
+}
+
 void OBCCommunication::InitializeRunlevel1()
 {
-    this->Comm.SetFrameHandler(this->TelecommandHandler);
+    if (OS_RESULT_FAILED(this->Downlink.Initialize()))
+    {
+        LOG(LOG_LEVEL_ERROR, "Unable to initialize downlink queue");
+    }
+
+    if (OS_RESULT_FAILED(this->TelecommandExecution.Initialize()))
+    {
+        LOG(LOG_LEVEL_ERROR, "Unable to initialize telecommand execution queue");
+    }
+
+    this->Comm.SetFrameHandler(this->ResponseHandler);
     if (!this->Comm.RestartHardware())
     {
         LOG(LOG_LEVEL_ERROR, "Unable to restart COMM hardware");
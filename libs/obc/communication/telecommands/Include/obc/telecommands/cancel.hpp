@@ -0,0 +1,45 @@
+#ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_CANCEL_HPP_
+#define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_CANCEL_HPP_
+
+#include "comm/comm.hpp"
+#include "telecommunication/telecommand_execution.hpp"
+#include "telecommunication/telecommand_handling.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        /**
+         * @brief Cancels currently executed long telecommand (file download, memory dump, telemetry archive download).
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * This telecommand is executed immediately by comm task, even when other telecommand is being executed.
+         *
+         * Code: 0xB4
+         * Parameters:
+         *  - 1-byte - correlation ID
+         *
+         * Response (APID: Operation):
+         *  - 1-byte - correlation ID
+         *  - 1-byte - 0 (cancellation requested)
+         */
+        class CancelOperationTelecommand final : public telecommunication::uplink::Telecommand<0xB4>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param cancellation Cancellation token of telecommand execution queue
+             */
+            CancelOperationTelecommand(telecommunication::uplink::CancellationToken& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Cancellation token */
+            telecommunication::uplink::CancellationToken& _cancellation;
+        };
+    }
+}
+
+#endif /* LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_CANCEL_HPP_ */
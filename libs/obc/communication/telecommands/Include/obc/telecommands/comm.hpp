@@ -128,6 +128,43 @@ namespace obc
              */
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
         };
+
+        /**
+         * @brief Download receive polling statistics
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0x2B
+         *
+         * Parameters:
+         *  - 8-bit - Correlation id that will be used in response
+         *
+         * Response (@ref telecommunication::downlink::DownlinkAPID::ReceivePolling):
+         *  - 8-bit - Status: 0 - success, 1 - malformed request
+         *  - 16-bit - Current polling interval in ms
+         *  - 16-bit counters of receive latency histogram buckets
+         *  @see devices::comm::ReceivePollingStatistics
+         */
+        class GetReceivePollingStatisticsTelecommand final : public telecommunication::uplink::Telecommand<0x2B>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param provider Receive polling statistics provider
+             */
+            GetReceivePollingStatisticsTelecommand(const devices::comm::IReceivePollingStatisticsProvider& provider);
+
+            /**
+             * @brief Method called when telecommand is received.
+             * @param[in] transmitter Reference to object that can be used to send response back
+             * @param[in] parameters Parameters contained in telecommand frame
+             */
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Receive polling statistics provider */
+            const devices::comm::IReceivePollingStatisticsProvider& _provider;
+        };
     }
 }
 
@@ -1,8 +1,11 @@
 #ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_FILE_SYSTEM_HPP_
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_FILE_SYSTEM_HPP_
 
+#include <array>
 #include "fs/fs.h"
 #include "telecommunication/downlink.h"
+#include "telecommunication/fec.hpp"
+#include "telecommunication/telecommand_execution.hpp"
 #include "telecommunication/telecommand_handling.h"
 
 namespace obc
@@ -38,6 +41,49 @@ namespace obc
              */
             bool SendPart(std::uint32_t seq);
 
+            /**
+             * @brief Sends single part of file and adds it to the parity group
+             * @param seq Sequence number indicating which part of file should be sent
+             * @param encoder Parity encoder of current group
+             * @param dataIndex Index of the part in the group
+             * @return Operation result
+             */
+            bool SendPart(std::uint32_t seq, telecommunication::fec::ParityEncoder& encoder, std::uint8_t dataIndex);
+
+            /**
+             * @brief Sends single parity chunk of group of parts
+             * @param firstSeq Sequence number of first part in the group
+             * @param encoder Parity encoder of the group
+             * @param parityIndex Index of parity chunk
+             * @return Operation result
+             */
+            bool SendParity(std::uint32_t firstSeq, const telecommunication::fec::ParityEncoder& encoder, std::uint8_t parityIndex);
+
+            /**
+             * @brief Returns number of parts of opened file
+             * @return Number of parts
+             */
+            std::uint32_t PartsCount() const;
+
+            /**
+             * @brief Sends single compressed part of file
+             * @param seq Sequence number of the frame
+             * @param offset Offset of first byte of file included in the part
+             * @param buffer Buffer for uncompressed file data
+             * @param nextOffset Offset of first byte of file not included in the part
+             * @return Operation result
+             *
+             * Part contains as much file data as fits into single frame after compression. Parts are independent
+             * of each other so each of them can be decompressed (and requested again) separately.
+             */
+            bool SendCompressedPart(std::uint32_t seq, std::uint32_t offset, gsl::span<std::uint8_t> buffer, std::uint32_t& nextOffset);
+
+            /**
+             * @brief Returns size of opened file
+             * @return File size
+             */
+            services::fs::FileSize Size() const;
+
             /**
              * @brief Calculates max chunk number for file of given size
              * @param fileSize File size
@@ -45,9 +91,21 @@ namespace obc
              */
             static std::uint32_t MaxChunkNumber(std::uint32_t fileSize);
 
-          private:
             /** @brief Maximum size of file data in a payload */
             static constexpr uint8_t MaxFileDataSize = telecommunication::downlink::DownlinkFrame::MaxPayloadSize - 2;
+
+          private:
+            /**
+             * @brief Sends single part of file and optionally adds it to the parity group
+             * @param seq Sequence number indicating which part of file should be sent
+             * @param encoder Parity encoder of current group or nullptr if parity is not calculated
+             * @param dataIndex Index of the part in the group
+             * @return Operation result
+             */
+            bool SendDataPart(std::uint32_t seq, telecommunication::fec::ParityEncoder* encoder, std::uint8_t dataIndex);
+
+            /** @brief Maximum size of compressed file data in a payload */
+            static constexpr uint8_t MaxCompressedDataSize = telecommunication::downlink::CorrelatedDownlinkFrame::MaxPayloadSize - 11;
             /** @brief File to send */
             services::fs::File _file;
             /** @brief Operation correlation id */
@@ -73,6 +131,8 @@ namespace obc
          *  - String - path to file
          *  - 8-bit - Byte '0'
          *  - Array of 32-bit LE - Sequence numbers of parts that will be send
+         *
+         * Sending remaining parts can be stopped by @ref CancelOperationTelecommand.
          */
         class DownloadFileTelecommand final : public telecommunication::uplink::Telecommand<0xAB>
         {
@@ -86,20 +146,183 @@ namespace obc
                 FileNotFound = 0x01,
                 MalformedRequest = 0x02,
                 InvalidPath = 0x03,
-                TooBigSeq = 0x04
+                TooBigSeq = 0x04,
+                Cancelled = 0x05,
+                SendFailed = 0x06
             };
 
             /**
              * @brief Ctor
              * @param fs File system
+             * @param cancellation Token used to stop sending remaining parts
+             */
+            DownloadFileTelecommand(services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+            /** @brief Cancellation token */
+            const telecommunication::uplink::CancellationToken& _cancellation;
+        };
+
+        /**
+         * @brief Download selected parts of file using compact description of requested parts
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0xB5
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *  - 8-bit - Path length
+         *  - String - path to file
+         *  - 8-bit - Byte '0'
+         *  - 32-bit LE - Sequence number of first described part (cursor)
+         *  - List of selection entries, each describing parts starting at current cursor:
+         *    - Range: 8-bit tag 0x00, 16-bit LE number of skipped parts, 16-bit LE number of requested parts.
+         *      Cursor is moved past both skipped and requested parts.
+         *    - Bitmap: 8-bit tag 0x01, 8-bit bitmap length in bytes, bitmap. Bit i (LSB first) of byte j requests
+         *      part (cursor + 8 * j + i). Cursor is moved past all parts described by bitmap.
+         *
+         * Requested parts beyond the end of file are ignored, so single range with 0xFFFF parts requests entire file.
+         * Parts are sent in the same frames as for @ref DownloadFileTelecommand and each of them waits for free space in
+         * downlink queue, therefore number of parts in flight is limited by its capacity.
+         *
+         * After all parts have been sent (or operation has been stopped) single summary frame is sent:
+         *  - 8-bit - Correlation id
+         *  - 8-bit - Status (@ref DownloadFileTelecommand::ErrorCode)
+         *  - 32-bit LE - Number of sent parts
+         *  - 32-bit LE - Number of all parts of the file
+         *
+         * Sending remaining parts can be stopped by @ref CancelOperationTelecommand.
+         */
+        class SelectiveDownloadFileTelecommand final : public telecommunication::uplink::Telecommand<0xB5>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param fs File system
+             * @param cancellation Token used to stop sending remaining parts
+             */
+            SelectiveDownloadFileTelecommand(services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+            /** @brief Tag of range selection entry */
+            static constexpr std::uint8_t RangeTag = 0x00;
+            /** @brief Tag of bitmap selection entry */
+            static constexpr std::uint8_t BitmapTag = 0x01;
+
+          private:
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+            /** @brief Cancellation token */
+            const telecommunication::uplink::CancellationToken& _cancellation;
+        };
+
+        /**
+         * @brief Download compressed file
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0xB6
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *  - 8-bit - Path length
+         *  - String - path to file
+         *  - 8-bit - Byte '0'
+         *  - 32-bit LE - Offset of first byte that should be sent
+         *  - 8-bit - Maximal number of parts to send, 0 - until end of file
+         *
+         * File data is compressed (@ref lzss) on the fly. Each part is compressed separately and covers as much of the
+         * file as fits into single frame, so padding-heavy files are sent in a fraction of frames. Part contents:
+         *  - 8-bit - Status (@ref DownloadFileTelecommand::ErrorCode)
+         *  - 32-bit LE - Offset of first byte of file in the part
+         *  - 16-bit LE - Number of file bytes in the part
+         *  - 32-bit LE - File size
+         *  - Compressed data
+         *
+         * Lost part is recovered by requesting single part starting at its offset (end of previous part).
+         * In case of error single frame with error code and path is sent.
+         *
+         * Sending remaining parts can be stopped by @ref CancelOperationTelecommand.
+         */
+        class DownloadCompressedFileTelecommand final : public telecommunication::uplink::Telecommand<0xB6>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param fs File system
+             * @param cancellation Token used to stop sending remaining parts
+             */
+            DownloadCompressedFileTelecommand(services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+            /** @brief Maximal number of file bytes in single part */
+            static constexpr std::uint16_t MaxPartInputSize = 2048;
+
+          private:
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+            /** @brief Cancellation token */
+            const telecommunication::uplink::CancellationToken& _cancellation;
+            /** @brief Buffer for uncompressed file data */
+            std::array<std::uint8_t, MaxPartInputSize> _buffer;
+        };
+
+        /**
+         * @brief Download file protected with parity frames
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0xB7
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *  - 8-bit - Path length
+         *  - String - path to file
+         *  - 8-bit - Byte '0'
+         *  - 32-bit LE - Sequence number of first part that should be sent
+         *  - 16-bit LE - Number of parts to send, 0 - until end of file
+         *  - 8-bit - Number of parts in single group (1 - @ref telecommunication::fec::MaxDataCount)
+         *  - 8-bit - Number of parity frames sent after each group (0 - @ref telecommunication::fec::MaxParityCount)
+         *
+         * Parts are sent in the same frames as for @ref DownloadFileTelecommand. After each group of parts parity frames
+         * (@ref fec) are sent, so ground station can reconstruct up to parity count lost parts of the group without
+         * requesting them again. Parity frame contents:
+         *  - 8-bit - Index of parity chunk
+         *  - Parity chunk (same size as file data in full part)
+         *
+         * Parity frame uses sequence number of first part in the group. Last group may contain fewer parts.
+         *
+         * After all parts have been sent (or operation has been stopped) single summary frame is sent, as for
+         * @ref SelectiveDownloadFileTelecommand. Number of sent parts does not include parity frames.
+         *
+         * Sending remaining parts can be stopped by @ref CancelOperationTelecommand.
+         */
+        class DownloadFileWithParityTelecommand final : public telecommunication::uplink::Telecommand<0xB7>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param fs File system
+             * @param cancellation Token used to stop sending remaining parts
              */
-            DownloadFileTelecommand(services::fs::IFileSystem& fs);
+            DownloadFileWithParityTelecommand(services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation);
 
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
 
           private:
             /** @brief File system */
             services::fs::IFileSystem& _fs;
+            /** @brief Cancellation token */
+            const telecommunication::uplink::CancellationToken& _cancellation;
+            /** @brief Parity encoder of group being sent */
+            telecommunication::fec::ParityEncoder _encoder;
         };
 
         /**
@@ -2,6 +2,7 @@
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_MEMORY_HPP_
 
 #include "comm/comm.hpp"
+#include "telecommunication/telecommand_execution.hpp"
 #include "telecommunication/telecommand_handling.h"
 
 namespace obc
@@ -17,11 +18,24 @@ namespace obc
          * - Correlation ID (8-bit)
          * - Offset (32-bit)
          * - Size (32-bit)
+         *
+         * Dump can be stopped by @ref CancelOperationTelecommand, in such case frame with APID Operation and status 2 is
+         * sent after last memory frame.
          */
         class ReadMemoryTelecommand : public telecommunication::uplink::Telecommand<0x29>
         {
           public:
+            /**
+             * @brief Ctor
+             * @param cancellation Token used to stop memory dump
+             */
+            ReadMemoryTelecommand(const telecommunication::uplink::CancellationToken& cancellation);
+
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Cancellation token */
+            const telecommunication::uplink::CancellationToken& _cancellation;
         };
     }
 }
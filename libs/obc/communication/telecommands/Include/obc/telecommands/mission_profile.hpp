@@ -0,0 +1,57 @@
+#ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_MISSION_PROFILE_HPP_
+#define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_MISSION_PROFILE_HPP_
+
+#include "comm/comm.hpp"
+#include "mission/profile.hpp"
+#include "telecommunication/telecommand_handling.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        /**
+         * @brief Telecommand for downloading mission loop execution time statistics
+         * @telecommand
+         * @ingroup telecommands
+         *
+         * Parameters:
+         * - Correlation ID (8-bit)
+         * - Mission loop (8-bit): 0 - mission, 1 - telemetry acquisition
+         * - Index of first requested entry (8-bit)
+         *
+         * Response (@ref telecommunication::downlink::DownlinkAPID::MissionLoopProfile):
+         * - Status (8-bit): 0 - success, 1 - malformed request
+         * - Total number of entries (8-bit), 0 if profiling is disabled
+         * - Index of first entry in frame (8-bit)
+         * - Entries, as many as fit into frame:
+         *   - Kind (8-bit): 0 - update, 1 - verify, 2 - action, 3 - whole iteration
+         *   - Name length (8-bit) followed by name (up to @ref MaxNameLength characters)
+         *   - Number of runs (32-bit)
+         *   - Min, average, max and last execution time in ms (4 x 32-bit)
+         *   - Number of overruns (16-bit)
+         */
+        class GetMissionLoopProfileTelecommand : public telecommunication::uplink::Telecommand<0x2A>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param mission Mission loop profile
+             * @param telemetry Telemetry acquisition loop profile
+             */
+            GetMissionLoopProfileTelecommand(mission::IMissionLoopProfile& mission, mission::IMissionLoopProfile& telemetry);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+            /** @brief Maximal length of entry name */
+            static constexpr std::uint8_t MaxNameLength = 16;
+
+          private:
+            /** @brief Mission loop profile */
+            mission::IMissionLoopProfile& _mission;
+            /** @brief Telemetry acquisition loop profile */
+            mission::IMissionLoopProfile& _telemetry;
+        };
+    }
+}
+
+#endif /* LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_MISSION_PROFILE_HPP_ */
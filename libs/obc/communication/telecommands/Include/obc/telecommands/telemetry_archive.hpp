@@ -0,0 +1,57 @@
+#ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_TELEMETRY_ARCHIVE_HPP_
+#define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_TELEMETRY_ARCHIVE_HPP_
+
+#include "comm/comm.hpp"
+#include "mission/telemetry.hpp"
+#include "telecommunication/telecommand_execution.hpp"
+#include "telecommunication/telecommand_handling.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        /**
+         * @brief Telecommand for downloading archived telemetry entries saved within requested mission time window
+         * @telecommand
+         * @ingroup telecommands
+         *
+         * Command code: 0xB3
+         *
+         * Parameters:
+         * - Correlation ID (8-bit)
+         * - Beginning of time window in ms (64-bit LE, mission time)
+         * - End of time window in ms (64-bit LE, mission time, inclusive)
+         *
+         * Response (@ref telecommunication::downlink::DownlinkAPID::TelemetryArchive), one frame per entry:
+         * - Status (8-bit): 0 - success
+         * - Serialized telemetry entry (as stored in telemetry file)
+         *
+         * Followed by final frame:
+         * - Status (8-bit): 1 - malformed request, 2 - telemetry archive not found, 3 - completed, 4 - cancelled
+         * - Number of sent entries (32-bit LE), only for status 'completed' and 'cancelled'
+         *
+         * Sequence numbers of response frames start at 0 and are incremented with every frame.
+         */
+        class DownloadTelemetryTelecommand final : public telecommunication::uplink::Telecommand<0xB3>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param archive Telemetry archive
+             * @param cancellation Token used to stop download before all entries are sent
+             */
+            DownloadTelemetryTelecommand(
+                mission::ITelemetryArchive& archive, const telecommunication::uplink::CancellationToken& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Telemetry archive */
+            mission::ITelemetryArchive& _archive;
+            /** @brief Cancellation token */
+            const telecommunication::uplink::CancellationToken& _cancellation;
+        };
+    }
+}
+
+#endif /* LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_TELEMETRY_ARCHIVE_HPP_ */
@@ -0,0 +1,38 @@
+#include "cancel.hpp"
+#include "base/reader.h"
+#include "comm/ITransmitter.hpp"
+#include "logger/logger.h"
+#include "telecommunication/downlink.h"
+
+using telecommunication::downlink::CorrelatedDownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+
+namespace obc
+{
+    namespace telecommands
+    {
+        CancelOperationTelecommand::CancelOperationTelecommand(telecommunication::uplink::CancellationToken& cancellation)
+            : _cancellation(cancellation)
+        {
+        }
+
+        void CancelOperationTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            const auto correlationId = r.ReadByte();
+
+            if (!r.Status())
+            {
+                LOG(LOG_LEVEL_ERROR, "[tc] Malformed cancel request");
+                return;
+            }
+
+            LOG(LOG_LEVEL_INFO, "[tc] Cancelling current operation");
+            this->_cancellation.Cancel();
+
+            CorrelatedDownlinkFrame response(DownlinkAPID::Operation, 0, correlationId);
+            response.PayloadWriter().WriteByte(0);
+            transmitter.SendFrame(response.Frame());
+        }
+    }
+}
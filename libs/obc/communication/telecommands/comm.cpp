@@ -11,6 +11,7 @@
 
 using telecommunication::downlink::CorrelatedDownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkGenericResponse;
 
 namespace obc
 {
@@ -136,5 +137,40 @@ namespace obc
             response.PayloadWriter().WriteByte(0);
             transmitter.SendFrame(response.Frame());
         }
+
+        GetReceivePollingStatisticsTelecommand::GetReceivePollingStatisticsTelecommand(
+            const devices::comm::IReceivePollingStatisticsProvider& provider)
+            : _provider(provider)
+        {
+        }
+
+        void GetReceivePollingStatisticsTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+
+            CorrelatedDownlinkFrame response(DownlinkAPID::ReceivePolling, 0, correlationId);
+            auto& writer = response.PayloadWriter();
+
+            if (!r.Status())
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                writer.WriteByte(num(DownlinkGenericResponse::MalformedRequest));
+                transmitter.SendFrame(response.Frame());
+                return;
+            }
+
+            const auto statistics = this->_provider.GetReceivePollingStatistics();
+
+            writer.WriteByte(num(DownlinkGenericResponse::Success));
+            writer.WriteWordLE(static_cast<std::uint16_t>(statistics.Interval.count()));
+            for (auto bucket : statistics.Latency)
+            {
+                writer.WriteWordLE(bucket);
+            }
+
+            transmitter.SendFrame(response.Frame());
+        }
     }
 }
@@ -1,6 +1,8 @@
 #include "file_system.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include "base/lzss.hpp"
 #include "base/reader.h"
 #include "comm/ITransmitter.hpp"
 #include "fs/fs.h"
@@ -10,6 +12,7 @@
 
 using telecommunication::downlink::CorrelatedDownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::TransmitterDownlinkFrame;
 using services::fs::File;
 using services::fs::SeekOrigin;
 
@@ -40,14 +43,80 @@ namespace obc
             return this->_file;
         }
 
+        std::uint32_t FileSender::PartsCount() const
+        {
+            return MaxChunkNumber(this->_fileSize);
+        }
+
+        services::fs::FileSize FileSender::Size() const
+        {
+            return this->_fileSize;
+        }
+
+        bool FileSender::SendCompressedPart(std::uint32_t seq, std::uint32_t offset, gsl::span<std::uint8_t> buffer, std::uint32_t& nextOffset)
+        {
+            if (offset > this->_fileSize)
+            {
+                return false;
+            }
+
+            if (OS_RESULT_FAILED(this->_file.Seek(SeekOrigin::Begin, offset)))
+            {
+                return false;
+            }
+
+            const auto read = this->_file.Read(buffer.subspan(0, std::min<std::size_t>(buffer.size(), this->_fileSize - offset)));
+            if (!read)
+            {
+                return false;
+            }
+
+            TransmitterDownlinkFrame response(this->_transmitter, DownlinkAPID::FileSendCompressed, seq, _correlationId);
+            if (!response.IsValid())
+            {
+                return false;
+            }
+
+            auto& writer = response.PayloadWriter();
+            writer.WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Success));
+            writer.WriteDoubleWordLE(offset);
+            auto consumedField = writer.Reserve(sizeof(std::uint16_t));
+            writer.WriteDoubleWordLE(this->_fileSize);
+
+            // compress directly into the frame, then claim only the part that has been produced
+            Writer probe = writer;
+            const auto result = lzss::Compress(read.Result, probe.Reserve(MaxCompressedDataSize));
+            writer.Reserve(result.Produced);
+
+            Writer(consumedField).WriteWordLE(static_cast<std::uint16_t>(result.Consumed));
+
+            nextOffset = offset + result.Consumed;
+
+            return response.Send();
+        }
+
         bool FileSender::SendPart(std::uint32_t seq)
+        {
+            return SendDataPart(seq, nullptr, 0);
+        }
+
+        bool FileSender::SendPart(std::uint32_t seq, telecommunication::fec::ParityEncoder& encoder, std::uint8_t dataIndex)
+        {
+            return SendDataPart(seq, &encoder, dataIndex);
+        }
+
+        bool FileSender::SendDataPart(std::uint32_t seq, telecommunication::fec::ParityEncoder* encoder, std::uint8_t dataIndex)
         {
             if (seq > this->_lastSeq)
             {
                 return false;
             }
 
-            CorrelatedDownlinkFrame response(DownlinkAPID::FileSend, seq, _correlationId);
+            TransmitterDownlinkFrame response(this->_transmitter, DownlinkAPID::FileSend, seq, _correlationId);
+            if (!response.IsValid())
+            {
+                return false;
+            }
 
             if (OS_RESULT_FAILED(this->_file.Seek(SeekOrigin::Begin, seq * MaxFileDataSize)))
             {
@@ -60,12 +129,44 @@ namespace obc
 
             auto buf = response.PayloadWriter().Reserve(segmentSize);
 
-            this->_file.Read(buf);
+            const auto read = this->_file.Read(buf);
+            if (!read)
+            {
+                return false;
+            }
 
-            return this->_transmitter.SendFrame(response.Frame());
+            // part is encoded straight from the frame so file data is never copied
+            if (encoder != nullptr && !encoder->Add(dataIndex, read.Result))
+            {
+                return false;
+            }
+
+            return response.Send();
         }
 
-        DownloadFileTelecommand::DownloadFileTelecommand(services::fs::IFileSystem& fs) : _fs(fs)
+        bool FileSender::SendParity(std::uint32_t firstSeq, const telecommunication::fec::ParityEncoder& encoder, std::uint8_t parityIndex)
+        {
+            const auto parity = encoder.Parity(parityIndex);
+            if (parity.empty())
+            {
+                return false;
+            }
+
+            TransmitterDownlinkFrame response(this->_transmitter, DownlinkAPID::FileSendParity, firstSeq, _correlationId);
+            if (!response.IsValid())
+            {
+                return false;
+            }
+
+            response.PayloadWriter().WriteByte(parityIndex);
+            response.PayloadWriter().WriteArray(parity);
+
+            return response.Send();
+        }
+
+        DownloadFileTelecommand::DownloadFileTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation)
+            : _fs(fs), _cancellation(cancellation)
         {
         }
 
@@ -127,6 +228,18 @@ namespace obc
                 {
                     break;
                 }
+
+                if (this->_cancellation.IsCancelled())
+                {
+                    LOG(LOG_LEVEL_INFO, "File download cancelled");
+                    CorrelatedDownlinkFrame cancelResponse(DownlinkAPID::FileSend, seq, correlationId);
+                    cancelResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Cancelled));
+                    cancelResponse.PayloadWriter().WriteArray(pathSpan);
+
+                    transmitter.SendFrame(cancelResponse.Frame());
+                    break;
+                }
+
                 LOGF(LOG_LEVEL_DEBUG, "Sending seq %ld", seq);
 
                 if (!sender.SendPart(seq))
@@ -140,6 +253,369 @@ namespace obc
             }
         }
 
+        /**
+         * @brief Sends summary frame of file download
+         * @param transmitter Transmitter
+         * @param correlationId Operation correlation id
+         * @param status Operation status
+         * @param sent Number of sent parts
+         * @param partsCount Number of all parts of the file
+         */
+        static void SendSummary(devices::comm::ITransmitter& transmitter,
+            std::uint8_t correlationId,
+            DownloadFileTelecommand::ErrorCode status,
+            std::uint32_t sent,
+            std::uint32_t partsCount)
+        {
+            CorrelatedDownlinkFrame response(DownlinkAPID::FileSendSummary, 0, correlationId);
+            response.PayloadWriter().WriteByte(num(status));
+            response.PayloadWriter().WriteDoubleWordLE(sent);
+            response.PayloadWriter().WriteDoubleWordLE(partsCount);
+
+            transmitter.SendFrame(response.Frame());
+        }
+
+        constexpr std::uint8_t SelectiveDownloadFileTelecommand::RangeTag;
+        constexpr std::uint8_t SelectiveDownloadFileTelecommand::BitmapTag;
+
+        /**
+         * @brief Walks over parts selected by list of selection entries
+         * @param selection Encoded list of selection entries
+         * @param first Sequence number of first described part
+         * @param partsCount Number of parts of the file, parts beyond it are skipped
+         * @param action Callable invoked with sequence number of each selected part, returns false to stop walking
+         * @return true if entire list has been walked, false if list is malformed or action stopped walking
+         */
+        template <typename Action>
+        static bool ForEachSelectedPart(gsl::span<const std::uint8_t> selection, std::uint32_t first, std::uint32_t partsCount, Action&& action)
+        {
+            Reader r(selection);
+            std::uint64_t cursor = first;
+
+            while (r.RemainingSize() > 0)
+            {
+                const auto tag = r.ReadByte();
+
+                if (tag == SelectiveDownloadFileTelecommand::RangeTag)
+                {
+                    const auto skip = r.ReadWordLE();
+                    const auto count = r.ReadWordLE();
+
+                    if (!r.Status())
+                    {
+                        return false;
+                    }
+
+                    const auto begin = cursor + skip;
+                    cursor = begin + count;
+
+                    for (auto seq = begin; seq < std::min<std::uint64_t>(cursor, partsCount); seq++)
+                    {
+                        if (!action(static_cast<std::uint32_t>(seq)))
+                        {
+                            return false;
+                        }
+                    }
+                }
+                else if (tag == SelectiveDownloadFileTelecommand::BitmapTag)
+                {
+                    const auto length = r.ReadByte();
+                    const auto bitmap = r.ReadArray(length);
+
+                    if (!r.Status())
+                    {
+                        return false;
+                    }
+
+                    for (std::uint16_t bit = 0; bit < 8 * length && cursor + bit < partsCount; bit++)
+                    {
+                        if ((bitmap[bit / 8] & (1 << (bit % 8))) != 0 &&
+                            !action(static_cast<std::uint32_t>(cursor + bit)))
+                        {
+                            return false;
+                        }
+                    }
+
+                    cursor += 8 * length;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        SelectiveDownloadFileTelecommand::SelectiveDownloadFileTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation)
+            : _fs(fs), _cancellation(cancellation)
+        {
+        }
+
+        void SelectiveDownloadFileTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            using ErrorCode = DownloadFileTelecommand::ErrorCode;
+
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto pathLength = r.ReadByte();
+            auto pathSpan = r.ReadArray(pathLength);
+            auto path = reinterpret_cast<const char*>(pathSpan.data());
+            auto terminationByte = r.ReadByte();
+            auto first = r.ReadDoubleWordLE();
+            auto selection = r.ReadToEnd();
+
+            if (!r.Status() || terminationByte != 0)
+            {
+                LOG(LOG_LEVEL_ERROR, "Selective download: malformed request");
+                SendSummary(transmitter, correlationId, ErrorCode::MalformedRequest, 0, 0);
+                return;
+            }
+
+            if (_fs.IsDirectory(path))
+            {
+                LOGF(LOG_LEVEL_ERROR, "Trying to retrieve directory %s", path);
+                SendSummary(transmitter, correlationId, ErrorCode::InvalidPath, 0, 0);
+                return;
+            }
+
+            FileSender sender(path, correlationId, transmitter, this->_fs);
+
+            if (!sender.IsValid())
+            {
+                LOG(LOG_LEVEL_ERROR, "Unable to open requested file");
+                SendSummary(transmitter, correlationId, ErrorCode::FileNotFound, 0, 0);
+                return;
+            }
+
+            const auto partsCount = sender.PartsCount();
+
+            if (!ForEachSelectedPart(selection, first, partsCount, [](std::uint32_t) { return true; }))
+            {
+                LOG(LOG_LEVEL_ERROR, "Selective download: malformed selection");
+                SendSummary(transmitter, correlationId, ErrorCode::MalformedRequest, 0, partsCount);
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sending selected parts of file %s", path);
+
+            auto status = ErrorCode::Success;
+            std::uint32_t sent = 0;
+
+            ForEachSelectedPart(selection, first, partsCount, [this, &sender, &status, &sent](std::uint32_t seq) {
+                if (this->_cancellation.IsCancelled())
+                {
+                    status = ErrorCode::Cancelled;
+                    return false;
+                }
+
+                if (!sender.SendPart(seq))
+                {
+                    status = ErrorCode::SendFailed;
+                    return false;
+                }
+
+                sent++;
+                return true;
+            });
+
+            LOGF(LOG_LEVEL_INFO, "Sent %ld of %ld parts, status %d",
+                static_cast<long>(sent),
+                static_cast<long>(partsCount),
+                static_cast<int>(status));
+
+            SendSummary(transmitter, correlationId, status, sent, partsCount);
+        }
+
+        constexpr std::uint16_t DownloadCompressedFileTelecommand::MaxPartInputSize;
+
+        DownloadCompressedFileTelecommand::DownloadCompressedFileTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation)
+            : _fs(fs), _cancellation(cancellation)
+        {
+        }
+
+        void DownloadCompressedFileTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto pathLength = r.ReadByte();
+            auto pathSpan = r.ReadArray(pathLength);
+            auto path = reinterpret_cast<const char*>(pathSpan.data());
+            auto terminationByte = r.ReadByte();
+            auto offset = r.ReadDoubleWordLE();
+            auto maxParts = r.ReadByte();
+
+            auto sendError = [&transmitter, correlationId, pathSpan](std::uint32_t seq, DownloadFileTelecommand::ErrorCode error) {
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSendCompressed, seq, correlationId);
+                errorResponse.PayloadWriter().WriteByte(num(error));
+                errorResponse.PayloadWriter().WriteArray(pathSpan);
+
+                transmitter.SendFrame(errorResponse.Frame());
+            };
+
+            if (!r.Status() || terminationByte != 0)
+            {
+                LOG(LOG_LEVEL_ERROR, "Compressed download: malformed request");
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSendCompressed, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(num(DownloadFileTelecommand::ErrorCode::MalformedRequest));
+                transmitter.SendFrame(errorResponse.Frame());
+                return;
+            }
+
+            if (_fs.IsDirectory(path))
+            {
+                LOGF(LOG_LEVEL_ERROR, "Trying to retrieve directory %s", path);
+                sendError(0, DownloadFileTelecommand::ErrorCode::InvalidPath);
+                return;
+            }
+
+            FileSender sender(path, correlationId, transmitter, this->_fs);
+
+            if (!sender.IsValid())
+            {
+                LOG(LOG_LEVEL_ERROR, "Unable to open requested file");
+                sendError(0, DownloadFileTelecommand::ErrorCode::FileNotFound);
+                return;
+            }
+
+            if (offset >= sender.Size() && sender.Size() > 0)
+            {
+                sendError(0, DownloadFileTelecommand::ErrorCode::TooBigSeq);
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sending compressed file %s from offset %ld", path, static_cast<long>(offset));
+
+            std::uint32_t seq = 0;
+            do
+            {
+                if (this->_cancellation.IsCancelled())
+                {
+                    LOG(LOG_LEVEL_INFO, "Compressed file download cancelled");
+                    sendError(seq, DownloadFileTelecommand::ErrorCode::Cancelled);
+                    break;
+                }
+
+                if (!sender.SendCompressedPart(seq, offset, this->_buffer, offset))
+                {
+                    LOGF(LOG_LEVEL_ERROR, "Unable to send compressed part at offset %ld", static_cast<long>(offset));
+                    sendError(seq, DownloadFileTelecommand::ErrorCode::SendFailed);
+                    break;
+                }
+
+                seq++;
+            } while ((maxParts == 0 || seq < maxParts) && offset < sender.Size());
+        }
+
+        DownloadFileWithParityTelecommand::DownloadFileWithParityTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::CancellationToken& cancellation)
+            : _fs(fs), _cancellation(cancellation)
+        {
+        }
+
+        void DownloadFileWithParityTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            using ErrorCode = DownloadFileTelecommand::ErrorCode;
+
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto pathLength = r.ReadByte();
+            auto pathSpan = r.ReadArray(pathLength);
+            auto path = reinterpret_cast<const char*>(pathSpan.data());
+            auto terminationByte = r.ReadByte();
+            auto first = r.ReadDoubleWordLE();
+            auto count = r.ReadWordLE();
+            auto groupSize = r.ReadByte();
+            auto parityCount = r.ReadByte();
+
+            if (!r.Status() || terminationByte != 0 || groupSize == 0 || groupSize > telecommunication::fec::MaxDataCount ||
+                !this->_encoder.Reset(parityCount, FileSender::MaxFileDataSize))
+            {
+                LOG(LOG_LEVEL_ERROR, "Parity download: malformed request");
+                SendSummary(transmitter, correlationId, ErrorCode::MalformedRequest, 0, 0);
+                return;
+            }
+
+            if (_fs.IsDirectory(path))
+            {
+                LOGF(LOG_LEVEL_ERROR, "Trying to retrieve directory %s", path);
+                SendSummary(transmitter, correlationId, ErrorCode::InvalidPath, 0, 0);
+                return;
+            }
+
+            FileSender sender(path, correlationId, transmitter, this->_fs);
+
+            if (!sender.IsValid())
+            {
+                LOG(LOG_LEVEL_ERROR, "Unable to open requested file");
+                SendSummary(transmitter, correlationId, ErrorCode::FileNotFound, 0, 0);
+                return;
+            }
+
+            const auto partsCount = sender.PartsCount();
+
+            if (first >= partsCount && partsCount > 0)
+            {
+                SendSummary(transmitter, correlationId, ErrorCode::TooBigSeq, 0, partsCount);
+                return;
+            }
+
+            const auto end = count == 0 ? partsCount : std::min<std::uint64_t>(static_cast<std::uint64_t>(first) + count, partsCount);
+
+            LOGF(LOG_LEVEL_INFO, "Sending file %s with %d parity frames per %d parts", path, parityCount, groupSize);
+
+            auto status = ErrorCode::Success;
+            std::uint32_t sent = 0;
+
+            for (std::uint32_t groupStart = first; groupStart < end && status == ErrorCode::Success; groupStart += groupSize)
+            {
+                this->_encoder.Reset(parityCount, FileSender::MaxFileDataSize);
+
+                const auto groupEnd = std::min<std::uint64_t>(static_cast<std::uint64_t>(groupStart) + groupSize, end);
+
+                for (std::uint32_t seq = groupStart; seq < groupEnd; seq++)
+                {
+                    if (this->_cancellation.IsCancelled())
+                    {
+                        status = ErrorCode::Cancelled;
+                        break;
+                    }
+
+                    if (!sender.SendPart(seq, this->_encoder, static_cast<std::uint8_t>(seq - groupStart)))
+                    {
+                        status = ErrorCode::SendFailed;
+                        break;
+                    }
+
+                    sent++;
+                }
+
+                for (std::uint8_t parityIndex = 0; parityIndex < parityCount && status == ErrorCode::Success; parityIndex++)
+                {
+                    if (this->_cancellation.IsCancelled())
+                    {
+                        status = ErrorCode::Cancelled;
+                    }
+                    else if (!sender.SendParity(groupStart, this->_encoder, parityIndex))
+                    {
+                        status = ErrorCode::SendFailed;
+                    }
+                }
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sent %ld of %ld parts, status %d",
+                static_cast<long>(sent),
+                static_cast<long>(partsCount),
+                static_cast<int>(status));
+
+            SendSummary(transmitter, correlationId, status, sent, partsCount);
+        }
+
         RemoveFileTelecommand::RemoveFileTelecommand(services::fs::IFileSystem& fs) : _fs(fs)
         {
         }
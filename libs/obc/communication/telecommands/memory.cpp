@@ -13,6 +13,11 @@ namespace obc
         using telecommunication::downlink::CorrelatedDownlinkFrame;
         using telecommunication::downlink::DownlinkAPID;
 
+        ReadMemoryTelecommand::ReadMemoryTelecommand(const telecommunication::uplink::CancellationToken& cancellation)
+            : _cancellation(cancellation)
+        {
+        }
+
         void ReadMemoryTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
         {
             Reader r(parameters);
@@ -37,6 +42,15 @@ namespace obc
 
             while (size > 0)
             {
+                if (this->_cancellation.IsCancelled())
+                {
+                    CorrelatedDownlinkFrame frame(DownlinkAPID::Operation, 0, correlationId);
+                    frame.PayloadWriter().WriteByte(2);
+
+                    transmitter.SendFrame(frame.Frame());
+                    return;
+                }
+
                 auto partSize = std::min<std::size_t>(size, CorrelatedDownlinkFrame::MaxPayloadSize);
                 CorrelatedDownlinkFrame frame(DownlinkAPID::MemoryContent, seq, correlationId);
 
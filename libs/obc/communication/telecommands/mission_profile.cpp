@@ -0,0 +1,82 @@
+#include "mission_profile.hpp"
+#include <algorithm>
+#include <cstring>
+#include "base/reader.h"
+#include "comm/ITransmitter.hpp"
+#include "telecommunication/downlink.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        using telecommunication::downlink::CorrelatedDownlinkFrame;
+        using telecommunication::downlink::DownlinkAPID;
+        using telecommunication::downlink::DownlinkFrame;
+        using telecommunication::downlink::DownlinkGenericResponse;
+
+        /** @brief Size of single entry without name */
+        static constexpr std::size_t EntryHeaderSize = 2 + 4 + 4 * 4 + 2;
+
+        static bool WriteEntry(Writer& writer, const mission::DescriptorTiming& timing)
+        {
+            const auto nameLength = std::min<std::size_t>(std::strlen(timing.Name), GetMissionLoopProfileTelecommand::MaxNameLength);
+
+            if (writer.GetDataLength() + EntryHeaderSize + nameLength > DownlinkFrame::MaxPayloadSize)
+            {
+                return false;
+            }
+
+            writer.WriteByte(num(timing.Kind));
+            writer.WriteByte(static_cast<std::uint8_t>(nameLength));
+            writer.WriteArray(gsl::make_span(reinterpret_cast<const std::uint8_t*>(timing.Name), nameLength));
+            writer.WriteDoubleWordLE(timing.Runs);
+            writer.WriteDoubleWordLE(static_cast<std::uint32_t>(timing.Min.count()));
+            writer.WriteDoubleWordLE(static_cast<std::uint32_t>(timing.Average().count()));
+            writer.WriteDoubleWordLE(static_cast<std::uint32_t>(timing.Max.count()));
+            writer.WriteDoubleWordLE(static_cast<std::uint32_t>(timing.Last.count()));
+            writer.WriteWordLE(timing.Overruns);
+
+            return true;
+        }
+
+        GetMissionLoopProfileTelecommand::GetMissionLoopProfileTelecommand(
+            mission::IMissionLoopProfile& mission, mission::IMissionLoopProfile& telemetry)
+            : _mission(mission), _telemetry(telemetry)
+        {
+        }
+
+        void GetMissionLoopProfileTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            auto correlationId = r.ReadByte();
+            auto loop = r.ReadByte();
+            auto firstEntry = r.ReadByte();
+
+            CorrelatedDownlinkFrame frame(DownlinkAPID::MissionLoopProfile, 0, correlationId);
+            auto& writer = frame.PayloadWriter();
+
+            if (!r.Status() || loop > 1)
+            {
+                writer.WriteByte(num(DownlinkGenericResponse::MalformedRequest));
+                transmitter.SendFrame(frame.Frame());
+                return;
+            }
+
+            auto timings = (loop == 0 ? this->_mission : this->_telemetry).Timings();
+
+            writer.WriteByte(num(DownlinkGenericResponse::Success));
+            writer.WriteByte(static_cast<std::uint8_t>(timings.size()));
+            writer.WriteByte(firstEntry);
+
+            for (auto i = static_cast<std::ptrdiff_t>(firstEntry); i < timings.size(); i++)
+            {
+                if (!WriteEntry(writer, timings[i]))
+                {
+                    break;
+                }
+            }
+
+            transmitter.SendFrame(frame.Frame());
+        }
+    }
+}
@@ -0,0 +1,165 @@
+#include "telemetry_archive.hpp"
+#include "base/reader.h"
+#include "comm/ITransmitter.hpp"
+#include "logger/logger.h"
+#include "telecommunication/downlink.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        using telecommunication::downlink::CorrelatedDownlinkFrame;
+        using telecommunication::downlink::DownlinkAPID;
+        using telecommunication::downlink::DownlinkGenericResponse;
+
+        /**
+         * @brief Status of final response frame
+         */
+        enum class DownloadTelemetryStatus : std::uint8_t
+        {
+            NotFound = 2, //!< Telemetry archive does not exist
+            Completed = 3, //!< All entries from time window have been sent
+            Cancelled = 4  //!< Download has been cancelled before all entries have been sent
+        };
+
+        namespace
+        {
+            /**
+             * @brief Receiver that sends each telemetry entry in separate frame
+             */
+            class EntrySender final : public mission::ITelemetryEntryReceiver
+            {
+              public:
+                /**
+                 * @brief Ctor
+                 * @param transmitter Transmitter
+                 * @param correlationId Operation correlation id
+                 * @param cancellation Cancellation token
+                 */
+                EntrySender(devices::comm::ITransmitter& transmitter,
+                    std::uint8_t correlationId,
+                    const telecommunication::uplink::CancellationToken& cancellation);
+
+                virtual bool Receive(std::chrono::milliseconds time, gsl::span<const std::uint8_t> entry) override;
+
+                /**
+                 * @brief Sends final frame
+                 * @param status Operation status
+                 * @param writeCount Flag indicating whether number of sent entries should be included
+                 */
+                void Finish(std::uint8_t status, bool writeCount);
+
+                /**
+                 * @brief Checks whether download has been stopped by cancellation request
+                 * @return true if download has been cancelled
+                 */
+                bool IsCancelled() const;
+
+              private:
+                /** @brief Transmitter */
+                devices::comm::ITransmitter& _transmitter;
+                /** @brief Operation correlation id */
+                std::uint8_t _correlationId;
+                /** @brief Cancellation token */
+                const telecommunication::uplink::CancellationToken& _cancellation;
+                /** @brief Sequence number of next frame */
+                std::uint32_t _seq;
+            };
+
+            EntrySender::EntrySender(devices::comm::ITransmitter& transmitter,
+                std::uint8_t correlationId,
+                const telecommunication::uplink::CancellationToken& cancellation)
+                : _transmitter(transmitter), _correlationId(correlationId), _cancellation(cancellation), _seq(0)
+            {
+            }
+
+            bool EntrySender::Receive(std::chrono::milliseconds /*time*/, gsl::span<const std::uint8_t> entry)
+            {
+                if (IsCancelled())
+                {
+                    return false;
+                }
+
+                CorrelatedDownlinkFrame frame(DownlinkAPID::TelemetryArchive, this->_seq, this->_correlationId);
+                auto& writer = frame.PayloadWriter();
+                writer.WriteByte(num(DownlinkGenericResponse::Success));
+                writer.WriteArray(entry);
+
+                if (!writer.Status())
+                {
+                    LOG(LOG_LEVEL_ERROR, "[tm] Telemetry entry does not fit into frame");
+                    return false;
+                }
+
+                if (!this->_transmitter.SendFrame(frame.Frame()))
+                {
+                    LOG(LOG_LEVEL_ERROR, "[tm] Unable to send telemetry entry");
+                    return false;
+                }
+
+                this->_seq++;
+                return true;
+            }
+
+            void EntrySender::Finish(std::uint8_t status, bool writeCount)
+            {
+                CorrelatedDownlinkFrame frame(DownlinkAPID::TelemetryArchive, this->_seq, this->_correlationId);
+                auto& writer = frame.PayloadWriter();
+                writer.WriteByte(status);
+                if (writeCount)
+                {
+                    writer.WriteDoubleWordLE(this->_seq);
+                }
+
+                this->_transmitter.SendFrame(frame.Frame());
+            }
+
+            bool EntrySender::IsCancelled() const
+            {
+                return this->_cancellation.IsCancelled();
+            }
+        }
+
+        DownloadTelemetryTelecommand::DownloadTelemetryTelecommand(
+            mission::ITelemetryArchive& archive, const telecommunication::uplink::CancellationToken& cancellation)
+            : _archive(archive), _cancellation(cancellation)
+        {
+        }
+
+        void DownloadTelemetryTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            const auto correlationId = r.ReadByte();
+            const auto from = std::chrono::milliseconds(r.ReadQuadWordLE());
+            const auto to = std::chrono::milliseconds(r.ReadQuadWordLE());
+
+            EntrySender sender(transmitter, correlationId, this->_cancellation);
+
+            if (!r.Status() || from > to)
+            {
+                LOG(LOG_LEVEL_ERROR, "[tm] Malformed telemetry download request");
+                sender.Finish(num(DownlinkGenericResponse::MalformedRequest), false);
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "[tm] Downloading telemetry from %lu to %lu s",
+                static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(from).count()),
+                static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(to).count()));
+
+            if (!this->_archive.Query(from, to, sender))
+            {
+                sender.Finish(num(DownloadTelemetryStatus::NotFound), false);
+                return;
+            }
+
+            if (sender.IsCancelled())
+            {
+                LOG(LOG_LEVEL_INFO, "[tm] Telemetry download cancelled");
+                sender.Finish(num(DownloadTelemetryStatus::Cancelled), true);
+                return;
+            }
+
+            sender.Finish(num(DownloadTelemetryStatus::Completed), true);
+        }
+    }
+}
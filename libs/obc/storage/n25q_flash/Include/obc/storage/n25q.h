@@ -71,6 +71,14 @@ namespace obc
              */
             inline devices::n25q::RedundantN25QDriver& GetTopDriver();
 
+            /**
+             * @brief Options of YAFFS device
+             *
+             * Short-op cache entries take 2KB of heap each. Checkpoint is saved on file system sync.
+             * Chunks are verified by voting to keep memory layout of already formatted memories.
+             */
+            static constexpr devices::n25q::YaffsDeviceOptions DeviceOptions{4, true, devices::n25q::ChunkVerification::Voting};
+
           private:
             services::fs::IYaffsDeviceOperations& _deviceOperations;
 
@@ -8,6 +8,8 @@ using services::fs::IYaffsDeviceOperations;
 using drivers::gpio::OutputPin;
 using namespace obc::storage::error_counters;
 
+constexpr devices::n25q::YaffsDeviceOptions N25QStorage::DeviceOptions;
+
 N25QStorage::N25QStorage(                     //
     error_counter::ErrorCounting& errors,     //
     drivers::spi::EFMSPIInterface& spi,       //
@@ -25,7 +27,7 @@ N25QStorage::N25QStorage(                     //
           {errors, N25QDriver2::ErrorCounter::DeviceId, _spiSlaves[1]},        //
           {errors, N25QDriver3::ErrorCounter::DeviceId, _spiSlaves[2]}},       //
       _driver{errors, {&_n25qDrivers[0], &_n25qDrivers[1], &_n25qDrivers[2]}}, //
-      Device("/", _driver)                                                     //
+      Device("/", _driver, DeviceOptions)                                      //
 {
 }
 
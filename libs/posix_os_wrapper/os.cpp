@@ -0,0 +1,500 @@
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include "base/os.h"
+#include "logger/logger.h"
+
+/**
+ * @file
+ * @brief Implementation of operating system interface on top of C++ standard threading library.
+ *
+ * Used only by host (native) build. Tasks are mapped to detached threads that are started once
+ * scheduler is running. Task priorities are ignored and task suspension is cooperative: a task
+ * suspended by another task stops at its next call to SleepTask or Yield.
+ */
+
+using std::chrono::milliseconds;
+
+#define PULSE_ALL_BITS 0x80
+
+namespace posix
+{
+    using Lock = std::unique_lock<std::mutex>;
+
+    struct TaskControl
+    {
+        OSTaskProcedure EntryPoint;
+        void* Parameter;
+        const char* Name;
+
+        std::mutex Mutex;
+        std::condition_variable Resumed;
+        bool Suspended = false;
+    };
+
+    struct Semaphore
+    {
+        std::mutex Mutex;
+        std::condition_variable Changed;
+        bool Available = false;
+    };
+
+    struct EventGroup
+    {
+        std::mutex Mutex;
+        std::condition_variable Changed;
+        OSEventBits Bits = 0;
+    };
+
+    struct Queue
+    {
+        Queue(std::size_t capacity, std::size_t elementSize)
+            : Capacity(capacity), ElementSize(elementSize), Storage(new (std::nothrow) std::uint8_t[capacity * elementSize])
+        {
+        }
+
+        std::uint8_t* Slot(std::size_t index)
+        {
+            return Storage.get() + ((index % Capacity) * ElementSize);
+        }
+
+        const std::size_t Capacity;
+        const std::size_t ElementSize;
+        std::unique_ptr<std::uint8_t[]> Storage;
+        std::size_t Head = 0;
+        std::size_t Count = 0;
+
+        std::mutex Mutex;
+        std::condition_variable NotEmpty;
+        std::condition_variable NotFull;
+    };
+
+    struct Scheduler
+    {
+        std::mutex Mutex;
+        std::condition_variable Started;
+        bool Running = false;
+    };
+
+    Scheduler& GetScheduler()
+    {
+        // Never destroyed: task threads created before scheduler start keep waiting on it until process exit
+        static auto scheduler = new Scheduler();
+        return *scheduler;
+    }
+
+    std::recursive_mutex& GetCriticalSection()
+    {
+        static std::recursive_mutex criticalSection;
+        return criticalSection;
+    }
+
+    const std::chrono::steady_clock::time_point SystemStart = std::chrono::steady_clock::now();
+
+    thread_local TaskControl* CurrentTask = nullptr;
+
+    template <typename Predicate> bool WaitFor(std::condition_variable& condition, Lock& lock, milliseconds timeout, Predicate predicate)
+    {
+        if (timeout == InfiniteTimeout)
+        {
+            condition.wait(lock, predicate);
+            return true;
+        }
+
+        return condition.wait_for(lock, timeout, predicate);
+    }
+
+    void WaitWhileSuspended()
+    {
+        auto task = CurrentTask;
+        if (task == nullptr)
+        {
+            return;
+        }
+
+        Lock lock(task->Mutex);
+        task->Resumed.wait(lock, [task] { return !task->Suspended; });
+    }
+
+    void TaskThread(TaskControl* task)
+    {
+        {
+            auto& scheduler = GetScheduler();
+            Lock lock(scheduler.Mutex);
+            scheduler.Started.wait(lock, [&scheduler] { return scheduler.Running; });
+        }
+
+        CurrentTask = task;
+        task->EntryPoint(task->Parameter);
+    }
+
+    bool QueuePush(Queue* q, const void* element, milliseconds timeout)
+    {
+        Lock lock(q->Mutex);
+        if (!WaitFor(q->NotFull, lock, timeout, [q] { return q->Count < q->Capacity; }))
+        {
+            return false;
+        }
+
+        std::memcpy(q->Slot(q->Head + q->Count), element, q->ElementSize);
+        q->Count++;
+        q->NotEmpty.notify_one();
+        return true;
+    }
+
+    bool QueuePop(Queue* q, void* element, milliseconds timeout)
+    {
+        Lock lock(q->Mutex);
+        if (!WaitFor(q->NotEmpty, lock, timeout, [q] { return q->Count > 0; }))
+        {
+            return false;
+        }
+
+        std::memcpy(element, q->Slot(q->Head), q->ElementSize);
+        q->Head = (q->Head + 1) % q->Capacity;
+        q->Count--;
+        q->NotFull.notify_one();
+        return true;
+    }
+}
+
+OSResult System::CreateTask(OSTaskProcedure entryPoint, //
+    const char* taskName,                               //
+    std::uint16_t stackSize,                            //
+    void* taskParameter,                                //
+    TaskPriority priority,                              //
+    OSTaskHandle* taskHandle                            //
+    )
+{
+    UNREFERENCED_PARAMETER(stackSize);
+    UNREFERENCED_PARAMETER(priority);
+
+    auto task = new (std::nothrow) posix::TaskControl();
+    if (task == nullptr)
+    {
+        return OSResult::NotEnoughMemory;
+    }
+
+    task->EntryPoint = entryPoint;
+    task->Parameter = taskParameter;
+    task->Name = taskName;
+
+    std::thread(posix::TaskThread, task).detach();
+
+    if (taskHandle != nullptr)
+    {
+        *taskHandle = task;
+    }
+
+    return OSResult::Success;
+}
+
+void System::RunScheduler(void)
+{
+    auto& scheduler = posix::GetScheduler();
+    {
+        posix::Lock lock(scheduler.Mutex);
+        scheduler.Running = true;
+    }
+
+    scheduler.Started.notify_all();
+
+    // Same as FreeRTOS, function does not return once scheduler is started
+    while (true)
+    {
+        std::this_thread::sleep_for(std::chrono::hours(1));
+    }
+}
+
+void System::SleepTask(const milliseconds time)
+{
+    if (time == InfiniteTimeout)
+    {
+        while (true)
+        {
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        }
+    }
+
+    std::this_thread::sleep_for(time);
+    posix::WaitWhileSuspended();
+}
+
+void System::SuspendTask(OSTaskHandle task)
+{
+    auto control = task == nullptr ? posix::CurrentTask : static_cast<posix::TaskControl*>(task);
+    if (control == nullptr)
+    {
+        return;
+    }
+
+    {
+        posix::Lock lock(control->Mutex);
+        control->Suspended = true;
+    }
+
+    if (control == posix::CurrentTask)
+    {
+        posix::WaitWhileSuspended();
+    }
+}
+
+void System::ResumeTask(OSTaskHandle task)
+{
+    auto control = static_cast<posix::TaskControl*>(task);
+    if (control == nullptr)
+    {
+        return;
+    }
+
+    {
+        posix::Lock lock(control->Mutex);
+        control->Suspended = false;
+    }
+
+    control->Resumed.notify_all();
+}
+
+OSSemaphoreHandle System::CreateBinarySemaphore(uint8_t semaphoreId)
+{
+    UNREFERENCED_PARAMETER(semaphoreId);
+    auto s = new (std::nothrow) posix::Semaphore();
+
+    if (s == nullptr)
+    {
+        LOG(LOG_LEVEL_FATAL, "Unable to create binary semaphore");
+    }
+
+    return s;
+}
+
+OSResult System::TakeSemaphore(OSSemaphoreHandle semaphore, milliseconds timeout)
+{
+    auto s = static_cast<posix::Semaphore*>(semaphore);
+
+    posix::Lock lock(s->Mutex);
+    if (!posix::WaitFor(s->Changed, lock, timeout, [s] { return s->Available; }))
+    {
+        return OSResult::Timeout;
+    }
+
+    s->Available = false;
+    return OSResult::Success;
+}
+
+OSResult System::GiveSemaphore(OSSemaphoreHandle semaphore)
+{
+    auto s = static_cast<posix::Semaphore*>(semaphore);
+
+    {
+        posix::Lock lock(s->Mutex);
+        if (s->Available)
+        {
+            return OSResult::InvalidOperation;
+        }
+
+        s->Available = true;
+    }
+
+    s->Changed.notify_one();
+    return OSResult::Success;
+}
+
+OSResult System::GiveSemaphoreISR(OSSemaphoreHandle semaphore)
+{
+    return GiveSemaphore(semaphore);
+}
+
+OSEventGroupHandle System::CreateEventGroup(void)
+{
+    return new (std::nothrow) posix::EventGroup();
+}
+
+OSEventBits System::EventGroupSetBits(OSEventGroupHandle eventGroup, const OSEventBits bitsToChange)
+{
+    auto group = static_cast<posix::EventGroup*>(eventGroup);
+    OSEventBits result;
+
+    {
+        posix::Lock lock(group->Mutex);
+        group->Bits |= bitsToChange;
+        result = group->Bits;
+    }
+
+    group->Changed.notify_all();
+    return result;
+}
+
+OSEventBits System::EventGroupGetBits(OSEventGroupHandle eventGroup)
+{
+    auto group = static_cast<posix::EventGroup*>(eventGroup);
+
+    posix::Lock lock(group->Mutex);
+    return group->Bits;
+}
+
+OSEventBits System::EventGroupSetBitsISR(OSEventGroupHandle eventGroup, const OSEventBits bitsToChange)
+{
+    return EventGroupSetBits(eventGroup, bitsToChange);
+}
+
+OSEventBits System::EventGroupClearBits(OSEventGroupHandle eventGroup, const OSEventBits bitsToChange)
+{
+    auto group = static_cast<posix::EventGroup*>(eventGroup);
+
+    posix::Lock lock(group->Mutex);
+    const auto previous = group->Bits;
+    group->Bits &= ~bitsToChange;
+    return previous;
+}
+
+OSEventBits System::EventGroupWaitForBits(OSEventGroupHandle eventGroup, //
+    const OSEventBits bitsToWaitFor,                                     //
+    bool waitAll,                                                        //
+    bool autoReset,                                                      //
+    const milliseconds timeout                                           //
+    )
+{
+    auto group = static_cast<posix::EventGroup*>(eventGroup);
+
+    auto isSignaled = [group, bitsToWaitFor, waitAll] {
+        const auto matching = group->Bits & bitsToWaitFor;
+        return waitAll ? matching == bitsToWaitFor : matching != 0;
+    };
+
+    posix::Lock lock(group->Mutex);
+    const auto signaled = posix::WaitFor(group->Changed, lock, timeout, isSignaled);
+    const auto result = group->Bits;
+
+    if (signaled && autoReset)
+    {
+        group->Bits &= ~bitsToWaitFor;
+    }
+
+    return result;
+}
+
+void* System::Alloc(size_t size)
+{
+    return std::malloc(size);
+}
+
+void System::Free(void* ptr)
+{
+    std::free(ptr);
+}
+
+OSQueueHandle System::CreateQueue(size_t maxElementCount, size_t elementSize)
+{
+    auto q = new (std::nothrow) posix::Queue(maxElementCount, elementSize);
+    if (q != nullptr && q->Storage == nullptr)
+    {
+        delete q;
+        return nullptr;
+    }
+
+    return q;
+}
+
+bool System::QueueReceive(OSQueueHandle queue, void* element, milliseconds timeout)
+{
+    return posix::QueuePop(static_cast<posix::Queue*>(queue), element, timeout);
+}
+
+bool System::QueueReceiveFromISR(OSQueueHandle queue, void* element)
+{
+    return posix::QueuePop(static_cast<posix::Queue*>(queue), element, milliseconds::zero());
+}
+
+bool System::QueueSend(OSQueueHandle queue, const void* element, milliseconds timeout)
+{
+    return posix::QueuePush(static_cast<posix::Queue*>(queue), element, timeout);
+}
+
+bool System::QueueSendISR(OSQueueHandle queue, const void* element)
+{
+    return posix::QueuePush(static_cast<posix::Queue*>(queue), element, milliseconds::zero());
+}
+
+void System::QueueOverwrite(OSQueueHandle queue, const void* element)
+{
+    auto q = static_cast<posix::Queue*>(queue);
+
+    {
+        posix::Lock lock(q->Mutex);
+        std::memcpy(q->Slot(q->Head), element, q->ElementSize);
+        if (q->Count == 0)
+        {
+            q->Count = 1;
+        }
+    }
+
+    q->NotEmpty.notify_one();
+}
+
+void System::QueueReset(OSQueueHandle queue)
+{
+    auto q = static_cast<posix::Queue*>(queue);
+
+    {
+        posix::Lock lock(q->Mutex);
+        q->Head = 0;
+        q->Count = 0;
+    }
+
+    q->NotFull.notify_all();
+}
+
+void System::EndSwitchingISR()
+{
+}
+
+OSPulseHandle System::CreatePulseAll(void)
+{
+    return (OSPulseHandle)System::CreateEventGroup();
+}
+
+OSResult System::PulseWait(OSPulseHandle handle, milliseconds timeout)
+{
+    OSEventBits result = System::EventGroupWaitForBits((OSEventGroupHandle)handle, PULSE_ALL_BITS, true, true, timeout);
+
+    if (result == PULSE_ALL_BITS)
+    {
+        return OSResult::Success;
+    }
+    else
+    {
+        return OSResult::Timeout;
+    }
+}
+
+void System::PulseSet(OSPulseHandle handle)
+{
+    System::EventGroupSetBits((OSEventGroupHandle)handle, PULSE_ALL_BITS);
+}
+
+milliseconds System::GetUptime()
+{
+    return std::chrono::duration_cast<milliseconds>(std::chrono::steady_clock::now() - posix::SystemStart);
+}
+
+void System::Yield()
+{
+    std::this_thread::yield();
+    posix::WaitWhileSuspended();
+}
+
+void System::EnterCritical()
+{
+    posix::GetCriticalSection().lock();
+}
+
+void System::LeaveCritical()
+{
+    posix::GetCriticalSection().unlock();
+}
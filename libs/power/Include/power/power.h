@@ -13,6 +13,17 @@ namespace services
          * @{
          */
 
+        /**
+         * @brief Interface of objects that have to be notified before power cycle
+         */
+        struct INotifyPowerCycle
+        {
+            /**
+             * @brief Procedure invoked right before power cycle is performed
+             */
+            virtual void BeforePowerCycle() = 0;
+        };
+
         /**
          * @brief Power control API
          */
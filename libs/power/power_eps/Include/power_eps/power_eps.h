@@ -21,6 +21,12 @@ namespace services
              */
             EPSPowerControl(devices::eps::EPSDriver& eps);
 
+            /**
+             * @brief Sets object that is notified before each power cycle
+             * @param observer Power cycle observer
+             */
+            void SetPowerCycleObserver(INotifyPowerCycle& observer);
+
             virtual void PowerCycle() override;
 
             virtual bool MainThermalKnife(bool enabled) override;
@@ -52,6 +58,9 @@ namespace services
 
             /** @brief Controller last used for power cycle */
             devices::eps::EPSDriver::Controller _lastPowerCycleOn;
+
+            /** @brief Object notified before power cycle */
+            INotifyPowerCycle* _powerCycleObserver;
         };
     }
 }
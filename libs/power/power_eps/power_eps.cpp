@@ -17,12 +17,22 @@ namespace services
 {
     namespace power
     {
-        EPSPowerControl::EPSPowerControl(devices::eps::EPSDriver& eps) : _eps(eps), _lastPowerCycleOn(EPS::A)
+        EPSPowerControl::EPSPowerControl(devices::eps::EPSDriver& eps) : _eps(eps), _lastPowerCycleOn(EPS::A), _powerCycleObserver(nullptr)
         {
         }
 
+        void EPSPowerControl::SetPowerCycleObserver(INotifyPowerCycle& observer)
+        {
+            this->_powerCycleObserver = &observer;
+        }
+
         void EPSPowerControl::PowerCycle()
         {
+            if (this->_powerCycleObserver != nullptr)
+            {
+                this->_powerCycleObserver->BeforePowerCycle();
+            }
+
             if (this->_lastPowerCycleOn == EPS::A)
             {
                 this->_lastPowerCycleOn = EPS::B;
@@ -1,25 +1,21 @@
 #include "beacon.hpp"
-#include <chrono>
 #include "base/writer.h"
 #include "downlink.h"
 #include "logger/logger.h"
 #include "telemetry/state.hpp"
 
-using namespace std::chrono_literals;
-
-bool WriteBeaconPayload(telemetry::TelemetryState& state, Writer& writer)
+bool WriteBeaconPayload(const telemetry::TelemetryState& state, Writer& writer)
 {
-    {
-        Lock lock(state.bufferLock, 5s);
-        if (!static_cast<bool>(lock))
-        {
-            LOG(LOG_LEVEL_ERROR, "[beacon] Unable to acquire access to telemetry.");
-            return false;
-        }
-
+    const auto consistent = state.serializedTelemetry.Read([&writer](const telemetry::SerializedTelemetry& telemetry) {
         writer.Reset();
         writer.WriteByte(telecommunication::downlink::BeaconMarker);
-        writer.WriteArray(state.lastSerializedTelemetry);
+        writer.WriteArray(telemetry);
+    });
+
+    if (!consistent)
+    {
+        LOG(LOG_LEVEL_ERROR, "[beacon] Unable to acquire access to telemetry.");
+        return false;
     }
 
     if (!writer.Status())
@@ -8,6 +8,50 @@ namespace telecommunication
     {
         static_assert(num(DownlinkAPID::LastItem) - 1 <= MaxValueOnBits(6), "APID is 6-bit value");
 
+        devices::comm::DownlinkPriority FramePriority(gsl::span<const std::uint8_t> frame)
+        {
+            if (frame.empty())
+            {
+                return devices::comm::DownlinkPriority::Control;
+            }
+
+            if (frame[0] == BeaconMarker)
+            {
+                return devices::comm::DownlinkPriority::Beacon;
+            }
+
+            switch (static_cast<DownlinkAPID>(frame[0] & 0x3F))
+            {
+                case DownlinkAPID::FileSend:
+                case DownlinkAPID::FileSendCompressed:
+                case DownlinkAPID::FileSendParity:
+                case DownlinkAPID::FileList:
+                case DownlinkAPID::PersistentState:
+                case DownlinkAPID::SailExperiment:
+                case DownlinkAPID::CopyBootTable:
+                case DownlinkAPID::MemoryContent:
+                case DownlinkAPID::TelemetryArchive:
+                case DownlinkAPID::PeriodicMessage:
+                    return devices::comm::DownlinkPriority::Bulk;
+
+                default:
+                    return devices::comm::DownlinkPriority::Control;
+            }
+        }
+
+        /**
+         * @brief Writes header of downlink frame
+         * @param frame Buffer for entire frame
+         * @param apid APID
+         * @param seq Sequence number
+         */
+        static void WriteHeader(gsl::span<std::uint8_t> frame, DownlinkAPID apid, std::uint32_t seq)
+        {
+            BitWriter w(frame.subspan(0, DownlinkFrame::HeaderSize));
+            w.WriteWord(num(apid), 6);
+            w.WriteDoubleWord(seq, 18);
+        }
+
         RawFrame::RawFrame() : _payloadWriter(gsl::make_span(_frame))
         {
         }
@@ -16,9 +60,7 @@ namespace telecommunication
         {
             this->_frame.fill(0);
 
-            BitWriter w(this->_frame);
-            w.WriteWord(num(apid), 6);
-            w.WriteDoubleWord(seq, 18);
+            WriteHeader(this->_frame, apid, seq);
         }
 
         CorrelatedDownlinkFrame::CorrelatedDownlinkFrame(DownlinkAPID apid, std::uint32_t seq, std::uint8_t correlationId)
@@ -26,5 +68,47 @@ namespace telecommunication
         {
             PayloadWriter().WriteByte(correlationId);
         }
+
+        TransmitterDownlinkFrame::TransmitterDownlinkFrame(devices::comm::ITransmitter& transmitter, DownlinkAPID apid, std::uint32_t seq)
+            : _transmitter(transmitter), _buffer(transmitter.AcquireFrameBuffer())
+        {
+            if (this->_buffer == nullptr)
+            {
+                return;
+            }
+
+            const auto frame = gsl::make_span(*this->_buffer).subspan(devices::comm::DownlinkFrameHeadroom);
+            WriteHeader(frame, apid, seq);
+            this->_payloadWriter.Initialize(frame.subspan(DownlinkFrame::HeaderSize));
+        }
+
+        TransmitterDownlinkFrame::TransmitterDownlinkFrame(
+            devices::comm::ITransmitter& transmitter, DownlinkAPID apid, std::uint32_t seq, std::uint8_t correlationId)
+            : TransmitterDownlinkFrame(transmitter, apid, seq)
+        {
+            this->_payloadWriter.WriteByte(correlationId);
+        }
+
+        TransmitterDownlinkFrame::~TransmitterDownlinkFrame()
+        {
+            if (this->_buffer != nullptr)
+            {
+                this->_transmitter.ReleaseFrameBuffer(*this->_buffer);
+            }
+        }
+
+        bool TransmitterDownlinkFrame::Send()
+        {
+            if (this->_buffer == nullptr)
+            {
+                return false;
+            }
+
+            auto buffer = this->_buffer;
+            this->_buffer = nullptr;
+
+            const auto frameSize = static_cast<std::uint8_t>(DownlinkFrame::HeaderSize + this->_payloadWriter.GetDataLength());
+            return this->_transmitter.SendFrameBuffer(*buffer, frameSize);
+        }
     }
 }
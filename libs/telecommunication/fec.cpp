@@ -0,0 +1,137 @@
+#include "fec.hpp"
+#include <algorithm>
+
+namespace telecommunication
+{
+    namespace fec
+    {
+        constexpr std::uint8_t ParityEncoder::MaxChunkSize;
+
+        static_assert(MaxParityCount + MaxDataCount <= 256, "Cauchy matrix requires distinct field elements");
+
+        namespace
+        {
+            /**
+             * @brief Logarithm and exponent tables of GF(2^8) generated at compile time
+             */
+            struct GaloisTables
+            {
+                constexpr GaloisTables() : Exp(), Log()
+                {
+                    std::uint16_t x = 1;
+                    for (std::uint16_t i = 0; i < 255; i++)
+                    {
+                        Exp[i] = static_cast<std::uint8_t>(x);
+                        Exp[i + 255] = static_cast<std::uint8_t>(x);
+                        Log[x] = static_cast<std::uint8_t>(i);
+
+                        x <<= 1;
+                        if (x & 0x100)
+                        {
+                            x ^= 0x11D;
+                        }
+                    }
+                }
+
+                /** @brief Powers of generator, doubled to avoid modulo when adding logarithms */
+                std::uint8_t Exp[510];
+                /** @brief Discrete logarithms, entry for 0 is unused */
+                std::uint8_t Log[256];
+            };
+
+            constexpr GaloisTables Tables{};
+        }
+
+        std::uint8_t Multiply(std::uint8_t a, std::uint8_t b)
+        {
+            if (a == 0 || b == 0)
+            {
+                return 0;
+            }
+
+            return Tables.Exp[Tables.Log[a] + Tables.Log[b]];
+        }
+
+        std::uint8_t Inverse(std::uint8_t a)
+        {
+            if (a == 0)
+            {
+                return 0;
+            }
+
+            return Tables.Exp[255 - Tables.Log[a]];
+        }
+
+        void MultiplyAdd(gsl::span<std::uint8_t> accumulator, gsl::span<const std::uint8_t> chunk, std::uint8_t coefficient)
+        {
+            if (coefficient == 0)
+            {
+                return;
+            }
+
+            const auto logCoefficient = Tables.Log[coefficient];
+            const auto count = std::min(accumulator.size(), chunk.size());
+
+            for (auto i = 0; i < count; i++)
+            {
+                const auto value = chunk[i];
+                if (value != 0)
+                {
+                    accumulator[i] ^= Tables.Exp[logCoefficient + Tables.Log[value]];
+                }
+            }
+        }
+
+        std::uint8_t ParityCoefficient(std::uint8_t parityIndex, std::uint8_t dataIndex)
+        {
+            return Inverse(parityIndex ^ static_cast<std::uint8_t>(MaxParityCount + dataIndex));
+        }
+
+        ParityEncoder::ParityEncoder() : _parity{}, _parityCount(0), _chunkSize(0)
+        {
+        }
+
+        bool ParityEncoder::Reset(std::uint8_t parityCount, std::uint8_t chunkSize)
+        {
+            if (parityCount > MaxParityCount || chunkSize > MaxChunkSize)
+            {
+                return false;
+            }
+
+            this->_parityCount = parityCount;
+            this->_chunkSize = chunkSize;
+
+            for (auto& parity : this->_parity)
+            {
+                parity.fill(0);
+            }
+
+            return true;
+        }
+
+        bool ParityEncoder::Add(std::uint8_t dataIndex, gsl::span<const std::uint8_t> chunk)
+        {
+            if (dataIndex >= MaxDataCount || chunk.size() > this->_chunkSize)
+            {
+                return false;
+            }
+
+            for (auto j = 0; j < this->_parityCount; j++)
+            {
+                MultiplyAdd(this->_parity[j], chunk, ParityCoefficient(j, dataIndex));
+            }
+
+            return true;
+        }
+
+        gsl::span<const std::uint8_t> ParityEncoder::Parity(std::uint8_t parityIndex) const
+        {
+            if (parityIndex >= this->_parityCount)
+            {
+                return {};
+            }
+
+            return gsl::make_span(this->_parity[parityIndex]).subspan(0, this->_chunkSize);
+        }
+    }
+}
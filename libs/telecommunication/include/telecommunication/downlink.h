@@ -3,8 +3,10 @@
 
 #include <cstdint>
 #include "base/writer.h"
+#include "comm/ITransmitter.hpp"
 #include "comm/comm.hpp"
 #include "gsl/span"
+#include "utils.h"
 
 namespace telecommunication
 {
@@ -63,6 +65,14 @@ namespace telecommunication
             MemoryContent = 0x21,              //!< Memory contents
             BeaconError = 0x22,                //!< Beacon Error
             DisableAntennaDeployment = 0x23,   //!< Disable automatic antenna deployment
+            MissionLoopProfile = 0x24,         //!< Mission loop execution time statistics
+            TelemetryArchive = 0x25,           //!< Archived telemetry entries
+            ReceivePolling = 0x26,             //!< Receive polling statistics
+            FileSendSummary = 0x27,            //!< Summary of selective file download
+            FileSendCompressed = 0x28,         //!< Sending compressed file
+            FileSendParity = 0x29,             //!< Parity of file parts
+            UplinkSegments = 0x2A,             //!< Acknowledgement of segmented telecommand
+            TelecommandRejected = 0x2B,        //!< Telecommand not accepted for execution
             Telemetry = 0x3F,                  //!< TelemetryLong
             LastItem                           //!< LastItem
         };
@@ -77,6 +87,14 @@ namespace telecommunication
             ExperimentError = 2,  //!< Error in experiment execution
         };
 
+        /**
+         * @brief Assigns downlink priority class to frame based on its APID
+         * @param[in] frame Complete downlink frame
+         * @return Priority class. Beacon is recognized by @ref BeaconMarker, frames that are part of large data transfers
+         * belong to bulk class and all other frames are control ones.
+         */
+        devices::comm::DownlinkPriority FramePriority(gsl::span<const std::uint8_t> frame);
+
         /**
          * @brief Type that represents raw downlink frame.
          */
@@ -184,6 +202,75 @@ namespace telecommunication
             static constexpr std::uint8_t MaxPayloadSize = DownlinkFrame::MaxPayloadSize - 1;
         };
 
+        /**
+         * @brief Downlink frame built directly in the buffer provided by transmitter
+         *
+         * Frame is not copied before being passed to transmitter hardware. Buffer is returned to transmitter when frame
+         * is sent or when this object is destroyed.
+         */
+        class TransmitterDownlinkFrame final : private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Acquires frame buffer and writes frame header
+             * @param transmitter Transmitter that provides frame buffer and sends frame
+             * @param apid APID
+             * @param seq Sequence number
+             */
+            TransmitterDownlinkFrame(devices::comm::ITransmitter& transmitter, DownlinkAPID apid, std::uint32_t seq);
+
+            /**
+             * @brief Acquires frame buffer and writes header of correlated frame
+             * @param transmitter Transmitter that provides frame buffer and sends frame
+             * @param apid APID
+             * @param seq Sequence number
+             * @param correlationId Identifier of the request that prompted sending this frame.
+             */
+            TransmitterDownlinkFrame(
+                devices::comm::ITransmitter& transmitter, DownlinkAPID apid, std::uint32_t seq, std::uint8_t correlationId);
+
+            /**
+             * @brief Returns frame buffer to transmitter if frame has not been sent
+             */
+            ~TransmitterDownlinkFrame();
+
+            /**
+             * @brief Checks whether transmitter provided frame buffer
+             * @return true if frame can be built and sent
+             */
+            inline bool IsValid() const;
+
+            /**
+             * @brief Returns writer that can be used to fill payload part of frame
+             * @return Writer
+             */
+            inline Writer& PayloadWriter();
+
+            /**
+             * @brief Passes frame to transmitter
+             * @return Operation status, true in case of success, false otherwise.
+             */
+            bool Send();
+
+          private:
+            /** @brief Transmitter */
+            devices::comm::ITransmitter& _transmitter;
+            /** @brief Buffer in which frame is built */
+            devices::comm::DownlinkFrameBuffer* _buffer;
+            /** @brief Writer instance used to build frame payload */
+            Writer _payloadWriter;
+        };
+
+        inline bool TransmitterDownlinkFrame::IsValid() const
+        {
+            return this->_buffer != nullptr;
+        }
+
+        inline Writer& TransmitterDownlinkFrame::PayloadWriter()
+        {
+            return this->_payloadWriter;
+        }
+
         /** @} */
     }
 }
@@ -0,0 +1,135 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_FEC_HPP_
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_FEC_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "downlink.h"
+#include "gsl/span"
+
+namespace telecommunication
+{
+    namespace fec
+    {
+        /**
+         * @defgroup fec Forward error correction
+         * @ingroup telecomm_handling
+         *
+         * @brief Systematic erasure code protecting groups of downlink chunks.
+         *
+         * Group of N data chunks is followed by M parity chunks. Parity chunk j is a linear combination of data chunks
+         * over GF(2^8) (polynomial 0x11D) with coefficients taken from Cauchy matrix:
+         *
+         *     parity[j] = sum over i of (1 / (j ^ (MaxParityCount + i))) * data[i]
+         *
+         * Every square submatrix of Cauchy matrix is invertible, so any N chunks out of N + M received chunks
+         * are enough to reconstruct all data chunks of the group. Shorter chunks are padded with zeros.
+         *
+         * Encoder keeps only parity chunks of current group in memory, its size is fixed at compile time.
+         * @{
+         */
+
+        /**
+         * @brief Multiplies two elements of GF(2^8)
+         * @param a First factor
+         * @param b Second factor
+         * @return Product
+         */
+        std::uint8_t Multiply(std::uint8_t a, std::uint8_t b);
+
+        /**
+         * @brief Calculates multiplicative inverse of element of GF(2^8)
+         * @param a Non-zero element
+         * @return Inverse of the element, 0 for 0
+         */
+        std::uint8_t Inverse(std::uint8_t a);
+
+        /**
+         * @brief Adds chunk multiplied by coefficient to the accumulator
+         * @param accumulator Accumulator, only bytes covered by chunk are modified
+         * @param chunk Chunk
+         * @param coefficient Coefficient
+         */
+        void MultiplyAdd(gsl::span<std::uint8_t> accumulator, gsl::span<const std::uint8_t> chunk, std::uint8_t coefficient);
+
+        /**
+         * @brief Maximal number of data chunks in single group
+         */
+        static constexpr std::uint8_t MaxDataCount = 32;
+
+        /**
+         * @brief Maximal number of parity chunks in single group
+         */
+        static constexpr std::uint8_t MaxParityCount = 4;
+
+        /**
+         * @brief Returns coefficient of data chunk in parity chunk
+         * @param parityIndex Index of parity chunk in group
+         * @param dataIndex Index of data chunk in group
+         * @return Coefficient
+         */
+        std::uint8_t ParityCoefficient(std::uint8_t parityIndex, std::uint8_t dataIndex);
+
+        /**
+         * @brief Calculates parity chunks of single group of data chunks
+         */
+        class ParityEncoder final
+        {
+          public:
+            /** @brief Maximal size of single chunk */
+            static constexpr std::uint8_t MaxChunkSize = downlink::DownlinkFrame::MaxPayloadSize;
+
+            /**
+             * @brief Ctor
+             */
+            ParityEncoder();
+
+            /**
+             * @brief Starts new group
+             * @param parityCount Number of parity chunks
+             * @param chunkSize Size of chunk
+             * @return true if parameters are within limits
+             */
+            bool Reset(std::uint8_t parityCount, std::uint8_t chunkSize);
+
+            /**
+             * @brief Adds data chunk to the group
+             * @param dataIndex Index of chunk in group
+             * @param chunk Chunk contents, shorter chunks are treated as padded with zeros
+             * @return true if chunk has been added, false if index or size is out of range
+             */
+            bool Add(std::uint8_t dataIndex, gsl::span<const std::uint8_t> chunk);
+
+            /**
+             * @brief Returns parity chunk of data chunks added since last reset
+             * @param parityIndex Index of parity chunk
+             * @return Parity chunk
+             */
+            gsl::span<const std::uint8_t> Parity(std::uint8_t parityIndex) const;
+
+            /**
+             * @brief Returns number of parity chunks in group
+             * @return Number of parity chunks
+             */
+            inline std::uint8_t ParityCount() const;
+
+          private:
+            /** @brief Parity chunks */
+            std::array<std::array<std::uint8_t, MaxChunkSize>, MaxParityCount> _parity;
+            /** @brief Number of parity chunks */
+            std::uint8_t _parityCount;
+            /** @brief Size of chunk */
+            std::uint8_t _chunkSize;
+        };
+
+        inline std::uint8_t ParityEncoder::ParityCount() const
+        {
+            return this->_parityCount;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_FEC_HPP_ */
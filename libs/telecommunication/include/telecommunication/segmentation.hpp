@@ -0,0 +1,135 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_SEGMENTATION_HPP_
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_SEGMENTATION_HPP_
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <gsl/span>
+#include "comm/ITransmitter.hpp"
+#include "comm/comm.hpp"
+#include "utils.h"
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        /**
+         * @ingroup telecomm_handling
+         * @{
+         */
+
+        /**
+         * @brief Reassembles telecommands that do not fit into single uplink frame
+         *
+         * Large telecommand (command code followed by parameters) is split by ground station into up to
+         * @ref MaxSegments segments, each sent as separate segment telecommand (@ref Code):
+         *  - 8-bit - Stream id, used as correlation id of acknowledgement
+         *  - 8-bit - Index of segment
+         *  - 8-bit - Number of segments in stream, 0 - request for acknowledgement of current state
+         *  - Segment data
+         *
+         * Segments may arrive in any order and are stored in fixed buffer. Once all of them are received
+         * reassembled telecommand is executed as if it was received in single frame. Single acknowledgement
+         * (APID @ref telecommunication::downlink::DownlinkAPID::UplinkSegments) is sent for entire stream:
+         *  - 8-bit - Stream id
+         *  - 8-bit - Status (@ref SegmentStatus)
+         *  - 8-bit - Number of segments in stream
+         *  - 8-bit - Bitmap of received segments (bit i - segment i)
+         *
+         * Acknowledgement is sent when stream is completed, when segment is malformed and when ground station requests it
+         * (so it can resend only missing segments). Partially received stream is dropped when segment of another stream
+         * arrives or when no segment has arrived for @ref Timeout. Duplicated segments of completed stream are only
+         * acknowledged again, telecommand is not executed twice.
+         */
+        class SegmentReassembly final : private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Status reported in acknowledgement
+             */
+            enum class SegmentStatus : std::uint8_t
+            {
+                Complete = 0,   //!< All segments received, telecommand executed
+                Incomplete = 1, //!< Some segments are still missing
+                Malformed = 2,  //!< Segment does not match the stream or exceeds limits
+                Unknown = 3     //!< Stream is not being received
+            };
+
+            /**
+             * @brief Ctor
+             */
+            SegmentReassembly();
+
+            /**
+             * @brief Handles single segment
+             * @param[in] transmitter Transmitter used to send acknowledgement
+             * @param[in] parameters Parameters of segment telecommand
+             * @return Reassembled telecommand (command code followed by parameters) if stream has been completed by
+             * this segment, empty span otherwise. Contents are valid until next segment is handled.
+             */
+            gsl::span<const std::uint8_t> Add(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters);
+
+            /** @brief Command code of segment telecommand */
+            static constexpr std::uint8_t Code = 0xB8;
+
+            /** @brief Size of segment header */
+            static constexpr std::uint8_t HeaderSize = 3;
+
+            /** @brief Maximal size of segment data (uplink frame without security code, command code and header) */
+            static constexpr std::uint8_t MaxSegmentSize = devices::comm::MaxUplinkFrameSize - 5 - HeaderSize;
+
+            /** @brief Maximal number of segments in stream */
+            static constexpr std::uint8_t MaxSegments = 8;
+
+            /** @brief Time after which partially received stream is dropped */
+            static constexpr std::chrono::milliseconds Timeout = std::chrono::seconds(60);
+
+          private:
+            /**
+             * @brief Drops partially received stream and starts new one
+             * @param[in] streamId Stream id
+             * @param[in] count Number of segments in stream
+             */
+            void Start(std::uint8_t streamId, std::uint8_t count);
+
+            /**
+             * @brief Sends acknowledgement
+             * @param[in] transmitter Transmitter
+             * @param[in] streamId Stream id
+             * @param[in] status Status
+             */
+            void Acknowledge(devices::comm::ITransmitter& transmitter, std::uint8_t streamId, SegmentStatus status) const;
+
+            /**
+             * @brief Moves segments to the beginning of buffer so they form single telecommand
+             * @return Reassembled telecommand
+             */
+            gsl::span<const std::uint8_t> Join();
+
+            /** @brief Segments buffer, segment i is stored at offset i * MaxSegmentSize */
+            std::array<std::uint8_t, MaxSegments * MaxSegmentSize> _buffer;
+            /** @brief Sizes of received segments */
+            std::array<std::uint8_t, MaxSegments> _sizes;
+            /** @brief Id of stream being received */
+            std::uint8_t _streamId;
+            /** @brief Number of segments in stream being received, 0 if no stream is being received */
+            std::uint8_t _count;
+            /** @brief Bitmap of received segments */
+            std::uint8_t _received;
+            /** @brief Time of last received segment */
+            std::chrono::milliseconds _lastSegmentAt;
+            /** @brief Id of last completed stream */
+            std::uint8_t _completedStreamId;
+            /** @brief Number of segments of last completed stream, 0 if none has been completed */
+            std::uint8_t _completedCount;
+
+            static_assert(MaxSegments <= 8, "Received segments bitmap must fit single byte");
+        };
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_SEGMENTATION_HPP_ */
@@ -0,0 +1,190 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_EXECUTION_HPP_
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_EXECUTION_HPP_
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <gsl/span>
+#include "base/os.h"
+#include "comm/CommDriver.hpp"
+#include "comm/IHandleFrame.hpp"
+#include "comm/comm.hpp"
+#include "telecommand_handling.h"
+#include "utils.h"
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        /**
+         * @ingroup telecomm_handling
+         * @{
+         */
+
+        /**
+         * @brief Token used to request cancellation of long running telecommand
+         *
+         * Each queued telecommand is assigned increasing operation id. Cancellation applies to all operations queued before
+         * it was requested, so cancel request that arrives while next operation is waiting for execution is not lost.
+         * Long telecommands check the token between subsequent steps (e.g. frames) and stop as soon as it is set.
+         */
+        class CancellationToken final : private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Ctor
+             */
+            CancellationToken();
+
+            /**
+             * @brief Requests cancellation of currently executed telecommand and all telecommands queued so far
+             */
+            void Cancel();
+
+            /**
+             * @brief Assigns operation id to newly queued telecommand
+             * @return Operation id
+             */
+            std::uint32_t Enqueue();
+
+            /**
+             * @brief Marks start of execution of queued telecommand
+             * @param[in] operation Operation id returned by @ref Enqueue
+             */
+            void Begin(std::uint32_t operation);
+
+            /**
+             * @brief Checks whether cancellation has been requested
+             * @return true if currently executed telecommand should stop
+             */
+            bool IsCancelled() const;
+
+          private:
+            /** @brief Id of last queued operation */
+            std::atomic<std::uint32_t> _queued;
+            /** @brief Id of currently executed operation */
+            std::atomic<std::uint32_t> _current;
+            /** @brief Id of last cancelled operation */
+            std::atomic<std::uint32_t> _cancelledThrough;
+        };
+
+        /**
+         * @brief Frame handler that executes telecommands in background worker task
+         *
+         * Incoming frames are copied to bounded queue so the task that receives them (comm task) can immediately remove
+         * them from receiver and continue servicing hardware. Frames are handled one by one by worker task, therefore
+         * telecommand handlers are never executed concurrently.
+         *
+         * Single immediate telecommand (cancellation of running operation) is recognized and executed directly by
+         * receiving task, so it is not queued behind the operation it cancels.
+         *
+         * When queue is full frame is rejected: response with APID
+         * @ref telecommunication::downlink::DownlinkAPID::TelecommandRejected is sent and rejected frames counter is
+         * incremented.
+         */
+        class AsyncTelecommandHandler final : public devices::comm::IHandleFrame, private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] handler Frame handler executed by worker task
+             * @param[in] decodeTelecommand Decoder used to recognize immediate telecommand
+             * @param[in] immediate Telecommand executed directly by receiving task
+             * @param[in] cancellation Cancellation token that tracks queued operations
+             */
+            AsyncTelecommandHandler(devices::comm::IHandleFrame& handler,
+                IDecodeTelecommand& decodeTelecommand,
+                IHandleTeleCommand& immediate,
+                CancellationToken& cancellation);
+
+            /**
+             * @brief Creates queue and starts worker task
+             * @return Operation result
+             */
+            OSResult Initialize();
+
+            /**
+             * @brief Queues frame for execution by worker task or executes immediate telecommand
+             * @param[in] transmitter Transmitter used to send responses
+             * @param[in] frame Incoming frame
+             */
+            virtual void HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame) override;
+
+            /**
+             * @brief Returns number of frames rejected because queue was full
+             * @return Number of rejected frames
+             */
+            std::uint32_t Rejected() const;
+
+            /**
+             * @brief Maximal number of frames waiting for execution
+             *
+             * Queue holds entire batch of frames downloaded by comm task at once, so a burst of telecommands is not
+             * rejected just because worker did not start executing them yet.
+             */
+            static constexpr std::uint8_t Capacity = devices::comm::CommObject::ReceivePoolCapacity;
+
+          private:
+            /**
+             * @brief Frame waiting for execution
+             */
+            struct PendingFrame
+            {
+                /** @brief Transmitter used to send responses */
+                devices::comm::ITransmitter* Transmitter;
+                /** @brief Operation id */
+                std::uint32_t Operation;
+                /** @brief Doppler frequency */
+                std::uint16_t Doppler;
+                /** @brief Received Signal Strength Indicator */
+                std::uint16_t Rssi;
+                /** @brief Number of bytes in frame */
+                std::uint8_t Size;
+                /** @brief Frame contents */
+                std::array<std::uint8_t, devices::comm::MaxUplinkFrameSize> Contents;
+            };
+
+            /**
+             * @brief Worker task entry point
+             * @param[in] param Pointer to handler
+             */
+            [[noreturn]] static void WorkerTask(void* param);
+
+            /**
+             * @brief Notifies ground that telecommand has not been accepted for execution
+             * @param[in] transmitter Transmitter used to send response
+             * @param[in] commandCode Code of rejected telecommand
+             * @param[in] parameters Parameters of rejected telecommand
+             */
+            static void Reject(
+                devices::comm::ITransmitter& transmitter, std::uint8_t commandCode, gsl::span<const std::uint8_t> parameters);
+
+            /** @brief Frame handler executed by worker task */
+            devices::comm::IHandleFrame& _handler;
+
+            /** @brief Telecommand decoder */
+            IDecodeTelecommand& _decodeTelecommand;
+
+            /** @brief Immediate telecommand */
+            IHandleTeleCommand& _immediate;
+
+            /** @brief Cancellation token */
+            CancellationToken& _cancellation;
+
+            /** @brief Frames waiting for execution */
+            Queue<PendingFrame, Capacity> _frames;
+
+            /** @brief Worker task handle */
+            OSTaskHandle _taskHandle;
+
+            /** @brief Number of frames rejected because queue was full */
+            std::atomic<std::uint32_t> _rejected;
+        };
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_EXECUTION_HPP_ */
@@ -1,9 +1,11 @@
 #ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_HANDLING_H_
 #define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_HANDLING_H_
 
+#include <array>
 #include <cstdint>
 #include <gsl/span>
 #include "comm/IHandleFrame.hpp"
+#include "segmentation.hpp"
 
 namespace telecommunication
 {
@@ -125,6 +127,16 @@ namespace telecommunication
             return TCode;
         }
 
+        /** @brief Number of possible telecommand codes */
+        constexpr std::size_t TelecommandCodeCount = 256;
+
+        /**
+         * @brief Telecommand dispatch table indexed directly by command code.
+         *
+         * Entries for codes without telecommand are null.
+         */
+        using TelecommandTable = std::array<IHandleTeleCommand*, TelecommandCodeCount>;
+
         /**
          * @brief Incoming frame handler that is capable of decoding them and dispatching telecommands
          */
@@ -134,9 +146,19 @@ namespace telecommunication
             /**
              * @brief Constructs \ref IncomingTelecommandHandler object
              * @param[in] decodeTelecommand Telecommand decoding implementation
-             * @param[in] telecommands Array of pointers to telecommands
+             * @param[in] telecommands Dispatch table with telecommand handlers. Referenced, not copied.
+             */
+            IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand, const TelecommandTable& telecommands);
+
+            /**
+             * @brief Constructs \ref IncomingTelecommandHandler object that accepts segmented telecommands
+             * @param[in] decodeTelecommand Telecommand decoding implementation
+             * @param[in] telecommands Dispatch table with telecommand handlers. Referenced, not copied.
+             * @param[in] reassembly Reassembly of segmented telecommands, reassembled telecommands are dispatched
+             * using the same table
              */
-            IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand, gsl::span<IHandleTeleCommand*> telecommands);
+            IncomingTelecommandHandler(
+                IDecodeTelecommand& decodeTelecommand, const TelecommandTable& telecommands, SegmentReassembly& reassembly);
 
             /**
              * @brief Handles incoming frame and dispatches (if possible) telecommand
@@ -157,8 +179,10 @@ namespace telecommunication
 
             /** @brief Telecommand decoding implementation */
             IDecodeTelecommand& _decodeTelecommand;
-            /** @brief Array of pointers to telecommands */
-            gsl::span<IHandleTeleCommand*> _telecommands;
+            /** @brief Telecommand dispatch table */
+            const TelecommandTable& _telecommands;
+            /** @brief Reassembly of segmented telecommands, nullptr if segmented telecommands are not accepted */
+            SegmentReassembly* _reassembly;
         };
     }
 }
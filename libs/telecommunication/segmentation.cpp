@@ -0,0 +1,142 @@
+#include "segmentation.hpp"
+#include <algorithm>
+#include <cstring>
+#include "base/os.h"
+#include "base/reader.h"
+#include "downlink.h"
+#include "logger/logger.h"
+
+using devices::comm::ITransmitter;
+using telecommunication::downlink::CorrelatedDownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+
+using namespace telecommunication::uplink;
+
+constexpr std::uint8_t SegmentReassembly::Code;
+constexpr std::uint8_t SegmentReassembly::HeaderSize;
+constexpr std::uint8_t SegmentReassembly::MaxSegmentSize;
+constexpr std::uint8_t SegmentReassembly::MaxSegments;
+constexpr std::chrono::milliseconds SegmentReassembly::Timeout;
+
+SegmentReassembly::SegmentReassembly()
+    : _sizes{}, _streamId(0), _count(0), _received(0), _lastSegmentAt(0), _completedStreamId(0), _completedCount(0)
+{
+}
+
+gsl::span<const std::uint8_t> SegmentReassembly::Add(ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+{
+    Reader r(parameters);
+
+    const auto streamId = r.ReadByte();
+    const auto index = r.ReadByte();
+    const auto count = r.ReadByte();
+    const auto data = r.ReadToEnd();
+
+    if (!r.Status())
+    {
+        LOG(LOG_LEVEL_ERROR, "[tc] Malformed segment");
+        this->Acknowledge(transmitter, streamId, SegmentStatus::Malformed);
+        return {};
+    }
+
+    const auto now = System::GetUptime();
+
+    if (this->_count != 0 && now - this->_lastSegmentAt > Timeout)
+    {
+        LOGF(LOG_LEVEL_WARNING, "[tc] Dropping timed out segment stream %d", this->_streamId);
+        this->_count = 0;
+    }
+
+    const auto isCurrent = this->_count != 0 && streamId == this->_streamId;
+    const auto isCompleted = this->_completedCount != 0 && streamId == this->_completedStreamId;
+
+    if (count == 0)
+    {
+        this->Acknowledge(transmitter,
+            streamId,
+            isCurrent ? SegmentStatus::Incomplete : (isCompleted ? SegmentStatus::Complete : SegmentStatus::Unknown));
+        return {};
+    }
+
+    if (count > MaxSegments || index >= count || data.size() == 0 || data.size() > MaxSegmentSize)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[tc] Segment %d/%d of stream %d exceeds limits", index, count, streamId);
+        this->Acknowledge(transmitter, streamId, SegmentStatus::Malformed);
+        return {};
+    }
+
+    if (isCompleted && count == this->_completedCount)
+    {
+        this->Acknowledge(transmitter, streamId, SegmentStatus::Complete);
+        return {};
+    }
+
+    if (!isCurrent)
+    {
+        if (this->_count != 0)
+        {
+            LOGF(LOG_LEVEL_WARNING, "[tc] Dropping incomplete segment stream %d", this->_streamId);
+        }
+
+        this->Start(streamId, count);
+    }
+    else if (count != this->_count)
+    {
+        this->Acknowledge(transmitter, streamId, SegmentStatus::Malformed);
+        return {};
+    }
+
+    std::copy(data.begin(), data.end(), this->_buffer.begin() + index * MaxSegmentSize);
+    this->_sizes[index] = static_cast<std::uint8_t>(data.size());
+    this->_received |= 1 << index;
+    this->_lastSegmentAt = now;
+
+    if (this->_received != static_cast<std::uint8_t>((1u << this->_count) - 1))
+    {
+        return {};
+    }
+
+    this->_completedStreamId = streamId;
+    this->_completedCount = this->_count;
+    this->_count = 0;
+
+    this->Acknowledge(transmitter, streamId, SegmentStatus::Complete);
+
+    return this->Join();
+}
+
+void SegmentReassembly::Start(std::uint8_t streamId, std::uint8_t count)
+{
+    this->_streamId = streamId;
+    this->_count = count;
+    this->_received = 0;
+    this->_completedCount = 0;
+}
+
+gsl::span<const std::uint8_t> SegmentReassembly::Join()
+{
+    std::size_t size = 0;
+
+    for (auto i = 0; i < this->_completedCount; i++)
+    {
+        // segments never move forward, so copying front to back does not overwrite data that is still needed
+        std::memmove(this->_buffer.data() + size, this->_buffer.data() + i * MaxSegmentSize, this->_sizes[i]);
+        size += this->_sizes[i];
+    }
+
+    return gsl::make_span(this->_buffer).subspan(0, size);
+}
+
+void SegmentReassembly::Acknowledge(ITransmitter& transmitter, std::uint8_t streamId, SegmentStatus status) const
+{
+    const auto current = this->_count != 0 && streamId == this->_streamId;
+    const auto completed = status == SegmentStatus::Complete;
+
+    CorrelatedDownlinkFrame response(DownlinkAPID::UplinkSegments, 0, streamId);
+    auto& writer = response.PayloadWriter();
+    writer.WriteByte(num(status));
+    writer.WriteByte(completed ? this->_completedCount : (current ? this->_count : 0));
+    writer.WriteByte(completed ? static_cast<std::uint8_t>((1u << this->_completedCount) - 1) : (current ? this->_received : 0));
+
+    transmitter.SendFrame(response.Frame());
+}
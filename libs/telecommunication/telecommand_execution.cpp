@@ -0,0 +1,124 @@
+#include "telecommand_execution.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include "comm/Frame.hpp"
+#include "downlink.h"
+#include "logger/logger.h"
+
+using devices::comm::Frame;
+using devices::comm::ITransmitter;
+using telecommunication::downlink::CorrelatedDownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+
+using namespace telecommunication::uplink;
+
+constexpr std::uint8_t AsyncTelecommandHandler::Capacity;
+
+CancellationToken::CancellationToken() : _queued(0), _current(0), _cancelledThrough(std::numeric_limits<std::uint32_t>::max())
+{
+}
+
+void CancellationToken::Cancel()
+{
+    this->_cancelledThrough = this->_queued.load();
+}
+
+std::uint32_t CancellationToken::Enqueue()
+{
+    return ++this->_queued;
+}
+
+void CancellationToken::Begin(std::uint32_t operation)
+{
+    this->_current = operation;
+}
+
+bool CancellationToken::IsCancelled() const
+{
+    // difference is interpreted as signed value so comparison remains valid after operation id wraps around
+    return static_cast<std::int32_t>(this->_cancelledThrough - this->_current) >= 0;
+}
+
+AsyncTelecommandHandler::AsyncTelecommandHandler(devices::comm::IHandleFrame& handler,
+    IDecodeTelecommand& decodeTelecommand,
+    IHandleTeleCommand& immediate,
+    CancellationToken& cancellation)
+    : _handler(handler), _decodeTelecommand(decodeTelecommand), _immediate(immediate), _cancellation(cancellation), _taskHandle(nullptr),
+      _rejected(0)
+{
+}
+
+OSResult AsyncTelecommandHandler::Initialize()
+{
+    auto result = this->_frames.Create();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    return System::CreateTask(WorkerTask, "TcWorker", 4_KB, this, TaskPriority::P4, &this->_taskHandle);
+}
+
+void AsyncTelecommandHandler::HandleFrame(ITransmitter& transmitter, Frame& frame)
+{
+    const auto decodeResult = this->_decodeTelecommand.Decode(frame.Payload());
+    if (decodeResult.IsSuccess && decodeResult.CommandCode == this->_immediate.CommandCode())
+    {
+        this->_immediate.Handle(transmitter, decodeResult.Parameters);
+        return;
+    }
+
+    PendingFrame pending;
+    pending.Transmitter = &transmitter;
+    pending.Operation = this->_cancellation.Enqueue();
+    pending.Doppler = frame.Doppler();
+    pending.Rssi = frame.Rssi();
+    pending.Size = static_cast<std::uint8_t>(std::min<std::size_t>(frame.Size(), pending.Contents.size()));
+    std::memcpy(pending.Contents.data(), frame.Payload().data(), pending.Size);
+
+    if (OS_RESULT_FAILED(this->_frames.Push(pending, std::chrono::milliseconds::zero())))
+    {
+        LOG(LOG_LEVEL_ERROR, "[tc] Telecommand queue is full, rejecting frame");
+        this->_rejected++;
+
+        if (decodeResult.IsSuccess)
+        {
+            Reject(transmitter, decodeResult.CommandCode, decodeResult.Parameters);
+        }
+    }
+}
+
+std::uint32_t AsyncTelecommandHandler::Rejected() const
+{
+    return this->_rejected;
+}
+
+void AsyncTelecommandHandler::Reject(ITransmitter& transmitter, std::uint8_t commandCode, gsl::span<const std::uint8_t> parameters)
+{
+    // most telecommands start with correlation id, so it is echoed back to let ground match the response
+    const std::uint8_t correlationId = parameters.empty() ? 0 : parameters[0];
+
+    CorrelatedDownlinkFrame response(DownlinkAPID::TelecommandRejected, 0, correlationId);
+    response.PayloadWriter().WriteByte(commandCode);
+    transmitter.SendFrame(response.Frame());
+}
+
+void AsyncTelecommandHandler::WorkerTask(void* param)
+{
+    auto handler = static_cast<AsyncTelecommandHandler*>(param);
+    PendingFrame pending;
+
+    for (;;)
+    {
+        if (OS_RESULT_FAILED(handler->_frames.Pop(pending, InfiniteTimeout)))
+        {
+            continue;
+        }
+
+        Frame frame(pending.Doppler, pending.Rssi, pending.Size, gsl::make_span(pending.Contents).subspan(0, pending.Size));
+
+        handler->_cancellation.Begin(pending.Operation);
+        handler->_handler.HandleFrame(*pending.Transmitter, frame);
+    }
+}
@@ -1,7 +1,6 @@
 #include "telecommand_handling.h"
 #include <stdalign.h>
 #include <stdint.h>
-#include <algorithm>
 #include <array>
 #include "comm/Frame.hpp"
 #include "logger/logger.h"
@@ -17,9 +16,18 @@ using devices::comm::ITransmitter;
 
 using namespace telecommunication::uplink;
 
-IncomingTelecommandHandler::IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand, span<IHandleTeleCommand*> telecommands)
+IncomingTelecommandHandler::IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand, const TelecommandTable& telecommands)
     : _decodeTelecommand(decodeTelecommand), //
-      _telecommands(telecommands)
+      _telecommands(telecommands),           //
+      _reassembly(nullptr)
+{
+}
+
+IncomingTelecommandHandler::IncomingTelecommandHandler(
+    IDecodeTelecommand& decodeTelecommand, const TelecommandTable& telecommands, SegmentReassembly& reassembly)
+    : _decodeTelecommand(decodeTelecommand), //
+      _telecommands(telecommands),           //
+      _reassembly(&reassembly)
 {
 }
 
@@ -33,22 +41,31 @@ void IncomingTelecommandHandler::HandleFrame(ITransmitter& transmitter, Frame& f
         return;
     }
 
+    if (this->_reassembly != nullptr && decodeResult.CommandCode == SegmentReassembly::Code)
+    {
+        const auto telecommand = this->_reassembly->Add(transmitter, decodeResult.Parameters);
+        if (telecommand.size() > 0)
+        {
+            this->DispatchCommandHandler(transmitter, telecommand[0], telecommand.subspan(1));
+        }
+
+        return;
+    }
+
     this->DispatchCommandHandler(transmitter, decodeResult.CommandCode, decodeResult.Parameters);
 }
 
 void IncomingTelecommandHandler::DispatchCommandHandler(ITransmitter& transmitter, uint8_t commandCode, span<const uint8_t> parameters)
 {
-    auto command = std::find_if(this->_telecommands.begin(), this->_telecommands.end(), [commandCode](IHandleTeleCommand* p) {
-        return p->CommandCode() == commandCode;
-    });
+    auto command = this->_telecommands[commandCode];
 
-    if (command == this->_telecommands.end())
+    if (command == nullptr)
     {
         LOGF(LOG_LEVEL_ERROR, "No telecommand handler for code 0x%X", commandCode);
         return;
     }
 
-    (*command)->Handle(transmitter, parameters);
+    command->Handle(transmitter, parameters);
 }
 
 DecodeTelecommandResult::DecodeTelecommandResult(DecodeTelecommandFailureReason reason)
@@ -3,11 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <tuple>
+#include <type_traits>
+#include "base/BitWriter.hpp"
 #include "base/ITelemetryContainer.hpp"
 #include "base/writer.h"
+#include "gsl/span"
 #include "fwd.hpp"
 #include "traits.hpp"
 
@@ -158,6 +164,125 @@ namespace telemetry
              */
             static constexpr int Value = Base::BitSize();
         };
+
+        /**
+         * @brief Helper type that calculates offset of telemetry element in serialized telemetry.
+         * @ingroup telemetry_details
+         */
+        template <typename Arg, typename... Args> struct BitOffset;
+
+        /**
+         * @brief Helper type that calculates offset of telemetry element in serialized telemetry.
+         * @ingroup telemetry_details
+         *
+         * @remark Specialization for at least one telemetry element type.
+         */
+        template <typename Arg, typename Base, typename... Args> struct BitOffset<Arg, Base, Args...>
+        {
+            /**
+             * @brief This variable contains offset (in bits) of Arg type in collection that starts with Base type.
+             */
+            static constexpr int Value = std::is_same<Arg, Base>::value ? 0 : Base::BitSize() + BitOffset<Arg, Args...>::Value;
+        };
+
+        /**
+         * @brief Helper type that calculates offset of telemetry element in serialized telemetry.
+         * @ingroup telemetry_details
+         *
+         * @remark Specialization for empty list.
+         */
+        template <typename Arg> struct BitOffset<Arg>
+        {
+            /**
+             * @brief End of list
+             */
+            static constexpr int Value = 0;
+        };
+
+        /**
+         * @brief Checks whether new value of telemetry element may be serialized differently than the current one.
+         * @ingroup telemetry_details
+         * @param[in] current Current element value.
+         * @param[in] value New element value.
+         * @return True if element has to be serialized again, false otherwise.
+         *
+         * @remark Values are compared bytewise, therefore this function may report changes of elements whose serialized
+         * form remains the same, however it never misses actual change of value.
+         */
+        template <typename Type> inline bool IsValueChanged(const Type& current, const Type& value)
+        {
+            if (!std::is_trivially_copyable<Type>::value)
+            {
+                return true;
+            }
+
+            return std::memcmp(&current, &value, sizeof(Type)) != 0;
+        }
+
+        /**
+         * @brief Pads telemetry element that wrote fewer bits than its BitSize() with zeros.
+         * @ingroup telemetry_details
+         * @param[in] writer Buffer writer object used to serialize the element.
+         * @param[in] end Position (in bits) at which element slot ends.
+         */
+        template <typename WriterType> inline void PadElement(WriterType& writer, std::uint32_t end)
+        {
+            for (std::uint32_t position = writer.GetBitDataLength(); position < end && writer.Status();
+                 position = writer.GetBitDataLength())
+            {
+                writer.WriteWord(0, static_cast<std::uint8_t>(std::min<std::uint32_t>(end - position, 16)));
+            }
+        }
+
+        /**
+         * @brief Serializes single telemetry element into existing serialized telemetry without modifying any
+         * other bits.
+         * @ingroup telemetry_details
+         * @param[in] element Telemetry element.
+         * @param[in] image Buffer with serialized telemetry.
+         * @param[in] offset Offset (in bits) of the element in serialized telemetry.
+         * @return Operation status.
+         *
+         * @remark Element that writes fewer bits than its BitSize() is padded with zeros exactly as by
+         * @ref Telemetry::Write, so it always occupies its whole slot and does not affect neighbouring elements.
+         */
+        template <typename Type> bool WriteAt(const Type& element, gsl::span<std::uint8_t> image, std::uint32_t offset)
+        {
+            constexpr std::uint32_t BitsPerByte = std::numeric_limits<std::uint8_t>::digits;
+
+            std::array<std::uint8_t, (Type::BitSize() + 2 * BitsPerByte - 2) / BitsPerByte> scratch{};
+            const std::uint32_t shift = offset % BitsPerByte;
+            const std::uint32_t bits = shift + Type::BitSize();
+            const std::uint32_t bytes = (bits + BitsPerByte - 1) / BitsPerByte;
+            const std::uint32_t first = offset / BitsPerByte;
+
+            BitWriter writer(scratch);
+            writer.WriteWord(0, shift);
+            element.Write(writer);
+
+            if (!writer.Status() || writer.GetBitDataLength() > bits || (first + bytes) > static_cast<std::uint32_t>(image.size()))
+            {
+                return false;
+            }
+
+            for (std::uint32_t i = 0; i < bytes; ++i)
+            {
+                std::uint8_t mask = 0xff;
+                if (i == 0)
+                {
+                    mask &= static_cast<std::uint8_t>(0xff << shift);
+                }
+
+                if (i == bytes - 1 && (bits % BitsPerByte) != 0)
+                {
+                    mask &= static_cast<std::uint8_t>((1 << (bits % BitsPerByte)) - 1);
+                }
+
+                image[first + i] = static_cast<std::uint8_t>((image[first + i] & ~mask) | (scratch[i] & mask));
+            }
+
+            return true;
+        }
     }
 
     /**
@@ -215,6 +340,13 @@ namespace telemetry
         static constexpr int TotalSerializedSize =
             (PayloadSize + std::numeric_limits<std::uint8_t>::digits - 1) / std::numeric_limits<std::uint8_t>::digits;
 
+        /**
+         * @brief Returns offset of telemetry element in serialized telemetry.
+         * @tparam Arg Type of queried telemetry element.
+         * @return Offset (in bits) of the telemetry element.
+         */
+        template <typename Arg> static constexpr int BitOffset();
+
         virtual Telemetry<Type...>& GetOwner() final override;
 
         virtual const Telemetry<Type...>& GetOwner() const final override;
@@ -263,9 +395,35 @@ namespace telemetry
         /**
          * @brief This function is responsible for writing all telemetry elements to the passed buffer writer.
          * @param[in] writer Buffer writer object that should be used to write the serialized state.
+         *
+         * Element that writes fewer bits than its BitSize() is padded with zeros, so each element starts
+         * at its @ref BitOffset and the result is identical to image updated by @ref WriteChanged.
          */
         template <typename WriterType> void Write(WriterType& writer) const;
 
+        /**
+         * @brief This function returns information whether value of at least one telemetry element changed since
+         * last call to @ref WriteChanged.
+         * @return True if serialized telemetry is not up to date, false otherwise.
+         */
+        bool IsChanged() const;
+
+        /**
+         * @brief Updates serialized telemetry by serializing only telemetry elements whose value changed
+         * since last call to this method.
+         * @param[in] image Buffer with serialized telemetry. This buffer should be preserved between subsequent calls.
+         * @return Operation status.
+         *
+         * Each telemetry element is written at its fixed offset (@ref BitOffset). Bits that belong to other elements
+         * are not modified.
+         */
+        bool WriteChanged(gsl::span<std::uint8_t> image);
+
+        /**
+         * @brief Marks all telemetry elements as changed so the next call to @ref WriteChanged serializes entire telemetry.
+         */
+        void InvalidateSerialized();
+
         /**
          * @brief Informs telemetry container that all changes have been saved. And from now on the telemetry
          * elements should be considered unmodified.
@@ -278,7 +436,15 @@ namespace telemetry
          * has been mofidied since last save.
          * @tparam Arg Telemetry element type.
          */
-        template <typename Arg> using ElementContainer = std::pair<Arg, bool>;
+        template <typename Arg> struct ElementContainer
+        {
+            /** @brief Telemetry element value */
+            Arg Value;
+            /** @brief Flag indicating whether element has been modified since last save */
+            bool Modified = false;
+            /** @brief Flag indicating whether element value changed since it was last serialized */
+            bool Changed = true;
+        };
 
         typedef std::tuple<ElementContainer<Type>...> Container;
 
@@ -298,6 +464,18 @@ namespace telemetry
 
         template <int Tag> void CommitCaptureInternal();
 
+        template <int Tag, typename T, typename... Args> bool IsChangedInternal() const;
+
+        template <int Tag> bool IsChangedInternal() const;
+
+        template <int Tag, typename T, typename... Args> bool WriteChangedInternal(gsl::span<std::uint8_t> image);
+
+        template <int Tag> bool WriteChangedInternal(gsl::span<std::uint8_t> image);
+
+        template <int Tag, typename T, typename... Args> void InvalidateSerializedInternal();
+
+        template <int Tag> void InvalidateSerializedInternal();
+
         /**
          * @brief std::tuple that contains all the telemetry elements.
          */
@@ -308,6 +486,11 @@ namespace telemetry
     template <typename... Type> constexpr int Telemetry<Type...>::PayloadSize;
     template <typename... Type> constexpr int Telemetry<Type...>::TotalSerializedSize;
 
+    template <typename... Type> template <typename Arg> constexpr int Telemetry<Type...>::BitOffset()
+    {
+        return details::BitOffset<Arg, Type...>::Value;
+    }
+
     template <typename... Type> Telemetry<Type...>& Telemetry<Type...>::GetOwner()
     {
         return *this;
@@ -321,18 +504,21 @@ namespace telemetry
     template <typename... Type> template <typename Arg> void Telemetry<Type...>::Set(const Arg& arg)
     {
         auto& entry = std::get<ElementContainer<Arg>>(this->storage);
-        entry.first = arg;
-        entry.second = true;
+        entry.Changed = entry.Changed || details::IsValueChanged(entry.Value, arg);
+        entry.Value = arg;
+        entry.Modified = true;
     }
 
     template <typename... Type> template <typename Arg> void Telemetry<Type...>::SetVolatile(const Arg& arg)
     {
-        std::get<ElementContainer<Arg>>(this->storage).first = arg;
+        auto& entry = std::get<ElementContainer<Arg>>(this->storage);
+        entry.Changed = entry.Changed || details::IsValueChanged(entry.Value, arg);
+        entry.Value = arg;
     }
 
     template <typename... Type> template <typename Arg> const Arg& Telemetry<Type...>::Get() const
     {
-        return std::get<ElementContainer<Arg>>(this->storage).first;
+        return std::get<ElementContainer<Arg>>(this->storage).Value;
     }
 
     template <typename... Type> inline bool Telemetry<Type...>::IsModified() const
@@ -342,7 +528,7 @@ namespace telemetry
 
     template <typename... Type> template <int Tag, typename T, typename... Args> inline bool Telemetry<Type...>::IsModifiedInternal() const
     {
-        return std::get<ElementContainer<T>>(this->storage).second || IsModifiedInternal<0, Args...>();
+        return std::get<ElementContainer<T>>(this->storage).Modified || IsModifiedInternal<0, Args...>();
     }
 
     template <typename... Type> template <int Tag> inline bool Telemetry<Type...>::IsModifiedInternal() const
@@ -360,6 +546,21 @@ namespace telemetry
         return WriteInternal<WriterType, Type...>(writer);
     }
 
+    template <typename... Type> inline bool Telemetry<Type...>::IsChanged() const
+    {
+        return IsChangedInternal<0, Type...>();
+    }
+
+    template <typename... Type> inline bool Telemetry<Type...>::WriteChanged(gsl::span<std::uint8_t> image)
+    {
+        return WriteChangedInternal<0, Type...>(image);
+    }
+
+    template <typename... Type> inline void Telemetry<Type...>::InvalidateSerialized()
+    {
+        InvalidateSerializedInternal<0, Type...>();
+    }
+
     template <typename... Type> inline void Telemetry<Type...>::CommitCapture()
     {
         CommitCaptureInternal<0, Type...>();
@@ -370,9 +571,9 @@ namespace telemetry
     inline void Telemetry<Type...>::WriteModifiedInternal(WriterType& writer) const
     {
         const auto& entry = std::get<ElementContainer<T>>(this->storage);
-        if (entry.second)
+        if (entry.Modified)
         {
-            entry.first.Write(writer);
+            entry.Value.Write(writer);
         }
 
         WriteModifiedInternal<WriterType, Args...>(writer);
@@ -389,7 +590,9 @@ namespace telemetry
     inline void Telemetry<Type...>::WriteInternal(WriterType& writer) const
     {
         const auto& entry = std::get<ElementContainer<T>>(this->storage);
-        entry.first.Write(writer);
+        const std::uint32_t start = writer.GetBitDataLength();
+        entry.Value.Write(writer);
+        details::PadElement(writer, start + T::BitSize());
         WriteInternal<WriterType, Args...>(writer);
     }
 
@@ -399,13 +602,56 @@ namespace telemetry
 
     template <typename... Type> template <int Tag, typename T, typename... Args> inline void Telemetry<Type...>::CommitCaptureInternal()
     {
-        std::get<ElementContainer<T>>(this->storage).second = false;
+        std::get<ElementContainer<T>>(this->storage).Modified = false;
         CommitCaptureInternal<0, Args...>();
     }
 
     template <typename... Type> template <int Tag> inline void Telemetry<Type...>::CommitCaptureInternal()
     {
     }
+
+    template <typename... Type> template <int Tag, typename T, typename... Args> inline bool Telemetry<Type...>::IsChangedInternal() const
+    {
+        return std::get<ElementContainer<T>>(this->storage).Changed || IsChangedInternal<0, Args...>();
+    }
+
+    template <typename... Type> template <int Tag> inline bool Telemetry<Type...>::IsChangedInternal() const
+    {
+        return false;
+    }
+
+    template <typename... Type>
+    template <int Tag, typename T, typename... Args>
+    inline bool Telemetry<Type...>::WriteChangedInternal(gsl::span<std::uint8_t> image)
+    {
+        auto& entry = std::get<ElementContainer<T>>(this->storage);
+        if (entry.Changed)
+        {
+            if (!details::WriteAt(entry.Value, image, BitOffset<T>()))
+            {
+                return false;
+            }
+
+            entry.Changed = false;
+        }
+
+        return WriteChangedInternal<0, Args...>(image);
+    }
+
+    template <typename... Type> template <int Tag> inline bool Telemetry<Type...>::WriteChangedInternal(gsl::span<std::uint8_t> /*image*/)
+    {
+        return true;
+    }
+
+    template <typename... Type> template <int Tag, typename T, typename... Args> inline void Telemetry<Type...>::InvalidateSerializedInternal()
+    {
+        std::get<ElementContainer<T>>(this->storage).Changed = true;
+        InvalidateSerializedInternal<0, Args...>();
+    }
+
+    template <typename... Type> template <int Tag> inline void Telemetry<Type...>::InvalidateSerializedInternal()
+    {
+    }
 }
 
 #endif
@@ -191,7 +191,8 @@ namespace telemetry
         ImtqCoilTemperature,                    //
         ImtqStatus,                             //
         ImtqState,                              //
-        ImtqSelfTest                            //
+        ImtqSelfTest,                           //
+        devices::comm::DownlinkQueueTelemetry   //
         >
         ManagedTelemetry;
 }
@@ -11,7 +11,9 @@
 #include "Telemetry.hpp"
 #include "TimeTelemetry.hpp"
 #include "antenna/telemetry.hpp"
+#include "base/snapshot.hpp"
 #include "comm/CommTelemetry.hpp"
+#include "comm/DownlinkQueue.hpp"
 #include "fwd.hpp"
 #include "gyro/telemetry.hpp"
 #include "state/time/TimeState.hpp"
@@ -19,6 +21,12 @@
 
 namespace telemetry
 {
+    /**
+     * @brief Type of buffer that contains serialized telemetry.
+     * @ingroup telemetry
+     */
+    using SerializedTelemetry = std::array<std::uint8_t, ManagedTelemetry::TotalSerializedSize>;
+
     /**
      * @brief This type represents state of telemetry acquisition loop.
      * @ingroup telemetry
@@ -37,14 +45,11 @@ namespace telemetry
         ManagedTelemetry telemetry;
 
         /**
-         * @brief Handle to semaphore that protects access to serialized telemetry.
-         */
-        OSSemaphoreHandle bufferLock;
-
-        /**
-         * @brief Buffer that contains serialized state of the last seen telemetry state.
+         * @brief Snapshot that contains serialized state of the last seen telemetry state.
+         *
+         * Snapshot is published by telemetry serialization and read without blocking by telemetry archive and beacon.
          */
-        std::array<std::uint8_t, ManagedTelemetry::TotalSerializedSize> lastSerializedTelemetry;
+        Snapshot<SerializedTelemetry> serializedTelemetry;
     };
 
     static_assert(ProgramState::BitSize() == 16, "Invalid serialized size");
@@ -65,7 +70,7 @@ namespace telemetry
     static_assert(ImtqSelfTest::BitSize() == 64, "Invalid serialized size");
 
     static_assert(ManagedTelemetry::TotalSerializedSize <= 230, "Telemetry is too large");
-    static_assert(ManagedTelemetry::PayloadSize == 1832, "Invalid Telemetry Size");
+    static_assert(ManagedTelemetry::PayloadSize == 1840, "Invalid Telemetry Size");
 }
 
 #endif
@@ -15,6 +15,7 @@ namespace telemetry
         descriptor.name = "Antenna Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::SystemBus;
         return descriptor;
     }
 
@@ -49,6 +49,41 @@ namespace telemetry
          */
         devices::comm::ICommTelemetryProvider* provider;
     };
+
+    /**
+     * @brief This task is responsible for acquiring & updating downlink queue telemetry.
+     * @telemetry_acquisition
+     * @ingroup telemetry
+     */
+    class DownlinkQueueTelemetryAcquisition : public mission::Update
+    {
+      public:
+        /**
+         * @brief ctor.
+         * @param[in] queue Reference to downlink queue
+         */
+        DownlinkQueueTelemetryAcquisition(devices::comm::IDownlinkQueueTelemetryProvider& queue);
+
+        /**
+         * @brief Builds update descriptor for this task.
+         * @return Update descriptor - the downlink queue telemetry acquisition update task.
+         */
+        mission::UpdateDescriptor<telemetry::TelemetryState> BuildUpdate();
+
+      private:
+        /**
+         * @brief Updates current downlink queue telemetry in global state.
+         * @param[in] state Reference to global state.
+         * @param[in] param Current execution context.
+         * @return Telemetry acquisition result.
+         */
+        static mission::UpdateResult UpdateProc(telemetry::TelemetryState& state, void* param);
+
+        /**
+         * @brief Reference to downlink queue.
+         */
+        devices::comm::IDownlinkQueueTelemetryProvider& _queue;
+    };
 }
 
 #endif
@@ -14,6 +14,7 @@ namespace telemetry
         descriptor.name = "Comm Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::SystemBus;
         return descriptor;
     }
 
@@ -35,4 +36,26 @@ namespace telemetry
         auto This = static_cast<CommTelemetryAcquisition*>(param);
         return This->UpdateCommTelemetry(state);
     }
+
+    DownlinkQueueTelemetryAcquisition::DownlinkQueueTelemetryAcquisition(devices::comm::IDownlinkQueueTelemetryProvider& queue)
+        : _queue(queue)
+    {
+    }
+
+    mission::UpdateDescriptor<telemetry::TelemetryState> DownlinkQueueTelemetryAcquisition::BuildUpdate()
+    {
+        mission::UpdateDescriptor<telemetry::TelemetryState> descriptor;
+        descriptor.name = "Downlink Queue Telemetry Acquisition";
+        descriptor.updateProc = UpdateProc;
+        descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
+        return descriptor;
+    }
+
+    mission::UpdateResult DownlinkQueueTelemetryAcquisition::UpdateProc(telemetry::TelemetryState& state, void* param)
+    {
+        auto This = static_cast<DownlinkQueueTelemetryAcquisition*>(param);
+        state.telemetry.Set(This->_queue.GetQueueTelemetry());
+        return mission::UpdateResult::Ok;
+    }
 }
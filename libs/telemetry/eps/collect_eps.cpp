@@ -13,6 +13,7 @@ namespace telemetry
         descriptor.name = "Eps Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::SystemBus;
         return descriptor;
     }
 
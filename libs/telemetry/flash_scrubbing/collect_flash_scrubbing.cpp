@@ -13,6 +13,7 @@ namespace telemetry
         descriptor.name = "Flash Scrubbing Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
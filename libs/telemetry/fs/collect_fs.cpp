@@ -13,12 +13,14 @@ namespace telemetry
         descriptor.name = "Filesystem Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
     mission::UpdateResult FileSystemTelemetryAcquisition::UpdateTelemetry(telemetry::TelemetryState& state)
     {
-        const auto size = this->provider->GetFreeSpace("/");
+        // statistics are maintained by file system, so flash is not accessed here
+        const auto size = this->provider->GetStatistics().FreeBytes;
         if (size == std::numeric_limits<std::uint32_t>::max())
         {
             LOG(LOG_LEVEL_ERROR, "Unable to acquire filesystem telemetry. ");
@@ -61,6 +61,7 @@ namespace telemetry
         descriptor.name = "GPIO Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
@@ -13,6 +13,7 @@ namespace telemetry
         descriptor.name = "Gyroscope Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::PayloadBus;
         return descriptor;
     }
 
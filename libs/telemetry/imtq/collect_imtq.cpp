@@ -14,6 +14,7 @@ namespace telemetry
         descriptor.name = "Imtq Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
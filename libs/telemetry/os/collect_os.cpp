@@ -13,6 +13,7 @@ namespace telemetry
         descriptor.name = "OS Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = nullptr;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
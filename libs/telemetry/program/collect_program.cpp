@@ -40,6 +40,7 @@ namespace telemetry
         descriptor.name = "Program Crc Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
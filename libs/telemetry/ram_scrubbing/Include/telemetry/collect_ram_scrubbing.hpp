@@ -48,6 +48,7 @@ namespace telemetry
         descriptor.name = "RAM Scrubbing Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
@@ -3,11 +3,24 @@
 
 #pragma once
 
+#include <array>
 #include "mission/base.hpp"
 #include "telemetry/state.hpp"
 
 namespace telemetry
 {
+    /**
+     * @brief Telemetry serialization mode
+     * @ingroup telemetry
+     */
+    enum class SerializationMode
+    {
+        /** @brief Entire telemetry is serialized on each iteration */
+        Full,
+        /** @brief Only telemetry elements whose value changed are serialized into persistent image */
+        Incremental,
+    };
+
     /**
      * @brief This task is responsible for observing the telemetry container state and as soon
      * as change is observed prepare its serialized form.
@@ -19,9 +32,9 @@ namespace telemetry
       public:
         /**
          * @brief ctor.
-         * @param p dummy
+         * @param mode Serialization mode
          */
-        TelemetrySerialization(int p);
+        TelemetrySerialization(SerializationMode mode);
         /**
          * @brief Builds update descriptor for this task.
          * @return Action descriptor - the telemetry change save task.
@@ -36,7 +49,27 @@ namespace telemetry
         mission::UpdateResult SaveTelemetry(TelemetryState& state);
 
       private:
+        /**
+         * @brief Serializes entire telemetry.
+         * @param state Reference to global telemetry acquisition state object.
+         * @return Operation status.
+         */
+        mission::UpdateResult SaveFullTelemetry(TelemetryState& state);
+
+        /**
+         * @brief Serializes changed telemetry elements into persistent image.
+         * @param state Reference to global telemetry acquisition state object.
+         * @return Operation status.
+         */
+        mission::UpdateResult SaveChangedTelemetry(TelemetryState& state);
+
         static mission::UpdateResult Proxy(TelemetryState& state, void* param);
+
+        /** @brief Serialization mode */
+        SerializationMode _mode;
+
+        /** @brief Persistent serialized telemetry image (used in incremental mode) */
+        SerializedTelemetry _image;
     };
 }
 
@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <tuple>
+#include <utility>
+#include "base/os.h"
 #include "fs/fs.h"
 #include "gsl/span"
 #include "mission/base.hpp"
+#include "power/power.h"
 #include "telemetry/state.hpp"
 
 namespace mission
@@ -37,6 +41,67 @@ namespace mission
          * @brief This value determines how often the telemetry should be saved.
          */
         std::chrono::milliseconds delay;
+
+        /**
+         * @brief Size of buffered telemetry entries that triggers writing them to file.
+         *
+         * This value should be equal to the file system chunk size. Buffered entries are written up to the
+         * last chunk boundary they reach, the rest of them is kept in memory until next write.
+         */
+        std::uint16_t flushSize;
+
+        /**
+         * @brief Maximal time for which telemetry entry is kept in memory before being written to file.
+         *
+         * Zero value disables buffering - each entry is written to file immediately.
+         */
+        std::chrono::milliseconds flushDelay;
+
+        /**
+         * @brief Path to index of current telemetry event file. nullptr disables indexing.
+         */
+        const char* currentIndexFileName;
+
+        /**
+         * @brief Path to index of previous telemetry event file.
+         */
+        const char* previousIndexFileName;
+
+        /**
+         * @brief Number of telemetry entries between subsequent index entries.
+         */
+        std::uint8_t indexInterval;
+    };
+
+    /**
+     * @brief Receiver of telemetry entries read from telemetry archive.
+     * @ingroup telemetry
+     */
+    struct ITelemetryEntryReceiver
+    {
+        /**
+         * @brief Processes single telemetry entry.
+         * @param[in] time Mission time at which entry was saved.
+         * @param[in] entry Serialized telemetry.
+         * @return true to continue reading, false to stop.
+         */
+        virtual bool Receive(std::chrono::milliseconds time, gsl::span<const std::uint8_t> entry) = 0;
+    };
+
+    /**
+     * @brief Telemetry archive that can be queried by mission time.
+     * @ingroup telemetry
+     */
+    struct ITelemetryArchive
+    {
+        /**
+         * @brief Reads archived telemetry entries saved within given mission time window.
+         * @param[in] from Beginning of the time window (inclusive).
+         * @param[in] to End of the time window (inclusive).
+         * @param[in] receiver Receiver of telemetry entries, entries are passed in order they were saved.
+         * @return true if at least one telemetry file has been found, false otherwise.
+         */
+        virtual bool Query(std::chrono::milliseconds from, std::chrono::milliseconds to, ITelemetryEntryReceiver& receiver) = 0;
     };
 
     /**
@@ -57,8 +122,20 @@ namespace mission
      *
      * The telemetry archivization process is done by removing \a previous \a telemetry \a file and
      * changing \a current \a telemetry \a file name to \a previous \a telemetry \a file name.
+     *
+     * Telemetry entries are first collected in memory ring buffer and are appended to the \a current
+     * \a telemetry \a file in batches once they fill single file system chunk, the oldest of them
+     * becomes older than configured flush delay or right before power cycle. Batches triggered by size
+     * end exactly at file system chunk boundary (entry crossing it is written partially and completed
+     * by the next batch), so each chunk is programmed once. Entries are stored in the file exactly
+     * as if they were written one by one. Entry left incomplete by reset between such batches is
+     * truncated from the file before the next batch is appended.
+     *
+     * Each telemetry file is accompanied by sparse index that contains mission time and offset of every
+     * n-th entry (list of 64-bit LE mission time in ms followed by 32-bit LE offset). The index lets
+     * @ref Query skip entries older than requested time window without reading them.
      */
-    class TelemetryTask : public Action
+    class TelemetryTask : public Action, public services::power::INotifyPowerCycle, public ITelemetryArchive
     {
       public:
         /**
@@ -67,6 +144,12 @@ namespace mission
          */
         TelemetryTask(std::tuple<services::fs::IFileSystem&, TelemetryConfiguration> arguments);
 
+        /**
+         * @brief Initializes telemetry task.
+         * @return Operation status, true on success, false otherwise.
+         */
+        bool Initialize();
+
         /**
          * @brief Builds action descriptor for this task.
          * @return Action descriptor - the telemetry save task.
@@ -91,9 +174,46 @@ namespace mission
          */
         bool SaveToFile(gsl::span<const std::uint8_t> buffer);
 
+        /**
+         * @brief Writes all buffered telemetry entries to the current telemetry event file.
+         * @return Operation status, true on success, false otherwise.
+         */
+        bool Flush();
+
+        /**
+         * @brief Writes buffered telemetry entries to file before power is lost.
+         */
+        virtual void BeforePowerCycle() override;
+
+        /**
+         * @brief Reads archived telemetry entries saved within given mission time window.
+         * @param[in] from Beginning of the time window (inclusive).
+         * @param[in] to End of the time window (inclusive).
+         * @param[in] receiver Receiver of telemetry entries, entries are passed in order they were saved.
+         * @return true if at least one telemetry file has been found, false otherwise.
+         *
+         * Buffered entries are written to file first. Buffer lock is held only while telemetry files are
+         * opened and each entry is read, so files are neither appended nor archived during the read, while
+         * telemetry can still be saved when receiver takes long to handle the entry.
+         */
+        virtual bool Query(std::chrono::milliseconds from, std::chrono::milliseconds to, ITelemetryEntryReceiver& receiver) override;
+
+        /**
+         * @brief Extracts mission time from serialized telemetry entry.
+         * @param[in] entry Serialized telemetry
+         * @return Mission time at which entry was saved.
+         */
+        static std::chrono::milliseconds EntryTime(gsl::span<const std::uint8_t> entry);
+
         /** @brief Number of bytes to which telemetry entries in file should be aligned */
         static constexpr std::uint8_t AlignFileEntriesTo = 230;
 
+        /** @brief Maximal number of telemetry entries buffered in memory */
+        static constexpr std::uint8_t MaxBufferedEntries = 10;
+
+        /** @brief Size of single index entry */
+        static constexpr std::uint8_t IndexEntrySize = 12;
+
       private:
         /**
          * @brief Condition for telemetry saving action.
@@ -114,6 +234,112 @@ namespace mission
 
         static UpdateResult UpdateState(telemetry::TelemetryState& state, void* param);
 
+        /**
+         * @brief Appends telemetry entry to the ring buffer, dropping the oldest entry if buffer is full.
+         * @param[in] entry Serialized telemetry
+         * @param[in] now Current mission time
+         */
+        void BufferEntry(gsl::span<const std::uint8_t> entry, std::chrono::milliseconds now);
+
+        /**
+         * @brief Checks whether buffered entries should be written to file.
+         * @param[in] now Current mission time
+         * @return true if entries should be written, false otherwise.
+         */
+        bool IsFlushRequired(std::chrono::milliseconds now) const;
+
+        /**
+         * @brief Checks whether all buffered entries have to be written to file.
+         * @param[in] now Current mission time
+         * @return true if buffer is full or the oldest entry is older than flush delay, false otherwise.
+         */
+        bool IsBufferExpired(std::chrono::milliseconds now) const;
+
+        /**
+         * @brief Writes buffered entries to file. Buffer lock has to be held by the caller.
+         * @param[in] wholeChunks Write only data that ends at file system chunk boundary.
+         * @return Operation status, true on success, false otherwise.
+         *
+         * Entries that have been written are removed from buffer even if writing the rest of them fails.
+         */
+        bool FlushEntries(bool wholeChunks);
+
+        /**
+         * @brief Returns part of buffered data.
+         * @param[in] position Position of data measured from the beginning of the oldest buffered entry.
+         * @param[in] length Size of data
+         * @return Data split into two parts at the end of ring buffer.
+         */
+        std::pair<gsl::span<const std::uint8_t>, gsl::span<const std::uint8_t>> BufferedData(std::size_t position, std::size_t length) const;
+
+        /**
+         * @brief Opens current telemetry event file for writing.
+         * @param[in] archive Controls whether file that is too large should be archived first.
+         * @param[out] size Size of opened file.
+         * @return Opened file. Caller is responsible for verifying its state.
+         */
+        services::fs::File OpenCurrentFile(bool archive, services::fs::FileSize& size);
+
+        /**
+         * @brief Appends data to the current telemetry event file, archiving it first if it is too large.
+         * @param[in] first First part of data
+         * @param[in] second Second part of data, written right after the first one
+         * @return Operation status, true on success, false otherwise.
+         */
+        bool WriteToFile(gsl::span<const std::uint8_t> first, gsl::span<const std::uint8_t> second);
+
+        /**
+         * @brief Appends index entries for telemetry entries written to the current telemetry event file.
+         * @param[in] offset Offset in file at which data was written
+         * @param[in] first First part of written data
+         * @param[in] second Second part of written data
+         * @return Operation status, true on success, false otherwise.
+         */
+        bool UpdateIndex(std::uint32_t offset, gsl::span<const std::uint8_t> first, gsl::span<const std::uint8_t> second);
+
+        /**
+         * @brief Archives index of the current telemetry event file together with the file itself.
+         */
+        void ArchiveIndex();
+
+        /**
+         * @brief Finds offset of the last indexed entry saved not later than requested time.
+         * @param[in] file Telemetry event file
+         * @param[in] indexPath Path to index of telemetry event file
+         * @param[in] from Requested mission time
+         * @return Offset from which file should be read, zero if index is not available or is not valid.
+         * @remark Buffer lock has to be held by the caller.
+         */
+        services::fs::FileSize FindIndexedOffset(services::fs::File& file, const char* indexPath, std::chrono::milliseconds from);
+
+        /**
+         * @brief Reads single telemetry entry from telemetry event file.
+         * @param[in] file Telemetry event file
+         * @param[in] offset Offset of the entry in file
+         * @param[out] entry Buffer for the entry
+         * @return true if whole entry has been read, false otherwise.
+         * @remark Buffer lock is taken for the duration of the read.
+         */
+        bool ReadEntry(services::fs::File& file, services::fs::FileSize offset, telemetry::SerializedTelemetry& entry);
+
+        /**
+         * @brief Reads telemetry entries from single telemetry event file.
+         * @param[in] path Path to telemetry event file
+         * @param[in] indexPath Path to index of telemetry event file
+         * @param[in] from Beginning of the time window (inclusive).
+         * @param[in] to End of the time window (inclusive).
+         * @param[in] receiver Receiver of telemetry entries
+         * @param[out] finished Set to true if no further entries should be read.
+         * @return true if file exists, false otherwise.
+         * @remark Buffer lock is taken internally and released before each entry is passed to the receiver.
+         */
+        bool QueryFile(const char* path,
+            const char* indexPath,
+            std::chrono::milliseconds from,
+            std::chrono::milliseconds to,
+            ITelemetryEntryReceiver& receiver,
+            bool& finished);
+
         /**
          * @brief File system provider.
          */
@@ -131,7 +357,27 @@ namespace mission
 
         /** @brief Timestamp of last saved telemetry */
         std::chrono::milliseconds lastTelemetrySave;
+
+        /** @brief Semaphore protecting buffered entries */
+        OSSemaphoreHandle bufferLock;
+
+        /** @brief Ring buffer of telemetry entries, each padded to @ref AlignFileEntriesTo bytes */
+        std::array<std::uint8_t, MaxBufferedEntries * AlignFileEntriesTo> entries;
+
+        /** @brief Index of the oldest buffered entry */
+        std::uint8_t firstEntry;
+
+        /** @brief Number of buffered entries */
+        std::uint8_t bufferedEntries;
+
+        /** @brief Number of bytes of the oldest buffered entry that have already been written to file */
+        std::uint8_t writtenBytes;
+
+        /** @brief Timestamp of the oldest buffered entry */
+        std::chrono::milliseconds oldestEntryTime;
     };
+
+    static_assert(sizeof(telemetry::SerializedTelemetry) <= TelemetryTask::AlignFileEntriesTo, "Telemetry entry is too large");
 }
 
 #endif /* LIBS_MISSION_INCLUDE_MISSION_TELEMETRY_HPP_ */
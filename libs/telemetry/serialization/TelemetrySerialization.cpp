@@ -1,15 +1,13 @@
 #include "mission/TelemetrySerialization.hpp"
 #include <cassert>
-#include <cstring>
 #include "base/BitWriter.hpp"
 #include "logger/logger.h"
 
 namespace telemetry
 {
-    using namespace std::chrono_literals;
-
-    TelemetrySerialization::TelemetrySerialization(int /*p*/)
+    TelemetrySerialization::TelemetrySerialization(SerializationMode mode) : _mode(mode)
     {
+        this->_image.fill(0);
     }
 
     mission::UpdateDescriptor<TelemetryState> TelemetrySerialization::BuildUpdate()
@@ -23,7 +21,17 @@ namespace telemetry
 
     mission::UpdateResult TelemetrySerialization::SaveTelemetry(TelemetryState& state)
     {
-        decltype(TelemetryState::lastSerializedTelemetry) buffer;
+        if (this->_mode == SerializationMode::Incremental)
+        {
+            return SaveChangedTelemetry(state);
+        }
+
+        return SaveFullTelemetry(state);
+    }
+
+    mission::UpdateResult TelemetrySerialization::SaveFullTelemetry(TelemetryState& state)
+    {
+        SerializedTelemetry buffer;
         BitWriter writer(buffer);
         state.telemetry.Write(writer);
         assert(writer.Status());
@@ -39,12 +47,25 @@ namespace telemetry
             return mission::UpdateResult::Warning;
         }
 
-        Lock lock(state.bufferLock, 5s);
-        if (static_cast<bool>(lock))
+        state.serializedTelemetry.Publish(buffer);
+        return mission::UpdateResult::Ok;
+    }
+
+    mission::UpdateResult TelemetrySerialization::SaveChangedTelemetry(TelemetryState& state)
+    {
+        if (!state.telemetry.IsChanged())
         {
-            std::memcpy(state.lastSerializedTelemetry.data(), buffer.data(), buffer.size());
+            return mission::UpdateResult::Ok;
+        }
+
+        if (!state.telemetry.WriteChanged(this->_image))
+        {
+            LOG(LOG_LEVEL_ERROR, "Unable to update serialized telemetry");
+            state.telemetry.InvalidateSerialized();
+            return mission::UpdateResult::Failure;
         }
 
+        state.serializedTelemetry.Publish(this->_image);
         return mission::UpdateResult::Ok;
     }
 
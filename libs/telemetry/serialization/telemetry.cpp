@@ -1,6 +1,9 @@
 #include "mission/telemetry.hpp"
+#include <algorithm>
 #include <cassert>
 #include "base/BitWriter.hpp"
+#include "base/reader.h"
+#include "base/writer.h"
 #include "logger/logger.h"
 #include "telemetry/state.hpp"
 
@@ -9,12 +12,37 @@ namespace mission
     using namespace std::chrono_literals;
     using services::fs::SeekOrigin;
 
+    constexpr std::uint8_t TelemetryTask::AlignFileEntriesTo;
+
+    constexpr std::uint8_t TelemetryTask::MaxBufferedEntries;
+
+    constexpr std::uint8_t TelemetryTask::IndexEntrySize;
+
     TelemetryTask::TelemetryTask(std::tuple<services::fs::IFileSystem&, TelemetryConfiguration> arguments)
         : provider(std::get<0>(arguments)),      //
           configuration(std::get<1>(arguments)), //
           delay(configuration.delay),            //
-          lastTelemetrySave(0ms)
+          lastTelemetrySave(0ms),                //
+          bufferLock(nullptr),
+          firstEntry(0),
+          bufferedEntries(0),
+          writtenBytes(0),
+          oldestEntryTime(0ms)
     {
+        this->entries.fill(0);
+    }
+
+    bool TelemetryTask::Initialize()
+    {
+        this->bufferLock = System::CreateBinarySemaphore();
+        if (this->bufferLock == nullptr)
+        {
+            LOG(LOG_LEVEL_ERROR, "Unable to create telemetry buffer lock. ");
+            return false;
+        }
+
+        System::GiveSemaphore(this->bufferLock);
+        return true;
     }
 
     ActionDescriptor<telemetry::TelemetryState> TelemetryTask::BuildAction()
@@ -45,29 +73,107 @@ namespace mission
 
     void TelemetryTask::Save(telemetry::TelemetryState& stateObject)
     {
-        decltype(telemetry::TelemetryState::lastSerializedTelemetry) content;
+        telemetry::SerializedTelemetry content;
+        if (!stateObject.serializedTelemetry.Get(content))
+        {
+            LOG(LOG_LEVEL_WARNING, "Serialized telemetry is not available. ");
+            return;
+        }
 
+        const auto now = stateObject.telemetry.Get<telemetry::InternalTimeTelemetry>().Time();
+
+        Lock lock(this->bufferLock, 5s);
+        if (!static_cast<bool>(lock))
         {
-            Lock lock(stateObject.bufferLock, 5s);
-            if (static_cast<bool>(lock))
-            {
-                memcpy(content.data(), stateObject.lastSerializedTelemetry.data(), content.size());
-            }
-            else
-            {
-                LOG(LOG_LEVEL_WARNING, "Unable to acquire access to serialized telemetry. ");
-                return;
-            }
+            LOG(LOG_LEVEL_WARNING, "Unable to acquire access to telemetry buffer. ");
+            return;
         }
 
-        if (SaveToFile(content))
+        BufferEntry(content, now);
+
+        if (!IsFlushRequired(now) || FlushEntries(!IsBufferExpired(now)))
         {
-            auto time = stateObject.telemetry.Get<telemetry::InternalTimeTelemetry>();
-            this->lastTelemetrySave = time.Time();
+            this->lastTelemetrySave = now;
         }
     }
 
-    static inline std::size_t CalculateBestOffset(std::size_t currentSize)
+    bool TelemetryTask::Flush()
+    {
+        Lock lock(this->bufferLock, 5s);
+        if (!static_cast<bool>(lock))
+        {
+            LOG(LOG_LEVEL_WARNING, "Unable to acquire access to telemetry buffer. ");
+            return false;
+        }
+
+        return FlushEntries(false);
+    }
+
+    void TelemetryTask::BeforePowerCycle()
+    {
+        Flush();
+    }
+
+    void TelemetryTask::BufferEntry(gsl::span<const std::uint8_t> entry, std::chrono::milliseconds now)
+    {
+        if (this->bufferedEntries == MaxBufferedEntries)
+        {
+            LOG(LOG_LEVEL_WARNING, "Telemetry buffer is full, dropping oldest entry. ");
+            this->firstEntry = (this->firstEntry + 1) % MaxBufferedEntries;
+            this->bufferedEntries--;
+            this->writtenBytes = 0;
+        }
+
+        if (this->bufferedEntries == 0)
+        {
+            this->oldestEntryTime = now;
+        }
+
+        const auto slot = (this->firstEntry + this->bufferedEntries) % MaxBufferedEntries;
+        auto target = gsl::make_span(this->entries).subspan(slot * AlignFileEntriesTo, AlignFileEntriesTo);
+        auto end = std::copy(entry.begin(), entry.end(), target.begin());
+        std::fill(end, target.end(), 0);
+
+        this->bufferedEntries++;
+    }
+
+    bool TelemetryTask::IsFlushRequired(std::chrono::milliseconds now) const
+    {
+        if (this->bufferedEntries * AlignFileEntriesTo - this->writtenBytes >= this->configuration.flushSize)
+        {
+            return true;
+        }
+
+        return IsBufferExpired(now);
+    }
+
+    bool TelemetryTask::IsBufferExpired(std::chrono::milliseconds now) const
+    {
+        if (this->bufferedEntries == MaxBufferedEntries)
+        {
+            return true;
+        }
+
+        const auto age = now - this->oldestEntryTime;
+        return (age < 0ms) || (age >= this->configuration.flushDelay);
+    }
+
+    std::pair<gsl::span<const std::uint8_t>, gsl::span<const std::uint8_t>> TelemetryTask::BufferedData(
+        std::size_t position, std::size_t length) const
+    {
+        auto buffer = gsl::make_span(this->entries);
+        const auto start = (this->firstEntry * AlignFileEntriesTo + position) % buffer.size();
+        const auto firstLength = std::min<std::size_t>(length, buffer.size() - start);
+        return std::make_pair(buffer.subspan(start, firstLength), buffer.subspan(0, length - firstLength));
+    }
+
+    /**
+     * @brief Drops partially written entry at the end of telemetry file (e.g. after reset in the middle of chunked write)
+     * @param file Telemetry file
+     * @param currentSize Current file size
+     * @return Offset at which next entry should be written
+     */
+    static services::fs::FileSize DropPartialEntry(services::fs::File& file, services::fs::FileSize currentSize)
     {
         auto rem = currentSize % TelemetryTask::AlignFileEntriesTo;
 
@@ -76,10 +182,96 @@ namespace mission
             return currentSize;
         }
 
+        if (OS_RESULT_SUCCEEDED(file.Truncate(currentSize - rem)))
+        {
+            LOG(LOG_LEVEL_WARNING, "Dropped partially written telemetry entry. ");
+            return currentSize - rem;
+        }
+
+        // torn entry stays in file, at least do not append to it
+        LOG(LOG_LEVEL_ERROR, "Unable to drop partially written telemetry entry. ");
         return currentSize + (TelemetryTask::AlignFileEntriesTo - rem);
     }
 
+    bool TelemetryTask::FlushEntries(bool wholeChunks)
+    {
+        if (this->bufferedEntries == 0)
+        {
+            return true;
+        }
+
+        services::fs::FileSize size;
+        auto file = OpenCurrentFile(this->writtenBytes == 0, size);
+        if (!file)
+        {
+            return false;
+        }
+
+        if (this->writtenBytes != 0 && (size % AlignFileEntriesTo) != this->writtenBytes)
+        {
+            LOG(LOG_LEVEL_WARNING, "Telemetry file does not end with partially written entry. ");
+            this->writtenBytes = 0;
+        }
+
+        const std::uint32_t offset = (this->writtenBytes != 0) ? size : DropPartialEntry(file, size);
+        std::uint32_t length = this->bufferedEntries * AlignFileEntriesTo - this->writtenBytes;
+        if (wholeChunks && this->configuration.flushSize > 0)
+        {
+            const std::uint32_t end = (offset + length) / this->configuration.flushSize * this->configuration.flushSize;
+            if (end <= offset)
+            {
+                return true;
+            }
+
+            length = end - offset;
+        }
+
+        file.Seek(SeekOrigin::Begin, offset);
+
+        const auto data = BufferedData(this->writtenBytes, length);
+        std::uint32_t written = 0;
+        bool status = static_cast<bool>(file.Write(data.first));
+        if (status)
+        {
+            written += data.first.size();
+            if (!data.second.empty())
+            {
+                status = static_cast<bool>(file.Write(data.second));
+                if (status)
+                {
+                    written += data.second.size();
+                }
+            }
+        }
+
+        // index entries that begin in written data, complete entries are still available in the buffer
+        const std::uint32_t firstIndexed = (this->writtenBytes + AlignFileEntriesTo - 1) / AlignFileEntriesTo;
+        const std::uint32_t endIndexed = (this->writtenBytes + written + AlignFileEntriesTo - 1) / AlignFileEntriesTo;
+        if (endIndexed > firstIndexed)
+        {
+            const auto indexed = BufferedData(firstIndexed * AlignFileEntriesTo, (endIndexed - firstIndexed) * AlignFileEntriesTo);
+            if (!UpdateIndex(offset - this->writtenBytes + firstIndexed * AlignFileEntriesTo, indexed.first, indexed.second))
+            {
+                LOGF(LOG_LEVEL_WARNING, "Unable to update telemetry index: '%s'.", this->configuration.currentIndexFileName);
+            }
+        }
+
+        // drop everything that has been written, so it is not written again when the rest of write failed
+        const std::uint32_t position = this->writtenBytes + written;
+        const auto completed = position / AlignFileEntriesTo;
+        this->firstEntry = (this->firstEntry + completed) % MaxBufferedEntries;
+        this->bufferedEntries -= completed;
+        this->writtenBytes = position % AlignFileEntriesTo;
+
+        return status;
+    }
+
     bool TelemetryTask::SaveToFile(gsl::span<const std::uint8_t> buffer)
+    {
+        return WriteToFile(buffer, gsl::span<const std::uint8_t>());
+    }
+
+    services::fs::File TelemetryTask::OpenCurrentFile(bool archive, services::fs::FileSize& size)
     {
         services::fs::File file(this->provider, //
             this->configuration.currentFileName,
@@ -88,39 +280,332 @@ namespace mission
         if (!file)
         {
             LOGF(LOG_LEVEL_ERROR, "Unable to open telemetry file: '%s'.", this->configuration.currentFileName);
+            return file;
+        }
+
+        size = file.Size();
+        if (!archive || size < this->configuration.maxFileSize)
+        {
+            return file;
+        }
+
+        file.Close();
+
+        const auto status = this->provider.Move(this->configuration.currentFileName, this->configuration.previousFileName);
+        if (OS_RESULT_FAILED(status))
+        {
+            LOGF(LOG_LEVEL_ERROR,
+                "Unable to archive telemetry file: '%s' as '%s'.",
+                this->configuration.currentFileName,
+                this->configuration.previousFileName);
+            return file;
+        }
+
+        ArchiveIndex();
+
+        file = services::fs::File(this->provider,
+            this->configuration.currentFileName,
+            services::fs::FileOpen::CreateAlways,
+            services::fs::FileAccess::WriteOnly);
+        if (!file)
+        {
+            LOGF(LOG_LEVEL_ERROR, "Unable to open telemetry file: '%s'.", this->configuration.currentFileName);
+            return file;
+        }
+
+        size = file.Size();
+        return file;
+    }
+
+    bool TelemetryTask::WriteToFile(gsl::span<const std::uint8_t> first, gsl::span<const std::uint8_t> second)
+    {
+        services::fs::FileSize size;
+        auto file = OpenCurrentFile(true, size);
+        if (!file)
+        {
+            return false;
+        }
+
+        const auto offset = DropPartialEntry(file, size);
+        file.Seek(SeekOrigin::Begin, offset);
+
+        if (!file.Write(first))
+        {
+            return false;
+        }
+
+        if (!second.empty() && !file.Write(second))
+        {
             return false;
         }
 
-        auto size = file.Size();
-        if (size >= this->configuration.maxFileSize)
+        if (!UpdateIndex(offset, first, second))
         {
-            file.Close();
+            LOGF(LOG_LEVEL_WARNING, "Unable to update telemetry index: '%s'.", this->configuration.currentIndexFileName);
+        }
+
+        return true;
+    }
+
+    std::chrono::milliseconds TelemetryTask::EntryTime(gsl::span<const std::uint8_t> entry)
+    {
+        constexpr auto Offset = telemetry::ManagedTelemetry::BitOffset<telemetry::InternalTimeTelemetry>();
+        constexpr auto Size = telemetry::InternalTimeTelemetry::BitSize();
+
+        std::uint64_t time = 0;
+        for (std::uint32_t bit = 0; bit < Size; bit++)
+        {
+            const auto position = Offset + bit;
+            if ((entry[position / 8] & (1 << (position % 8))) != 0)
+            {
+                time |= (1ull << bit);
+            }
+        }
 
-            const auto status = this->provider.Move(this->configuration.currentFileName, this->configuration.previousFileName);
-            if (OS_RESULT_FAILED(status))
+        return std::chrono::milliseconds(time);
+    }
+
+    static void AppendIndexEntries(Writer& writer, std::uint32_t offset, std::uint8_t interval, gsl::span<const std::uint8_t> data)
+    {
+        for (std::ptrdiff_t position = 0; position < data.size(); position += TelemetryTask::AlignFileEntriesTo)
+        {
+            const auto entryOffset = offset + position;
+            const auto entry = data.subspan(position, std::min<std::ptrdiff_t>(TelemetryTask::AlignFileEntriesTo, data.size() - position));
+            if ((entryOffset / TelemetryTask::AlignFileEntriesTo) % interval != 0 || entry.size() < telemetry::ManagedTelemetry::TotalSerializedSize)
             {
-                LOGF(LOG_LEVEL_ERROR,
-                    "Unable to archive telemetry file: '%s' as '%s'.",
-                    this->configuration.currentFileName,
-                    this->configuration.previousFileName);
+                continue;
+            }
+
+            writer.WriteQuadWordLE(TelemetryTask::EntryTime(entry).count());
+            writer.WriteDoubleWordLE(entryOffset);
+        }
+    }
+
+    bool TelemetryTask::UpdateIndex(std::uint32_t offset, gsl::span<const std::uint8_t> first, gsl::span<const std::uint8_t> second)
+    {
+        if (this->configuration.currentIndexFileName == nullptr || this->configuration.indexInterval == 0)
+        {
+            return true;
+        }
+
+        std::array<std::uint8_t, MaxBufferedEntries * IndexEntrySize> buffer;
+        Writer writer(buffer);
+        AppendIndexEntries(writer, offset, this->configuration.indexInterval, first);
+        AppendIndexEntries(writer, offset + first.size(), this->configuration.indexInterval, second);
+
+        if (writer.GetDataLength() == 0)
+        {
+            return true;
+        }
+
+        services::fs::File index(this->provider, //
+            this->configuration.currentIndexFileName,
+            services::fs::FileOpen::OpenAlways,
+            services::fs::FileAccess::WriteOnly);
+        if (!index)
+        {
+            return false;
+        }
+
+        index.Seek(SeekOrigin::End, 0);
+        return static_cast<bool>(index.Write(writer.Capture()));
+    }
+
+    void TelemetryTask::ArchiveIndex()
+    {
+        if (this->configuration.currentIndexFileName == nullptr)
+        {
+            return;
+        }
+
+        this->provider.Unlink(this->configuration.previousIndexFileName);
+        if (OS_RESULT_FAILED(this->provider.Move(this->configuration.currentIndexFileName, this->configuration.previousIndexFileName)))
+        {
+            this->provider.Unlink(this->configuration.currentIndexFileName);
+        }
+    }
+
+    bool TelemetryTask::Query(std::chrono::milliseconds from, std::chrono::milliseconds to, ITelemetryEntryReceiver& receiver)
+    {
+        {
+            Lock lock(this->bufferLock, 5s);
+            if (!static_cast<bool>(lock))
+            {
+                LOG(LOG_LEVEL_WARNING, "Unable to acquire access to telemetry archive. ");
                 return false;
             }
 
-            file = services::fs::File(this->provider,
-                this->configuration.currentFileName,
-                services::fs::FileOpen::CreateAlways,
-                services::fs::FileAccess::WriteOnly);
+            FlushEntries(false);
+        }
+
+        bool finished = false;
+        const auto previous = QueryFile(this->configuration.previousFileName, //
+            this->configuration.previousIndexFileName,
+            from,
+            to,
+            receiver,
+            finished);
+        if (finished)
+        {
+            return true;
+        }
+
+        const auto current = QueryFile(this->configuration.currentFileName, //
+            this->configuration.currentIndexFileName,
+            from,
+            to,
+            receiver,
+            finished);
+
+        return previous || current;
+    }
+
+    services::fs::FileSize TelemetryTask::FindIndexedOffset(services::fs::File& file, const char* indexPath, std::chrono::milliseconds from)
+    {
+        if (indexPath == nullptr)
+        {
+            return 0;
+        }
+
+        services::fs::File index(this->provider, indexPath, services::fs::FileOpen::Existing, services::fs::FileAccess::ReadOnly);
+        if (!index)
+        {
+            return 0;
+        }
+
+        std::array<std::uint8_t, 8 * IndexEntrySize> buffer;
+        services::fs::FileSize offset = 0;
+        std::chrono::milliseconds offsetTime(0);
+        bool found = false;
+        bool done = false;
+        auto remaining = index.Size();
+
+        while (!done && remaining >= IndexEntrySize)
+        {
+            const auto chunk = std::min<services::fs::FileSize>(remaining, buffer.size());
+            const auto read = index.Read(gsl::make_span(buffer).subspan(0, chunk - chunk % IndexEntrySize));
+            if (!read || read.Result.empty())
+            {
+                break;
+            }
+
+            remaining -= read.Result.size();
+
+            Reader reader(read.Result);
+            while (true)
+            {
+                const auto time = std::chrono::milliseconds(reader.ReadQuadWordLE());
+                const auto entryOffset = reader.ReadDoubleWordLE();
+                if (!reader.Status())
+                {
+                    break;
+                }
+
+                if (time > from)
+                {
+                    done = true;
+                    break;
+                }
+
+                offset = entryOffset;
+                offsetTime = time;
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            return 0;
+        }
+
+        // index may be out of sync with telemetry file, verify that indexed entry is in place
+        telemetry::SerializedTelemetry entry;
+        if (OS_RESULT_FAILED(file.Seek(SeekOrigin::Begin, offset)))
+        {
+            return 0;
+        }
+
+        const auto read = file.Read(entry);
+        if (!read || read.Result.size() != static_cast<std::ptrdiff_t>(entry.size()) || EntryTime(entry) != offsetTime)
+        {
+            LOGF(LOG_LEVEL_WARNING, "Telemetry index '%s' is not valid.", indexPath);
+            return 0;
+        }
+
+        return offset;
+    }
+
+    bool TelemetryTask::ReadEntry(services::fs::File& file, services::fs::FileSize offset, telemetry::SerializedTelemetry& entry)
+    {
+        Lock lock(this->bufferLock, 5s);
+        if (!static_cast<bool>(lock))
+        {
+            LOG(LOG_LEVEL_WARNING, "Unable to acquire access to telemetry archive. ");
+            return false;
+        }
+
+        if (OS_RESULT_FAILED(file.Seek(SeekOrigin::Begin, offset)))
+        {
+            return false;
+        }
+
+        const auto read = file.Read(entry);
+        return read && read.Result.size() == static_cast<std::ptrdiff_t>(entry.size());
+    }
+
+    bool TelemetryTask::QueryFile(const char* path,
+        const char* indexPath,
+        std::chrono::milliseconds from,
+        std::chrono::milliseconds to,
+        ITelemetryEntryReceiver& receiver,
+        bool& finished)
+    {
+        // telemetry files must not be written or archived while they are being read, however lock is not held
+        // while receiver handles the entry as sending it may take long and would block saving telemetry
+        services::fs::File file;
+        services::fs::FileSize size;
+        services::fs::FileSize offset;
+        {
+            Lock lock(this->bufferLock, 5s);
+            if (!static_cast<bool>(lock))
+            {
+                LOG(LOG_LEVEL_WARNING, "Unable to acquire access to telemetry archive. ");
+                finished = true;
+                return false;
+            }
+
+            file = services::fs::File(this->provider, path, services::fs::FileOpen::Existing, services::fs::FileAccess::ReadOnly);
             if (!file)
             {
-                LOGF(LOG_LEVEL_ERROR, "Unable to open telemetry file: '%s'.", this->configuration.currentFileName);
                 return false;
             }
 
             size = file.Size();
+            offset = FindIndexedOffset(file, indexPath, from);
         }
 
-        file.Seek(SeekOrigin::Begin, CalculateBestOffset(size));
+        telemetry::SerializedTelemetry entry;
+
+        for (; offset + static_cast<services::fs::FileSize>(entry.size()) <= size; offset += AlignFileEntriesTo)
+        {
+            if (!ReadEntry(file, offset, entry))
+            {
+                break;
+            }
+
+            const auto time = EntryTime(entry);
+            if (time < from)
+            {
+                continue;
+            }
+
+            if (time > to || !receiver.Receive(time, entry))
+            {
+                finished = true;
+                break;
+            }
+        }
 
-        return static_cast<bool>(file.Write(buffer));
+        return true;
     }
 }
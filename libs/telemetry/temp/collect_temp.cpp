@@ -13,6 +13,7 @@ namespace telemetry
         descriptor.name = "Mcu temperature acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
@@ -14,6 +14,7 @@ namespace telemetry
         descriptor.name = "Antenna Telemetry Acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::PayloadBus;
         return descriptor;
     }
 
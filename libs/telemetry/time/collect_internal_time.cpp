@@ -14,6 +14,7 @@ namespace telemetry
         descriptor.name = "Internal time telemetry acquisition";
         descriptor.updateProc = UpdateProc;
         descriptor.param = this;
+        descriptor.resource = mission::UpdateResource::Cpu;
         return descriptor;
     }
 
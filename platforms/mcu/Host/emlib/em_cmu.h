@@ -0,0 +1,9 @@
+#ifndef PLATFORMS_MCU_HOST_EMLIB_EM_CMU_H_
+#define PLATFORMS_MCU_HOST_EMLIB_EM_CMU_H_
+
+/**
+ * @file
+ * @brief Host stand-in for emlib CMU header. Clock management is not available on host.
+ */
+
+#endif /* PLATFORMS_MCU_HOST_EMLIB_EM_CMU_H_ */
@@ -0,0 +1,59 @@
+#ifndef PLATFORMS_MCU_HOST_EMLIB_EM_GPIO_H_
+#define PLATFORMS_MCU_HOST_EMLIB_EM_GPIO_H_
+
+#include <cstdint>
+
+/**
+ * @file
+ * @brief Host stand-in for emlib GPIO header.
+ *
+ * Provides types and no-op operations used by GPIO driver wrappers so that code depending on them
+ * can be built natively. Pins always read as low.
+ */
+
+/** @brief GPIO ports */
+typedef enum {
+    gpioPortA = 0,
+    gpioPortB = 1,
+    gpioPortC = 2,
+    gpioPortD = 3,
+    gpioPortE = 4,
+    gpioPortF = 5
+} GPIO_Port_TypeDef;
+
+/** @brief GPIO pin modes */
+typedef enum {
+    gpioModeDisabled,
+    gpioModeInput,
+    gpioModeInputPull,
+    gpioModeInputPullFilter,
+    gpioModePushPull,
+    gpioModeWiredAnd
+} GPIO_Mode_TypeDef;
+
+inline void GPIO_PinModeSet(GPIO_Port_TypeDef, unsigned int, GPIO_Mode_TypeDef, unsigned int)
+{
+}
+
+inline void GPIO_PinOutSet(GPIO_Port_TypeDef, unsigned int)
+{
+}
+
+inline void GPIO_PinOutClear(GPIO_Port_TypeDef, unsigned int)
+{
+}
+
+inline void GPIO_PinOutToggle(GPIO_Port_TypeDef, unsigned int)
+{
+}
+
+inline unsigned int GPIO_PinInGet(GPIO_Port_TypeDef, unsigned int)
+{
+    return 0;
+}
+
+inline void GPIO_IntConfig(GPIO_Port_TypeDef, unsigned int, bool, bool, bool)
+{
+}
+
+#endif /* PLATFORMS_MCU_HOST_EMLIB_EM_GPIO_H_ */
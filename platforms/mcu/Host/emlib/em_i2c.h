@@ -0,0 +1,9 @@
+#ifndef PLATFORMS_MCU_HOST_EMLIB_EM_I2C_H_
+#define PLATFORMS_MCU_HOST_EMLIB_EM_I2C_H_
+
+/**
+ * @file
+ * @brief Host stand-in for emlib I2C header. I2C peripheral is not available on host.
+ */
+
+#endif /* PLATFORMS_MCU_HOST_EMLIB_EM_I2C_H_ */
@@ -0,0 +1,27 @@
+set(HOST_BUILD TRUE)
+
+set(USE_EXTERNAL_FLASH FALSE CACHE BOOL "Use external N25Q flash memory")
+
+add_definitions(-DHOST_BUILD)
+
+if(${CMAKE_BUILD_TYPE} STREQUAL "Debug")
+    add_definitions(-DENABLE_ASSERT)
+endif()
+
+find_package(Threads REQUIRED)
+
+# Warnings are not turned into errors on host: newer host compilers report issues that GNU ARM toolchain does not
+set (CWARN "-Wall -Wstrict-prototypes -Wextra")
+set (CXXWARN "-Wall -Wextra")
+set (CTUNING "-ggdb -pedantic -fno-omit-frame-pointer -ffunction-sections -fdata-sections")
+set (CMAKE_C_FLAGS "-std=gnu11 ${CWARN} ${CTUNING}")
+set (CMAKE_CXX_FLAGS "-std=gnu++1y -fno-exceptions ${CXXWARN} ${CTUNING}")
+set (CMAKE_CXX_STANDARD 14)
+
+set(DEBUG_COMP_OPTIONS "-DDEBUG -O0 -g")
+set(RELEASE_COMP_OPTIONS "-DNDEBUG -O2")
+
+set(CMAKE_C_FLAGS_DEBUG ${DEBUG_COMP_OPTIONS})
+set(CMAKE_CXX_FLAGS_DEBUG ${DEBUG_COMP_OPTIONS})
+set(CMAKE_C_FLAGS_RELEASE ${RELEASE_COMP_OPTIONS})
+set(CMAKE_CXX_FLAGS_RELEASE ${RELEASE_COMP_OPTIONS})
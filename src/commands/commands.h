@@ -36,6 +36,7 @@ void CompileInfo(std::uint16_t argc, char* argv[]);
 void SuspendMission(std::uint16_t argc, char* argv[]);
 void ResumeMission(std::uint16_t argc, char* argv[]);
 void RunMission(std::uint16_t argc, char* argv[]);
+void MissionProfile(std::uint16_t argc, char* argv[]);
 void SetFiboIterations(std::uint16_t argc, char* argv[]);
 
 void RequestExperiment(std::uint16_t argc, char* argv[]);
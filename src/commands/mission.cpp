@@ -1,3 +1,4 @@
+#include <cstring>
 #include "mission.h"
 #include "antenna/antenna.h"
 #include "logger/logger.h"
@@ -33,6 +34,82 @@ void RunMission(std::uint16_t argc, char* argv[])
     Mission.RequestSingleIteration();
 }
 
+static const char* ProfiledElementName(mission::ProfiledElement kind)
+{
+    switch (kind)
+    {
+        case mission::ProfiledElement::Update:
+            return "update";
+        case mission::ProfiledElement::Verify:
+            return "verify";
+        case mission::ProfiledElement::Action:
+            return "action";
+        case mission::ProfiledElement::Iteration:
+            return "loop";
+        default:
+            return "?";
+    }
+}
+
+void MissionProfile(std::uint16_t argc, char* argv[])
+{
+    if (argc < 1)
+    {
+        GetTerminal().Puts("mission_profile <mission|telemetry> [reset|threshold <ms>]");
+        return;
+    }
+
+    mission::IMissionLoopProfile* profile;
+
+    if (strcmp(argv[0], "mission") == 0)
+    {
+        profile = &Mission;
+    }
+    else if (strcmp(argv[0], "telemetry") == 0)
+    {
+        profile = &TelemetryAcquisition;
+    }
+    else
+    {
+        GetTerminal().Puts("Unknown mission loop");
+        return;
+    }
+
+    if (argc == 2 && strcmp(argv[1], "reset") == 0)
+    {
+        profile->ResetTimings();
+        return;
+    }
+
+    if (argc == 3 && strcmp(argv[1], "threshold") == 0)
+    {
+        profile->SetOverrunThreshold(std::chrono::milliseconds(atoi(argv[2])));
+        return;
+    }
+
+    auto timings = profile->Timings();
+    if (timings.empty())
+    {
+        GetTerminal().Puts("Mission loop profiling disabled\n");
+        return;
+    }
+
+    GetTerminal().Puts("Kind\tName\tRuns\tMin\tAvg\tMax\tLast\tOverruns\n");
+
+    for (auto& timing : timings)
+    {
+        GetTerminal().Printf("%s\t%s\t%lu\t%ld\t%ld\t%ld\t%ld\t%d\n",
+            ProfiledElementName(timing.Kind),
+            timing.Name,
+            static_cast<unsigned long>(timing.Runs),
+            static_cast<long>(timing.Min.count()),
+            static_cast<long>(timing.Average().count()),
+            static_cast<long>(timing.Max.count()),
+            static_cast<long>(timing.Last.count()),
+            timing.Overruns);
+    }
+}
+
 void SetFiboIterations(std::uint16_t argc, char* argv[])
 {
     if (argc != 1)
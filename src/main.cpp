@@ -56,6 +56,7 @@ devices::comm::ICommHardwareObserver* GetCommHardwareObserver()
 }
 
 telemetry::ObcTelemetryAcquisition TelemetryAcquisition(Main.Hardware.CommDriver,
+    Main.Communication.Downlink,
     Main.Hardware.Gyro,
     Main.Fdir,
     Main.Hardware.EPS,
@@ -71,8 +72,10 @@ telemetry::ObcTelemetryAcquisition TelemetryAcquisition(Main.Hardware.CommDriver
     0,
     Main.Hardware.imtqTelemetryCollector,
     0,
-    0,
-    std::make_tuple(std::ref(Main.fs), mission::TelemetryConfiguration{"/telemetry.current", "/telemetry.previous", 512_KB, 30s}));
+    telemetry::SerializationMode::Incremental,
+    std::make_tuple(std::ref(Main.fs),
+        mission::TelemetryConfiguration{
+            "/telemetry.current", "/telemetry.previous", 512_KB, 30s, 2_KB, 5min, "/telemetry.current.idx", "/telemetry.previous.idx", 16}));
 
 static void PerformMemoryRecovery();
 
@@ -87,7 +90,7 @@ mission::ObcMission Mission(&PerformMemoryRecovery, //
     Main.Fdir,
     std::tie(Main.Hardware.PersistentStorage, PersistentStateBaseAddress),
     Main.fs,
-    Main.Hardware.CommDriver,
+    Main.Communication.Downlink,
     Main.Hardware.EPS,
     std::make_pair(std::ref(Main.Experiments.ExperimentsController), std::ref(Main.timeProvider)),
     GetCommHardwareObserver(),
@@ -252,7 +255,7 @@ static void ObcInitTask(void* param)
 
     System::SuspendTask(NULL);
 
-    beacon::BeaconSender sender(Main.Hardware.CommDriver, TelemetryAcquisition);
+    beacon::BeaconSender sender(Main.Communication.Downlink, TelemetryAcquisition);
 
     while (1)
     {
@@ -72,6 +72,7 @@ namespace telemetry
 {
     typedef mission::MissionLoop<TelemetryState, //
         CommTelemetryAcquisition,                //
+        DownlinkQueueTelemetryAcquisition,       //
         GyroTelemetryAcquisition,                //
         ErrorCounterTelemetryAcquisition,        //
         EpsTelemetryAcquisition,                 //
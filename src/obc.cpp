@@ -117,7 +117,11 @@ OBC::OBC()
           Hardware.Gyro,
           Camera.PhotoService,
           Hardware.EPS,
-          adcs.GetAdcsCoordinator()),
+          adcs.GetAdcsCoordinator(),
+          Mission,
+          TelemetryAcquisition,
+          Mission,
+          TelemetryAcquisition),
       Scrubbing(this->Hardware, this->BootTable, this->BootSettings, boot::Index),         //
       terminal(this->Hardware.Terminal),                                                   //
       camera(this->Fdir.ErrorCounting(), this->Hardware.Camera),                           //
@@ -190,16 +194,29 @@ OSResult OBC::InitializeRunlevel1()
         this->Fdir.LoadConfig(errorCountersConfig._config);
     }
 
-    if (!Mission.Initialize(10s))
+    if (!Mission.Initialize(10s, 60s))
     {
         LOG(LOG_LEVEL_ERROR, "[obc] Unable to initialize mission loop.");
     }
 
+#ifdef PARALLEL_TELEMETRY_UPDATE
+    if (OS_RESULT_FAILED(this->TelemetryUpdateWorkers.Initialize()))
+    {
+        LOG(LOG_LEVEL_ERROR, "[obc] Unable to initialize telemetry update workers.");
+    }
+    else
+    {
+        TelemetryAcquisition.EnableParallelUpdate(this->TelemetryUpdateWorkers);
+    }
+#endif
+
     if (!TelemetryAcquisition.Initialize(30s))
     {
         LOG(LOG_LEVEL_ERROR, "[obc] Unable to initialize telemetry acquisition loop.");
     }
 
+    this->PowerControlInterface.SetPowerCycleObserver(TelemetryAcquisition);
+
     Camera.InitializeRunlevel1();
 
     BootSettings.ConfirmBoot();
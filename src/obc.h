@@ -16,6 +16,7 @@
 #include "fs/yaffs.h"
 #include "imtq/imtq.h"
 #include "line_io.h"
+#include "mission/parallel.hpp"
 #include "n25q/n25q.h"
 #include "n25q/yaffs.h"
 #include "obc/adcs.hpp"
@@ -140,6 +141,11 @@ struct OBC
 
     /** @brief Camera */
     obc::OBCCamera Camera;
+
+#ifdef PARALLEL_TELEMETRY_UPDATE
+    /** @brief Workers executing telemetry acquisition concurrently */
+    mission::UpdateWorkerPool TelemetryUpdateWorkers;
+#endif
 };
 
 /** @brief Global OBC object. */
@@ -30,6 +30,7 @@ static const TerminalCommandDescription commands[] = {
     {"suspend_mission", SuspendMission},
     {"resume_mission", ResumeMission},
     {"run_mission", RunMission},
+    {"mission_profile", MissionProfile},
     {"set_fibo_iterations", SetFiboIterations},
     {"request_experiment", RequestExperiment},
     {"abort_experiment", AbortExperiment},
@@ -138,6 +138,16 @@ class PosixFileSystem : public IFileSystem
     {
         return 0;
     }
+
+    virtual FileSystemStatistics GetStatistics() override
+    {
+        return FileSystemStatistics{0, 0, 0, 0};
+    }
+
+    virtual DirectoryUsageResult GetDirectoryUsage(const char* /*path*/) override
+    {
+        return DirectoryUsageResult(OSResult::NotSupported, DirectoryUsage{0, 0, 0});
+    }
 };
 
 void GenerateSunSData(IFileSystem& fs);
@@ -48,6 +48,8 @@ class FsMock : public services::fs::IFileSystem
     MOCK_METHOD2(GetFileSize, services::fs::FileSize(const char* dir, const char* file));
     MOCK_METHOD3(Seek, OSResult(services::fs::FileHandle file, services::fs::SeekOrigin origin, services::fs::FileSize offset));
     MOCK_METHOD1(GetFreeSpace, std::uint32_t(const char* devicePath));
+    MOCK_METHOD0(GetStatistics, services::fs::FileSystemStatistics());
+    MOCK_METHOD1(GetDirectoryUsage, services::fs::DirectoryUsageResult(const char* path));
 
     void AddFile(const char* path, gsl::span<std::uint8_t> contents);
 
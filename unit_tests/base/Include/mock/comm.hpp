@@ -5,6 +5,7 @@
 #include "gmock/gmock.h"
 #include "comm/Beacon.hpp"
 #include "comm/CommTelemetry.hpp"
+#include "comm/DownlinkQueue.hpp"
 #include "comm/IBeaconController.hpp"
 #include "comm/ITransmitter.hpp"
 #include "comm/comm.hpp"
@@ -21,7 +22,14 @@ struct TransmitterMock : public devices::comm::ITransmitter
     MOCK_METHOD1(SetTransmitterBitRate, bool(devices::comm::Bitrate));
     MOCK_METHOD0(ResetTransmitter, bool());
 
+    /** @brief Frames built in place are verified by expectations on SendFrame */
+    virtual devices::comm::DownlinkFrameBuffer* AcquireFrameBuffer() override;
+    virtual bool SendFrameBuffer(devices::comm::DownlinkFrameBuffer& buffer, std::uint8_t frameSize) override;
+    virtual void ReleaseFrameBuffer(devices::comm::DownlinkFrameBuffer& buffer) override;
+
     void ExpectDownlinkFrame(telecommunication::downlink::DownlinkAPID apid, std::uint8_t correlationId, std::uint8_t errorCode);
+
+    devices::comm::DownlinkFrameBuffer FrameBuffer;
 };
 
 struct BeaconControllerMock : public devices::comm::IBeaconController
@@ -39,6 +47,13 @@ struct CommTelemetryProviderMock : public devices::comm::ICommTelemetryProvider
     MOCK_METHOD1(GetTelemetry, bool(devices::comm::CommTelemetry& telemetry));
 };
 
+struct DownlinkQueueTelemetryProviderMock : public devices::comm::IDownlinkQueueTelemetryProvider
+{
+    DownlinkQueueTelemetryProviderMock();
+    ~DownlinkQueueTelemetryProviderMock();
+    MOCK_CONST_METHOD0(GetQueueTelemetry, devices::comm::DownlinkQueueTelemetry());
+};
+
 struct CommHardwareObserverMock : public devices::comm::ICommHardwareObserver
 {
     CommHardwareObserverMock();
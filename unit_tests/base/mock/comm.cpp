@@ -11,6 +11,20 @@ TransmitterMock::~TransmitterMock()
 {
 }
 
+devices::comm::DownlinkFrameBuffer* TransmitterMock::AcquireFrameBuffer()
+{
+    return &this->FrameBuffer;
+}
+
+bool TransmitterMock::SendFrameBuffer(devices::comm::DownlinkFrameBuffer& buffer, std::uint8_t frameSize)
+{
+    return SendFrame(gsl::make_span(buffer).subspan(devices::comm::DownlinkFrameHeadroom, frameSize));
+}
+
+void TransmitterMock::ReleaseFrameBuffer(devices::comm::DownlinkFrameBuffer& /*buffer*/)
+{
+}
+
 void TransmitterMock::ExpectDownlinkFrame(DownlinkAPID apid, std::uint8_t correlationId, std::uint8_t errorCode)
 {
     EXPECT_CALL(*this, SendFrame(IsDownlinkFrame(apid, 0, testing::ElementsAre(correlationId, errorCode))));
@@ -32,6 +46,14 @@ CommTelemetryProviderMock::~CommTelemetryProviderMock()
 {
 }
 
+DownlinkQueueTelemetryProviderMock::DownlinkQueueTelemetryProviderMock()
+{
+}
+
+DownlinkQueueTelemetryProviderMock::~DownlinkQueueTelemetryProviderMock()
+{
+}
+
 CommHardwareObserverMock::CommHardwareObserverMock()
 {
 }
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "telecommunication/fec.hpp"
+
+using testing::Eq;
+using testing::Each;
+using testing::ElementsAreArray;
+using std::uint8_t;
+using telecommunication::fec::Inverse;
+using telecommunication::fec::Multiply;
+using telecommunication::fec::MultiplyAdd;
+using telecommunication::fec::ParityCoefficient;
+using telecommunication::fec::ParityEncoder;
+
+namespace
+{
+    using Chunk = std::vector<uint8_t>;
+
+    /**
+     * @brief Ground-side decoder: reconstructs missing data chunks of the group
+     * @param data Data chunks, empty ones are missing
+     * @param parity Parity chunks, empty ones are missing
+     * @param chunkSize Size of chunk
+     * @return true if all data chunks are available after reconstruction
+     */
+    bool Recover(std::vector<Chunk>& data, const std::vector<Chunk>& parity, std::size_t chunkSize)
+    {
+        std::vector<uint8_t> missing;
+        std::vector<uint8_t> rows;
+
+        for (uint8_t i = 0; i < data.size(); i++)
+        {
+            if (data[i].empty())
+            {
+                missing.push_back(i);
+            }
+        }
+
+        for (uint8_t j = 0; j < parity.size() && rows.size() < missing.size(); j++)
+        {
+            if (!parity[j].empty())
+            {
+                rows.push_back(j);
+            }
+        }
+
+        if (rows.size() < missing.size())
+        {
+            return false;
+        }
+
+        const auto n = missing.size();
+
+        // syndromes: parity with contribution of received chunks removed
+        std::vector<Chunk> syndromes;
+        for (auto j : rows)
+        {
+            Chunk syndrome = parity[j];
+            for (uint8_t i = 0; i < data.size(); i++)
+            {
+                if (!data[i].empty())
+                {
+                    MultiplyAdd(syndrome, data[i], ParityCoefficient(j, i));
+                }
+            }
+
+            syndromes.push_back(syndrome);
+        }
+
+        // Gauss-Jordan elimination of coefficients of missing chunks, applied to syndromes
+        std::vector<std::vector<uint8_t>> matrix(n, std::vector<uint8_t>(n));
+        for (auto r = 0u; r < n; r++)
+        {
+            for (auto c = 0u; c < n; c++)
+            {
+                matrix[r][c] = ParityCoefficient(rows[r], missing[c]);
+            }
+        }
+
+        for (auto c = 0u; c < n; c++)
+        {
+            auto pivot = c;
+            while (pivot < n && matrix[pivot][c] == 0)
+            {
+                pivot++;
+            }
+
+            if (pivot == n)
+            {
+                return false;
+            }
+
+            std::swap(matrix[pivot], matrix[c]);
+            std::swap(syndromes[pivot], syndromes[c]);
+
+            const auto scale = Inverse(matrix[c][c]);
+            for (auto& v : matrix[c])
+            {
+                v = Multiply(v, scale);
+            }
+
+            Chunk scaled(chunkSize, 0);
+            MultiplyAdd(scaled, syndromes[c], scale);
+            syndromes[c] = scaled;
+
+            for (auto r = 0u; r < n; r++)
+            {
+                const auto factor = matrix[r][c];
+                if (r == c || factor == 0)
+                {
+                    continue;
+                }
+
+                MultiplyAdd(matrix[r], matrix[c], factor);
+                MultiplyAdd(syndromes[r], syndromes[c], factor);
+            }
+        }
+
+        for (auto k = 0u; k < n; k++)
+        {
+            data[missing[k]] = syndromes[k];
+        }
+
+        return true;
+    }
+
+    std::vector<Chunk> MakeData(uint8_t count, std::size_t chunkSize)
+    {
+        std::vector<Chunk> data;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            Chunk chunk(chunkSize);
+            for (auto k = 0u; k < chunkSize; k++)
+            {
+                chunk[k] = static_cast<uint8_t>(i * 37 + k * 11 + (k >> 3));
+            }
+
+            data.push_back(chunk);
+        }
+
+        return data;
+    }
+
+    std::vector<Chunk> Encode(ParityEncoder& encoder, const std::vector<Chunk>& data, uint8_t parityCount, uint8_t chunkSize)
+    {
+        encoder.Reset(parityCount, chunkSize);
+        for (uint8_t i = 0; i < data.size(); i++)
+        {
+            encoder.Add(i, data[i]);
+        }
+
+        std::vector<Chunk> parity;
+        for (uint8_t j = 0; j < parityCount; j++)
+        {
+            const auto chunk = encoder.Parity(j);
+            parity.emplace_back(chunk.begin(), chunk.end());
+        }
+
+        return parity;
+    }
+
+    TEST(GaloisFieldTest, ShouldInvertAllNonZeroElements)
+    {
+        for (auto a = 1; a < 256; a++)
+        {
+            ASSERT_THAT(Multiply(a, Inverse(a)), Eq(1)) << "a=" << a;
+        }
+    }
+
+    TEST(GaloisFieldTest, ShouldMultiplyUsingReductionPolynomial)
+    {
+        ASSERT_THAT(Multiply(0x80, 2), Eq(0x1D));
+        ASSERT_THAT(Multiply(0x53, 0), Eq(0));
+        ASSERT_THAT(Multiply(1, 0xCA), Eq(0xCA));
+        ASSERT_THAT(Multiply(3, 7), Eq(9));
+    }
+
+    TEST(ParityEncoderTest, ShouldRecoverAnyCombinationOfLostChunks)
+    {
+        constexpr uint8_t DataCount = 8;
+        constexpr uint8_t ParityCount = 4;
+        constexpr uint8_t ChunkSize = 40;
+
+        ParityEncoder encoder;
+        const auto data = MakeData(DataCount, ChunkSize);
+        const auto parity = Encode(encoder, data, ParityCount, ChunkSize);
+
+        for (std::uint32_t lost = 0; lost < (1u << (DataCount + ParityCount)); lost++)
+        {
+            if (__builtin_popcount(lost) > ParityCount)
+            {
+                continue;
+            }
+
+            auto received = data;
+            auto receivedParity = parity;
+
+            for (auto i = 0; i < DataCount + ParityCount; i++)
+            {
+                if (lost & (1u << i))
+                {
+                    (i < DataCount ? received[i] : receivedParity[i - DataCount]).clear();
+                }
+            }
+
+            ASSERT_THAT(Recover(received, receivedParity, ChunkSize), Eq(true)) << "lost=" << lost;
+            ASSERT_THAT(received, Eq(data)) << "lost=" << lost;
+        }
+    }
+
+    TEST(ParityEncoderTest, ShouldNotRecoverMoreChunksThanParityCount)
+    {
+        ParityEncoder encoder;
+        auto data = MakeData(4, 16);
+        const auto parity = Encode(encoder, data, 1, 16);
+
+        data[0].clear();
+        data[1].clear();
+
+        ASSERT_THAT(Recover(data, parity, 16), Eq(false));
+    }
+
+    TEST(ParityEncoderTest, ShouldPadShortChunkWithZeros)
+    {
+        ParityEncoder encoder;
+        auto data = MakeData(3, 20);
+        data[2].resize(7);
+
+        const auto parity = Encode(encoder, data, 2, 20);
+
+        auto received = data;
+        received[2].clear();
+
+        ASSERT_THAT(Recover(received, parity, 20), Eq(true));
+
+        auto padded = data[2];
+        padded.resize(20, 0);
+        ASSERT_THAT(received[2], Eq(padded));
+    }
+
+    TEST(ParityEncoderTest, ShouldScaleSingleChunkByParityCoefficient)
+    {
+        ParityEncoder encoder;
+        const auto data = MakeData(1, 10);
+        const auto parity = Encode(encoder, data, 1, 10);
+
+        Chunk expected(10, 0);
+        MultiplyAdd(expected, data[0], ParityCoefficient(0, 0));
+
+        ASSERT_THAT(parity[0], Eq(expected));
+    }
+
+    TEST(ParityEncoderTest, ShouldClearParityOnReset)
+    {
+        ParityEncoder encoder;
+        const auto data = MakeData(2, 10);
+        Encode(encoder, data, 2, 10);
+
+        encoder.Reset(2, 10);
+
+        ASSERT_THAT(encoder.Parity(0), Each(Eq(0)));
+        ASSERT_THAT(encoder.Parity(1), Each(Eq(0)));
+    }
+
+    TEST(ParityEncoderTest, ShouldRejectParametersOutOfRange)
+    {
+        ParityEncoder encoder;
+        std::array<uint8_t, 11> chunk{};
+
+        ASSERT_THAT(encoder.Reset(telecommunication::fec::MaxParityCount + 1, 10), Eq(false));
+        ASSERT_THAT(encoder.Reset(1, ParityEncoder::MaxChunkSize + 1), Eq(false));
+        ASSERT_THAT(encoder.Reset(1, 10), Eq(true));
+        ASSERT_THAT(encoder.Add(telecommunication::fec::MaxDataCount, gsl::make_span(chunk).subspan(0, 10)), Eq(false));
+        ASSERT_THAT(encoder.Add(0, chunk), Eq(false));
+        ASSERT_THAT(encoder.Parity(1).empty(), Eq(true));
+    }
+}
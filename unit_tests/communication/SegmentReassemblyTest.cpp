@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "mock/comm.hpp"
+#include "telecommunication/downlink.h"
+#include "telecommunication/segmentation.hpp"
+#include "utils.hpp"
+
+using std::uint8_t;
+using testing::_;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::Eq;
+using testing::InSequence;
+using testing::NiceMock;
+using testing::Return;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::uplink::SegmentReassembly;
+using namespace std::chrono_literals;
+
+namespace
+{
+    using Status = SegmentReassembly::SegmentStatus;
+
+    class SegmentReassemblyTest : public testing::Test
+    {
+      protected:
+        SegmentReassemblyTest();
+
+        std::vector<uint8_t> Segment(uint8_t streamId, uint8_t index, uint8_t count, std::vector<uint8_t> data);
+
+        gsl::span<const uint8_t> Add(const std::vector<uint8_t>& segment);
+
+        NiceMock<OSMock> _os;
+        OSReset _osReset;
+        NiceMock<TransmitterMock> _transmitter;
+        SegmentReassembly _reassembly;
+    };
+
+    SegmentReassemblyTest::SegmentReassemblyTest()
+    {
+        _osReset = InstallProxy(&_os);
+        ON_CALL(_os, GetUptime()).WillByDefault(Return(10s));
+    }
+
+    std::vector<uint8_t> SegmentReassemblyTest::Segment(uint8_t streamId, uint8_t index, uint8_t count, std::vector<uint8_t> data)
+    {
+        data.insert(data.begin(), {streamId, index, count});
+        return data;
+    }
+
+    gsl::span<const uint8_t> SegmentReassemblyTest::Add(const std::vector<uint8_t>& segment)
+    {
+        return _reassembly.Add(_transmitter, segment);
+    }
+
+    testing::Matcher<gsl::span<const uint8_t>> IsAck(uint8_t streamId, Status status, uint8_t count, uint8_t received)
+    {
+        return IsDownlinkFrame(DownlinkAPID::UplinkSegments, 0, streamId, ElementsAre(num(status), count, received));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldReassembleSegmentsReceivedOutOfOrder)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Complete, 3, 0b111))).WillOnce(Return(true));
+
+        ASSERT_THAT(Add(Segment(0x21, 2, 3, {7, 8})).empty(), Eq(true));
+        ASSERT_THAT(Add(Segment(0x21, 0, 3, {0xAA, 1, 2, 3})).empty(), Eq(true));
+
+        ASSERT_THAT(Add(Segment(0x21, 1, 3, {4, 5, 6})), ElementsAre(0xAA, 1, 2, 3, 4, 5, 6, 7, 8));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldAcceptSingleSegmentStream)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x01, Status::Complete, 1, 0b1))).WillOnce(Return(true));
+
+        ASSERT_THAT(Add(Segment(0x01, 0, 1, {0x11, 0x22})), ElementsAre(0x11, 0x22));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldReassembleFullSizeSegments)
+    {
+        constexpr auto Count = SegmentReassembly::MaxSegments;
+        constexpr auto Size = SegmentReassembly::MaxSegmentSize;
+
+        std::vector<uint8_t> expected;
+        gsl::span<const uint8_t> result;
+
+        for (uint8_t i = 0; i < Count; i++)
+        {
+            expected.insert(expected.end(), Size, i);
+        }
+
+        for (uint8_t i = Count; i > 0; i--)
+        {
+            result = Add(Segment(0x05, i - 1, Count, std::vector<uint8_t>(Size, i - 1)));
+        }
+
+        ASSERT_THAT(result, ElementsAreArray(expected));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldNotSendAcknowledgementForEachSegment)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(_)).Times(0);
+
+        Add(Segment(0x21, 0, 3, {1}));
+        Add(Segment(0x21, 1, 3, {2}));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldReportMissingSegmentsOnRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Incomplete, 4, 0b1010))).WillOnce(Return(true));
+
+        Add(Segment(0x21, 1, 4, {1}));
+        Add(Segment(0x21, 3, 4, {3}));
+        Add(Segment(0x21, 0, 0, {}));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldReportUnknownStreamOnRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x33, Status::Unknown, 0, 0))).WillOnce(Return(true));
+
+        Add(Segment(0x21, 1, 4, {1}));
+        Add(Segment(0x33, 0, 0, {}));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldNotExecuteCompletedStreamAgain)
+    {
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Complete, 2, 0b11))).Times(2).WillRepeatedly(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Complete, 2, 0b11))).WillOnce(Return(true));
+        }
+
+        Add(Segment(0x21, 0, 2, {1}));
+        ASSERT_THAT(Add(Segment(0x21, 1, 2, {2})).empty(), Eq(false));
+
+        ASSERT_THAT(Add(Segment(0x21, 1, 2, {2})).empty(), Eq(true));
+        Add(Segment(0x21, 0, 0, {}));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldDropIncompleteStreamWhenAnotherOneStarts)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x22, Status::Complete, 2, 0b11))).WillOnce(Return(true));
+
+        Add(Segment(0x21, 0, 2, {1}));
+        Add(Segment(0x22, 0, 2, {3}));
+
+        ASSERT_THAT(Add(Segment(0x22, 1, 2, {4})), ElementsAre(3, 4));
+        ASSERT_THAT(Add(Segment(0x21, 1, 2, {2})).empty(), Eq(true));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldDropStreamAfterTimeout)
+    {
+        EXPECT_CALL(_os, GetUptime()).WillOnce(Return(10s)).WillOnce(Return(10s + SegmentReassembly::Timeout + 1ms));
+        EXPECT_CALL(_transmitter, SendFrame(_)).Times(0);
+
+        Add(Segment(0x21, 0, 2, {1}));
+
+        ASSERT_THAT(Add(Segment(0x21, 1, 2, {2})).empty(), Eq(true));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldRejectSegmentsExceedingLimits)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Malformed, 0, 0))).Times(4).WillRepeatedly(Return(true));
+
+        Add(Segment(0x21, 0, SegmentReassembly::MaxSegments + 1, {1}));
+        Add(Segment(0x21, 2, 2, {1}));
+        Add(Segment(0x21, 0, 2, {}));
+        Add(Segment(0x21, 0, 2, std::vector<uint8_t>(SegmentReassembly::MaxSegmentSize + 1, 0)));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldRejectSegmentWithDifferentCount)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Malformed, 3, 0b1))).WillOnce(Return(true));
+
+        Add(Segment(0x21, 0, 3, {1}));
+        Add(Segment(0x21, 1, 2, {2}));
+    }
+
+    TEST_F(SegmentReassemblyTest, ShouldRejectTruncatedHeader)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsAck(0x21, Status::Malformed, 0, 0))).WillOnce(Return(true));
+
+        std::array<uint8_t, 2> segment{0x21, 0};
+        ASSERT_THAT(_reassembly.Add(_transmitter, segment).empty(), Eq(true));
+    }
+}
@@ -6,6 +6,7 @@
 #include "comm/Frame.hpp"
 #include "comm/ITransmitter.hpp"
 #include "mock/comm.hpp"
+#include "telecommunication/segmentation.hpp"
 #include "telecommunication/telecommand_handling.h"
 #include "utils.hpp"
 
@@ -20,6 +21,7 @@ using testing::Invoke;
 using testing::_;
 using testing::Eq;
 using testing::StrEq;
+using testing::ElementsAre;
 
 using devices::comm::Frame;
 using devices::comm::ITransmitter;
@@ -43,12 +45,13 @@ namespace
         TeleCommandHandlingTest();
 
       protected:
+        TelecommandTable emptyTable;
         IncomingTelecommandHandler handling;
         NiceMock<TeleCommandDepsMock> deps;
         TransmitterMock transmitter;
     };
 
-    TeleCommandHandlingTest::TeleCommandHandlingTest() : handling(deps, span<IHandleTeleCommand*, 0>())
+    TeleCommandHandlingTest::TeleCommandHandlingTest() : emptyTable{}, handling(deps, emptyTable)
     {
     }
 
@@ -72,11 +75,31 @@ namespace
 
         NiceMock<TeleCommandHandlerMock> someCommand;
         EXPECT_CALL(someCommand, Handle(_, _));
-        EXPECT_CALL(someCommand, CommandCode()).WillRepeatedly(Return(static_cast<uint8_t>('A')));
 
-        IHandleTeleCommand* commands[] = {&someCommand};
+        TelecommandTable commands{};
+        commands['A'] = &someCommand;
 
-        IncomingTelecommandHandler handler(deps, span<IHandleTeleCommand*>(commands));
+        IncomingTelecommandHandler handler(deps, commands);
+
+        handler.HandleFrame(this->transmitter, frame);
+    }
+
+    TEST_F(TeleCommandHandlingTest, HandlerShouldNotBeCalledForUnknownTelecommand)
+    {
+        std::uint8_t buffer[40] = "BCD";
+        Frame frame(0, 0, 0, buffer);
+
+        EXPECT_CALL(this->deps, Decode(_)).WillOnce(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1, frame.length() - 1));
+        }));
+
+        NiceMock<TeleCommandHandlerMock> someCommand;
+        EXPECT_CALL(someCommand, Handle(_, _)).Times(0);
+
+        TelecommandTable commands{};
+        commands['A'] = &someCommand;
+
+        IncomingTelecommandHandler handler(deps, commands);
 
         handler.HandleFrame(this->transmitter, frame);
     }
@@ -88,12 +111,57 @@ namespace
         NiceMock<TeleCommandHandlerMock> someCommand;
         EXPECT_CALL(someCommand, Handle(_, _)).Times(0);
 
-        IHandleTeleCommand* telecommands[] = {&someCommand};
+        TelecommandTable telecommands{};
+        telecommands[0] = &someCommand;
 
-        IncomingTelecommandHandler handler(this->deps, span<IHandleTeleCommand*>(telecommands));
+        IncomingTelecommandHandler handler(this->deps, telecommands);
 
         Frame frame;
 
         handler.HandleFrame(this->transmitter, frame);
     }
+
+    TEST_F(TeleCommandHandlingTest, ReassembledTelecommandShouldBeDispatched)
+    {
+        ON_CALL(this->deps, Decode(_)).WillByDefault(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1, frame.length() - 1));
+        }));
+
+        NiceMock<TransmitterMock> transmitter;
+        NiceMock<TeleCommandHandlerMock> someCommand;
+        EXPECT_CALL(someCommand, Handle(_, ElementsAre('B', 'C', 'D', 'E')));
+
+        TelecommandTable commands{};
+        commands['A'] = &someCommand;
+
+        SegmentReassembly reassembly;
+        IncomingTelecommandHandler handler(deps, commands, reassembly);
+
+        std::uint8_t second[] = {SegmentReassembly::Code, 0x10, 1, 2, 'D', 'E'};
+        Frame secondFrame(0, 0, sizeof(second), second);
+        handler.HandleFrame(transmitter, secondFrame);
+
+        std::uint8_t first[] = {SegmentReassembly::Code, 0x10, 0, 2, 'A', 'B', 'C'};
+        Frame firstFrame(0, 0, sizeof(first), first);
+        handler.HandleFrame(transmitter, firstFrame);
+    }
+
+    TEST_F(TeleCommandHandlingTest, SegmentShouldBeDispatchedDirectlyWithoutReassembly)
+    {
+        EXPECT_CALL(this->deps, Decode(_)).WillOnce(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1, frame.length() - 1));
+        }));
+
+        NiceMock<TeleCommandHandlerMock> segmentCommand;
+        EXPECT_CALL(segmentCommand, Handle(_, _));
+
+        TelecommandTable commands{};
+        commands[SegmentReassembly::Code] = &segmentCommand;
+
+        IncomingTelecommandHandler handler(deps, commands);
+
+        std::uint8_t segment[] = {SegmentReassembly::Code, 0x10, 0, 1, 'A'};
+        Frame frame(0, 0, sizeof(segment), segment);
+        handler.HandleFrame(this->transmitter, frame);
+    }
 }
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <gsl/span>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "comm/Frame.hpp"
+#include "comm/IHandleFrame.hpp"
+#include "mock/comm.hpp"
+#include "os/os.hpp"
+#include "telecommunication/downlink.h"
+#include "telecommunication/telecommand_execution.hpp"
+
+using std::uint8_t;
+using gsl::span;
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+using devices::comm::Frame;
+using devices::comm::IHandleFrame;
+using devices::comm::ITransmitter;
+using telecommunication::downlink::DownlinkAPID;
+using namespace telecommunication::uplink;
+
+namespace
+{
+    struct DecoderMock : public IDecodeTelecommand
+    {
+        MOCK_METHOD1(Decode, DecodeTelecommandResult(span<const uint8_t>));
+    };
+
+    struct TelecommandMock : public IHandleTeleCommand
+    {
+        MOCK_METHOD2(Handle, void(ITransmitter&, span<const uint8_t> parameters));
+        MOCK_CONST_METHOD0(CommandCode, uint8_t());
+    };
+
+    struct FrameHandlerMock : public IHandleFrame
+    {
+        MOCK_METHOD2(HandleFrame, void(ITransmitter&, Frame&));
+    };
+
+    const auto FramesQueue = reinterpret_cast<OSQueueHandle>(1);
+
+    class TelecommandExecutionTest : public testing::Test
+    {
+      protected:
+        TelecommandExecutionTest();
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+        NiceMock<DecoderMock> decoder;
+        NiceMock<TelecommandMock> cancel;
+        FrameHandlerMock handler;
+        TransmitterMock transmitter;
+        CancellationToken cancellation;
+        AsyncTelecommandHandler execution;
+    };
+
+    TelecommandExecutionTest::TelecommandExecutionTest()
+        : osReset(InstallProxy(&os)), execution(handler, decoder, cancel, cancellation)
+    {
+        ON_CALL(os, CreateQueue(_, _)).WillByDefault(Return(FramesQueue));
+        ON_CALL(cancel, CommandCode()).WillByDefault(Return(0xB4));
+        ON_CALL(decoder, Decode(_)).WillByDefault(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1));
+        }));
+
+        execution.Initialize();
+    }
+
+    TEST_F(TelecommandExecutionTest, ShouldStartWorkerTask)
+    {
+        AsyncTelecommandHandler other(handler, decoder, cancel, cancellation);
+
+        EXPECT_CALL(os, CreateQueue(AsyncTelecommandHandler::Capacity, _)).WillOnce(Return(FramesQueue));
+        EXPECT_CALL(os, CreateTask(_, _, _, &other, _, _)).WillOnce(Return(OSResult::Success));
+
+        ASSERT_THAT(other.Initialize(), Eq(OSResult::Success));
+    }
+
+    TEST_F(TelecommandExecutionTest, ShouldFailWhenQueueCannotBeCreated)
+    {
+        AsyncTelecommandHandler other(handler, decoder, cancel, cancellation);
+
+        EXPECT_CALL(os, CreateQueue(_, _)).WillOnce(Return(nullptr));
+        EXPECT_CALL(os, CreateTask(_, _, _, _, _, _)).Times(0);
+
+        ASSERT_THAT(other.Initialize(), Eq(OSResult::NotEnoughMemory));
+    }
+
+    TEST_F(TelecommandExecutionTest, ShouldQueueFrameWithoutExecutingIt)
+    {
+        std::array<uint8_t, 4> buffer{0xAA, 1, 2, 3};
+        Frame frame(10, 20, buffer.size(), buffer);
+
+        std::array<uint8_t, devices::comm::MaxUplinkFrameSize> queued;
+        EXPECT_CALL(handler, HandleFrame(_, _)).Times(0);
+        EXPECT_CALL(cancel, Handle(_, _)).Times(0);
+        EXPECT_CALL(os, QueueSend(FramesQueue, _, std::chrono::milliseconds::zero()))
+            .WillOnce(Invoke([&queued](OSQueueHandle /*queue*/, const void* element, std::chrono::milliseconds /*timeout*/) {
+                std::memcpy(queued.data(), element, queued.size());
+                return true;
+            }));
+
+        execution.HandleFrame(transmitter, frame);
+
+        ASSERT_THAT(std::search(queued.begin(), queued.end(), buffer.begin(), buffer.end()), testing::Ne(queued.end()));
+    }
+
+    TEST_F(TelecommandExecutionTest, ShouldExecuteCancelTelecommandImmediately)
+    {
+        std::array<uint8_t, 2> buffer{0xB4, 0x11};
+        Frame frame(0, 0, buffer.size(), buffer);
+
+        EXPECT_CALL(os, QueueSend(_, _, _)).Times(0);
+        EXPECT_CALL(handler, HandleFrame(_, _)).Times(0);
+        EXPECT_CALL(cancel, Handle(testing::Ref(transmitter), testing::ElementsAre(0x11)));
+
+        execution.HandleFrame(transmitter, frame);
+    }
+
+    TEST_F(TelecommandExecutionTest, ShouldRejectFrameWhenQueueIsFull)
+    {
+        std::array<uint8_t, 3> buffer{0xAA, 0x11, 0x22};
+        Frame frame(0, 0, buffer.size(), buffer);
+
+        EXPECT_CALL(os, QueueSend(FramesQueue, _, _)).WillOnce(Return(false));
+        EXPECT_CALL(handler, HandleFrame(_, _)).Times(0);
+        EXPECT_CALL(transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelecommandRejected, 0, 0x11, testing::ElementsAre(0xAA))))
+            .WillOnce(Return(true));
+
+        execution.HandleFrame(transmitter, frame);
+
+        ASSERT_THAT(execution.Rejected(), Eq(1u));
+    }
+
+    TEST_F(TelecommandExecutionTest, ShouldNotRejectQueuedFrame)
+    {
+        std::array<uint8_t, 2> buffer{0xAA, 0x11};
+        Frame frame(0, 0, buffer.size(), buffer);
+
+        EXPECT_CALL(os, QueueSend(FramesQueue, _, _)).WillOnce(Return(true));
+        EXPECT_CALL(transmitter, SendFrame(_)).Times(0);
+
+        execution.HandleFrame(transmitter, frame);
+
+        ASSERT_THAT(execution.Rejected(), Eq(0u));
+    }
+
+    TEST(CancellationTokenTest, ShouldTrackCancellationRequest)
+    {
+        CancellationToken token;
+        ASSERT_THAT(token.IsCancelled(), Eq(false));
+
+        token.Cancel();
+        ASSERT_THAT(token.IsCancelled(), Eq(true));
+
+        token.Begin(token.Enqueue());
+        ASSERT_THAT(token.IsCancelled(), Eq(false));
+    }
+
+    TEST(CancellationTokenTest, ShouldCancelOperationsQueuedBeforeCancellation)
+    {
+        CancellationToken token;
+
+        const auto running = token.Enqueue();
+        const auto waiting = token.Enqueue();
+        token.Begin(running);
+
+        token.Cancel();
+        ASSERT_THAT(token.IsCancelled(), Eq(true));
+
+        const auto next = token.Enqueue();
+
+        token.Begin(waiting);
+        ASSERT_THAT(token.IsCancelled(), Eq(true));
+
+        token.Begin(next);
+        ASSERT_THAT(token.IsCancelled(), Eq(false));
+    }
+
+    TEST(CancellationTokenTest, ShouldCancelQueuedOperationWhenRequestedBetweenOperations)
+    {
+        CancellationToken token;
+
+        token.Begin(token.Enqueue());
+        ASSERT_THAT(token.IsCancelled(), Eq(false));
+
+        const auto next = token.Enqueue();
+        token.Cancel();
+
+        token.Begin(next);
+        ASSERT_THAT(token.IsCancelled(), Eq(true));
+    }
+}
@@ -0,0 +1,42 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/cancel.hpp"
+#include "utils.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using testing::_;
+using testing::ElementsAre;
+using testing::Eq;
+
+namespace
+{
+    class CancelOperationTelecommandTest : public testing::Test
+    {
+      protected:
+        testing::NiceMock<TransmitterMock> _transmitter;
+        telecommunication::uplink::CancellationToken _cancellation;
+
+        obc::telecommands::CancelOperationTelecommand _telecommand{_cancellation};
+    };
+
+    TEST_F(CancelOperationTelecommandTest, ShouldCancelCurrentOperation)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Operation, 0, 0x22, ElementsAre(0))));
+
+        std::array<std::uint8_t, 1> buffer{0x22};
+        _telecommand.Handle(_transmitter, buffer);
+
+        ASSERT_THAT(_cancellation.IsCancelled(), Eq(true));
+    }
+
+    TEST_F(CancelOperationTelecommandTest, ShouldIgnoreMalformedRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(_)).Times(0);
+
+        _telecommand.Handle(_transmitter, gsl::span<const std::uint8_t>());
+
+        ASSERT_THAT(_cancellation.IsCancelled(), Eq(false));
+    }
+}
@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/lzss.hpp"
+#include "base/reader.h"
+#include "base/writer.h"
+#include "mock/FsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/downlink.h"
+
+using std::uint8_t;
+using testing::_;
+using testing::Eq;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::Invoke;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+using obc::telecommands::DownloadCompressedFileTelecommand;
+using obc::telecommands::DownloadFileTelecommand;
+using telecommunication::downlink::DownlinkAPID;
+
+namespace
+{
+    struct CompressedPart
+    {
+        std::uint32_t Seq;
+        std::uint32_t Offset;
+        std::uint32_t FileSize;
+        std::vector<uint8_t> Data;
+    };
+
+    class DownloadCompressedFileTelecommandTest : public testing::Test
+    {
+      protected:
+        DownloadCompressedFileTelecommandTest();
+
+        void SendRequest(std::uint32_t offset, uint8_t maxParts);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<FsMock> _fs;
+
+        telecommunication::uplink::CancellationToken _cancellation;
+
+        DownloadCompressedFileTelecommand _telecommand{_fs, _cancellation};
+
+        const std::string _path{"/a/file"};
+
+        std::vector<CompressedPart> _parts;
+    };
+
+    DownloadCompressedFileTelecommandTest::DownloadCompressedFileTelecommandTest()
+    {
+        ON_CALL(_transmitter, SendFrame(_)).WillByDefault(Invoke([this](gsl::span<const uint8_t> frame) {
+            const auto header = frame[0] | (frame[1] << 8) | (frame[2] << 16);
+            if (static_cast<DownlinkAPID>(header & 0x3F) != DownlinkAPID::FileSendCompressed || frame[4] != 0)
+            {
+                return true;
+            }
+
+            Reader r(frame.subspan(5));
+            CompressedPart part;
+            part.Seq = (header >> 6) & 0x3FFFF;
+            part.Offset = r.ReadDoubleWordLE();
+            const auto length = r.ReadWordLE();
+            part.FileSize = r.ReadDoubleWordLE();
+
+            std::array<uint8_t, DownloadCompressedFileTelecommand::MaxPartInputSize> buffer;
+            const auto data = lzss::Decompress(r.ReadToEnd(), buffer);
+            EXPECT_THAT(data.size(), Eq(length));
+
+            part.Data.assign(data.begin(), data.end());
+            _parts.push_back(part);
+            return true;
+        }));
+    }
+
+    void DownloadCompressedFileTelecommandTest::SendRequest(std::uint32_t offset, uint8_t maxParts)
+    {
+        std::array<uint8_t, 200> buffer;
+        Writer w(buffer);
+        w.WriteByte(0x11);
+        w.WriteByte(_path.length());
+        w.WriteArray(gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(_path.data()), _path.length()));
+        w.WriteByte(0);
+        w.WriteDoubleWordLE(offset);
+        w.WriteByte(maxParts);
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    TEST_F(DownloadCompressedFileTelecommandTest, ShouldSendPaddedFileInFewParts)
+    {
+        std::array<uint8_t, 5000> file;
+        file.fill(0xFF);
+        std::copy_n("header", 6, file.begin());
+        _fs.AddFile(_path.c_str(), file);
+
+        SendRequest(0, 0);
+
+        ASSERT_THAT(_parts.size(), Eq(3U));
+
+        std::vector<uint8_t> received;
+        for (std::uint32_t i = 0; i < _parts.size(); i++)
+        {
+            ASSERT_THAT(_parts[i].Seq, Eq(i));
+            ASSERT_THAT(_parts[i].Offset, Eq(received.size()));
+            ASSERT_THAT(_parts[i].FileSize, Eq(file.size()));
+            received.insert(received.end(), _parts[i].Data.begin(), _parts[i].Data.end());
+        }
+
+        ASSERT_THAT(received, ElementsAreArray(file));
+    }
+
+    TEST_F(DownloadCompressedFileTelecommandTest, ShouldSendRequestedNumberOfPartsStartingAtOffset)
+    {
+        std::array<uint8_t, 2000> file;
+        for (std::size_t i = 0; i < file.size(); i++)
+        {
+            file[i] = static_cast<uint8_t>(i * 7 + i / 3);
+        }
+        _fs.AddFile(_path.c_str(), file);
+
+        SendRequest(300, 2);
+
+        ASSERT_THAT(_parts.size(), Eq(2U));
+        ASSERT_THAT(_parts[0].Offset, Eq(300U));
+        ASSERT_THAT(_parts[1].Offset, Eq(300U + _parts[0].Data.size()));
+        ASSERT_THAT(_parts[0].Data, ElementsAreArray(file.begin() + 300, file.begin() + 300 + _parts[0].Data.size()));
+    }
+
+    TEST_F(DownloadCompressedFileTelecommandTest, ShouldStopSendingPartsWhenCancelled)
+    {
+        std::array<uint8_t, 2000> file;
+        for (std::size_t i = 0; i < file.size(); i++)
+        {
+            file[i] = static_cast<uint8_t>(i * 13);
+        }
+        _fs.AddFile(_path.c_str(), file);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompressed, 0, 0x11, _)))
+            .WillOnce(InvokeWithoutArgs([this]() {
+                _cancellation.Cancel();
+                return true;
+            }));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompressed,
+                1,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Cancelled), '/', 'a', '/', 'f', 'i', 'l', 'e'))))
+            .WillOnce(Return(true));
+
+        SendRequest(0, 0);
+    }
+
+    TEST_F(DownloadCompressedFileTelecommandTest, ShouldRejectOffsetBeyondFile)
+    {
+        std::array<uint8_t, 20> file{};
+        _fs.AddFile(_path.c_str(), file);
+
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompressed,
+                0,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::TooBigSeq), '/', 'a', '/', 'f', 'i', 'l', 'e'))))
+            .WillOnce(Return(true));
+
+        SendRequest(20, 0);
+    }
+
+    TEST_F(DownloadCompressedFileTelecommandTest, ShouldReportMissingFile)
+    {
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompressed,
+                0,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::FileNotFound), '/', 'a', '/', 'f', 'i', 'l', 'e'))))
+            .WillOnce(Return(true));
+
+        SendRequest(0, 0);
+    }
+
+    TEST_F(DownloadCompressedFileTelecommandTest, ShouldReportMalformedRequest)
+    {
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(
+                DownlinkAPID::FileSendCompressed, 0, 0x11, ElementsAre(num(DownloadFileTelecommand::ErrorCode::MalformedRequest)))))
+            .WillOnce(Return(true));
+
+        std::array<uint8_t, 3> request{0x11, 5, 'a'};
+        _telecommand.Handle(_transmitter, request);
+    }
+}
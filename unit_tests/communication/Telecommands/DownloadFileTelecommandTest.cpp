@@ -18,6 +18,8 @@ using std::copy;
 using std::uint8_t;
 using testing::_;
 using testing::Invoke;
+using testing::InvokeWithoutArgs;
+using testing::InSequence;
 using testing::Eq;
 using testing::Each;
 using testing::ElementsAreArray;
@@ -61,7 +63,9 @@ namespace
         testing::NiceMock<TransmitterMock> _transmitter;
         testing::NiceMock<FsMock> _fs;
 
-        obc::telecommands::DownloadFileTelecommand _telecommand{_fs};
+        telecommunication::uplink::CancellationToken _cancellation;
+
+        obc::telecommands::DownloadFileTelecommand _telecommand{_fs, _cancellation};
     };
 
     TEST_F(DownloadFileTelecommandTest, ShouldTransferRequestedPartsOfFile)
@@ -110,6 +114,34 @@ namespace
         this->SendRequest(0xFF, path, std::array<uint16_t, 1>{0x0});
     }
 
+    TEST_F(DownloadFileTelecommandTest, ShouldStopSendingPartsWhenCancelled)
+    {
+        const std::string path{"/a/file"};
+
+        std::array<uint8_t, 8> expectedPayload;
+
+        expectedPayload[0] = static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Cancelled);
+        std::copy(path.begin(), path.end(), expectedPayload.begin() + 1);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::FileSend), Eq(0U), _)))
+                .WillOnce(InvokeWithoutArgs([this]() {
+                    _cancellation.Cancel();
+                    return true;
+                }));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1, 0xFF, ElementsAreArray(expectedPayload))))
+                .WillOnce(Return(true));
+        }
+
+        Buffer<400> file;
+        std::fill(file.begin(), file.end(), 1);
+
+        this->_fs.AddFile(path.c_str(), file);
+
+        this->SendRequest(0xFF, path, std::array<uint16_t, 2>{0x0, 0x1});
+    }
+
     TEST_F(DownloadFileTelecommandTest, ShouldSendErrorFrameForSequenceNumberBeyondFile)
     {
         const std::string path{"/a/file"};
@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/writer.h"
+#include "mock/FsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/downlink.h"
+#include "telecommunication/fec.hpp"
+#include "utils.hpp"
+
+using std::uint8_t;
+using testing::_;
+using testing::Eq;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::InSequence;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+using obc::telecommands::DownloadFileTelecommand;
+using obc::telecommands::DownloadFileWithParityTelecommand;
+using telecommunication::downlink::DownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::fec::MultiplyAdd;
+using telecommunication::fec::ParityCoefficient;
+
+namespace
+{
+    constexpr uint8_t MaxFileDataSize = DownlinkFrame::MaxPayloadSize - 2;
+
+    class DownloadFileWithParityTelecommandTest : public testing::Test
+    {
+      protected:
+        DownloadFileWithParityTelecommandTest();
+
+        void SendRequest(std::uint32_t first, std::uint16_t count, uint8_t groupSize, uint8_t parityCount);
+
+        std::vector<uint8_t> ExpectedParity(std::uint32_t firstSeq, uint8_t partsInGroup, uint8_t parityIndex) const;
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<FsMock> _fs;
+
+        telecommunication::uplink::CancellationToken _cancellation;
+
+        DownloadFileWithParityTelecommand _telecommand{_fs, _cancellation};
+
+        const std::string _path{"/a/file"};
+
+        std::array<uint8_t, 3 * MaxFileDataSize + 20> _file;
+    };
+
+    DownloadFileWithParityTelecommandTest::DownloadFileWithParityTelecommandTest()
+    {
+        for (auto i = 0u; i < _file.size(); i++)
+        {
+            _file[i] = static_cast<uint8_t>(i * 7 + i / MaxFileDataSize);
+        }
+    }
+
+    void DownloadFileWithParityTelecommandTest::SendRequest(std::uint32_t first, std::uint16_t count, uint8_t groupSize, uint8_t parityCount)
+    {
+        std::array<uint8_t, 200> buffer;
+        Writer w(buffer);
+        w.WriteByte(0x11);
+        w.WriteByte(_path.length());
+        w.WriteArray(gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(_path.data()), _path.length()));
+        w.WriteByte(0);
+        w.WriteDoubleWordLE(first);
+        w.WriteWordLE(count);
+        w.WriteByte(groupSize);
+        w.WriteByte(parityCount);
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    std::vector<uint8_t> DownloadFileWithParityTelecommandTest::ExpectedParity(
+        std::uint32_t firstSeq, uint8_t partsInGroup, uint8_t parityIndex) const
+    {
+        std::vector<uint8_t> payload(1 + MaxFileDataSize, 0);
+        payload[0] = parityIndex;
+
+        const auto parity = gsl::make_span(payload).subspan(1);
+        const gsl::span<const uint8_t> file(_file);
+
+        for (uint8_t i = 0; i < partsInGroup; i++)
+        {
+            const auto offset = (firstSeq + i) * MaxFileDataSize;
+            const auto part = file.subspan(offset, std::min<std::size_t>(MaxFileDataSize, file.size() - offset));
+            MultiplyAdd(parity, part, ParityCoefficient(parityIndex, i));
+        }
+
+        return payload;
+    }
+
+    testing::Matcher<gsl::span<const uint8_t>> IsSummary(DownloadFileTelecommand::ErrorCode status, uint8_t sent, uint8_t partsCount)
+    {
+        return IsDownlinkFrame(
+            DownlinkAPID::FileSendSummary, 0, 0x11, ElementsAre(num(status), sent, 0, 0, 0, partsCount, 0, 0, 0));
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldSendParityAfterEachGroup)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 0, 0x11, ElementsAreArray(ExpectedParity(0, 2, 0)))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 0, 0x11, ElementsAreArray(ExpectedParity(0, 2, 1)))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3, 0x11, SpanOfSize(21)))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 2, 0x11, ElementsAreArray(ExpectedParity(2, 2, 0)))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 2, 0x11, ElementsAreArray(ExpectedParity(2, 2, 1)))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 4, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, 0, 2, 2);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldProtectShorterLastGroup)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 1, 0x11, ElementsAreArray(ExpectedParity(1, 2, 0)))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 3, 0x11, ElementsAreArray(ExpectedParity(3, 1, 0)))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 3, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(1, 10, 2, 1);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldSendOnlyRequestedParts)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 2, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(1, 2, 8, 0);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldStopSendingWhenCancelled)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1, 0x11, _))).WillOnce(InvokeWithoutArgs([this]() {
+                _cancellation.Cancel();
+                return true;
+            }));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Cancelled, 2, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, 0, 2, 1);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldStopSendingWhenParityCannotBeSent)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendParity, 0, 0x11, _))).WillOnce(Return(false));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::SendFailed, 1, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, 0, 1, 1);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldRejectTooManyParityFrames)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, _, _, _))).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::MalformedRequest, 0, 0))).WillOnce(Return(true));
+
+        SendRequest(0, 0, 2, telecommunication::fec::MaxParityCount + 1);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldRejectEmptyGroup)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::MalformedRequest, 0, 0))).WillOnce(Return(true));
+
+        SendRequest(0, 0, 0, 1);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldReportTooBigSeq)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::TooBigSeq, 0, 4))).WillOnce(Return(true));
+
+        SendRequest(4, 0, 2, 1);
+    }
+
+    TEST_F(DownloadFileWithParityTelecommandTest, ShouldReportMissingFile)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::FileNotFound, 0, 0))).WillOnce(Return(true));
+
+        SendRequest(0, 0, 2, 1);
+    }
+}
@@ -0,0 +1,174 @@
+#include <array>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/writer.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/telemetry_archive.hpp"
+#include "telemetry/state.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using testing::_;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::Eq;
+using testing::InSequence;
+using testing::Return;
+using namespace std::chrono_literals;
+
+namespace
+{
+    class TelemetryArchiveStub : public mission::ITelemetryArchive
+    {
+      public:
+        virtual bool Query(std::chrono::milliseconds from, std::chrono::milliseconds to, mission::ITelemetryEntryReceiver& receiver) override
+        {
+            From = from;
+            To = to;
+
+            for (auto& entry : Entries)
+            {
+                if (!receiver.Receive(from, entry))
+                {
+                    break;
+                }
+            }
+
+            return Exists;
+        }
+
+        std::vector<std::vector<std::uint8_t>> Entries;
+        bool Exists = true;
+        std::chrono::milliseconds From = 0ms;
+        std::chrono::milliseconds To = 0ms;
+    };
+
+    class DownloadTelemetryTelecommandTest : public testing::Test
+    {
+      protected:
+        void Run(std::uint8_t correlationId, std::uint64_t from, std::uint64_t to);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        TelemetryArchiveStub _archive;
+        telecommunication::uplink::CancellationToken _cancellation;
+
+        obc::telecommands::DownloadTelemetryTelecommand _telecommand{_archive, _cancellation};
+    };
+
+    void DownloadTelemetryTelecommandTest::Run(std::uint8_t correlationId, std::uint64_t from, std::uint64_t to)
+    {
+        std::array<std::uint8_t, 17> buffer;
+        Writer w(buffer);
+        w.WriteByte(correlationId);
+        w.WriteQuadWordLE(from);
+        w.WriteQuadWordLE(to);
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldQueryRequestedTimeWindow)
+    {
+        Run(0x11, 60000, 0x100000000ull);
+
+        ASSERT_THAT(_archive.From, Eq(60000ms));
+        ASSERT_THAT(_archive.To, Eq(std::chrono::milliseconds(0x100000000ll)));
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldSendEachEntryInSeparateFrame)
+    {
+        _archive.Entries.push_back({1, 2, 3});
+        _archive.Entries.push_back({4, 5});
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAre(0, 1, 2, 3))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 1, 0x11, ElementsAre(0, 4, 5))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 2, 0x11, ElementsAre(3, 2, 0, 0, 0))));
+        }
+
+        Run(0x11, 0, 1000);
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldSendFullSizeTelemetryEntry)
+    {
+        telemetry::SerializedTelemetry entry;
+        for (std::size_t i = 0; i < entry.size(); i++)
+        {
+            entry[i] = static_cast<std::uint8_t>(i);
+        }
+
+        _archive.Entries.emplace_back(entry.begin(), entry.end());
+
+        std::vector<std::uint8_t> expected{0};
+        expected.insert(expected.end(), entry.begin(), entry.end());
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAreArray(expected))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 1, 0x11, ElementsAre(3, 1, 0, 0, 0))));
+        }
+
+        Run(0x11, 0, 1000);
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldStopWhenFrameCannotBeSent)
+    {
+        _archive.Entries.push_back({1});
+        _archive.Entries.push_back({2});
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, _))).WillOnce(Return(false));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAre(3, 0, 0, 0, 0))));
+        }
+
+        Run(0x11, 0, 1000);
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldStopWhenCancelled)
+    {
+        _archive.Entries.push_back({1});
+        _archive.Entries.push_back({2});
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAre(0, 1))))
+                .WillOnce(testing::InvokeWithoutArgs([this]() {
+                    _cancellation.Cancel();
+                    return true;
+                }));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 1, 0x11, ElementsAre(4, 1, 0, 0, 0))));
+        }
+
+        Run(0x11, 0, 1000);
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldReportMissingArchive)
+    {
+        _archive.Exists = false;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAre(2))));
+
+        Run(0x11, 0, 1000);
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldRejectInvertedTimeWindow)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAre(1))));
+
+        Run(0x11, 1000, 0);
+
+        ASSERT_THAT(_archive.To, Eq(0ms));
+    }
+
+    TEST_F(DownloadTelemetryTelecommandTest, ShouldRejectMalformedRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryArchive, 0, 0x11, ElementsAre(1))));
+
+        std::array<std::uint8_t, 5> buffer{0x11, 0, 0, 0, 0};
+        _telecommand.Handle(_transmitter, buffer);
+    }
+}
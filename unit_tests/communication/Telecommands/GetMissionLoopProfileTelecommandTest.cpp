@@ -0,0 +1,160 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/reader.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/mission_profile.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using namespace std::chrono_literals;
+
+namespace
+{
+    class MissionLoopProfileStub : public mission::IMissionLoopProfile
+    {
+      public:
+        virtual gsl::span<const mission::DescriptorTiming> Timings() const override
+        {
+            return gsl::make_span(Entries).subspan(0, Count);
+        }
+
+        virtual void ResetTimings() override
+        {
+        }
+
+        virtual void SetOverrunThreshold(std::chrono::milliseconds) override
+        {
+        }
+
+        std::array<mission::DescriptorTiming, 20> Entries;
+        std::ptrdiff_t Count = 0;
+    };
+
+    class GetMissionLoopProfileTelecommandTest : public testing::Test
+    {
+      protected:
+        GetMissionLoopProfileTelecommandTest();
+
+        template <typename... T> void Run(T... params);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        MissionLoopProfileStub _mission;
+        MissionLoopProfileStub _telemetry;
+
+        obc::telecommands::GetMissionLoopProfileTelecommand _telecommand{_mission, _telemetry};
+    };
+
+    GetMissionLoopProfileTelecommandTest::GetMissionLoopProfileTelecommandTest()
+    {
+        for (auto& entry : _mission.Entries)
+        {
+            entry.Name = "very_long_descriptor_name";
+            entry.Kind = mission::ProfiledElement::Action;
+        }
+
+        _mission.Entries[0].Name = "time";
+        _mission.Entries[0].Kind = mission::ProfiledElement::Update;
+        _mission.Entries[0].Record(10ms, 100ms);
+        _mission.Entries[0].Record(30ms, 100ms);
+        _mission.Entries[0].Record(200ms, 100ms);
+    }
+
+    template <typename... T> void GetMissionLoopProfileTelecommandTest::Run(T... params)
+    {
+        std::array<std::uint8_t, sizeof...(T)> buffer{static_cast<std::uint8_t>(params)...};
+
+        _telecommand.Handle(_transmitter, buffer);
+    }
+
+    TEST_F(GetMissionLoopProfileTelecommandTest, ShouldRespondWithFirstEntries)
+    {
+        _mission.Count = 2;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MissionLoopProfile, 0, 0x11, _)))
+            .WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+                Reader r(frame.subspan(4));
+
+                EXPECT_THAT(r.ReadByte(), Eq(0));
+                EXPECT_THAT(r.ReadByte(), Eq(2));
+                EXPECT_THAT(r.ReadByte(), Eq(0));
+
+                EXPECT_THAT(r.ReadByte(), Eq(0));
+                EXPECT_THAT(r.ReadByte(), Eq(4));
+                EXPECT_THAT(r.ReadByte(), Eq('t'));
+                r.Skip(3);
+                EXPECT_THAT(r.ReadDoubleWordLE(), Eq(3u));
+                EXPECT_THAT(r.ReadDoubleWordLE(), Eq(10u));
+                EXPECT_THAT(r.ReadDoubleWordLE(), Eq(80u));
+                EXPECT_THAT(r.ReadDoubleWordLE(), Eq(200u));
+                EXPECT_THAT(r.ReadDoubleWordLE(), Eq(200u));
+                EXPECT_THAT(r.ReadWordLE(), Eq(1));
+
+                EXPECT_THAT(r.ReadByte(), Eq(2));
+                EXPECT_THAT(r.ReadByte(), Eq(obc::telecommands::GetMissionLoopProfileTelecommand::MaxNameLength));
+                r.Skip(obc::telecommands::GetMissionLoopProfileTelecommand::MaxNameLength + 22);
+
+                EXPECT_THAT(r.RemainingSize(), Eq(0));
+                EXPECT_THAT(r.Status(), Eq(true));
+                return true;
+            }));
+
+        Run(0x11, 0, 0);
+    }
+
+    TEST_F(GetMissionLoopProfileTelecommandTest, ShouldStartFromRequestedEntry)
+    {
+        _mission.Count = 20;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MissionLoopProfile, 0, 0x11, _)))
+            .WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+                Reader r(frame.subspan(4));
+
+                EXPECT_THAT(r.ReadByte(), Eq(0));
+                EXPECT_THAT(r.ReadByte(), Eq(20));
+                EXPECT_THAT(r.ReadByte(), Eq(18));
+                r.Skip(2 * (obc::telecommands::GetMissionLoopProfileTelecommand::MaxNameLength + 24));
+
+                EXPECT_THAT(r.RemainingSize(), Eq(0));
+                EXPECT_THAT(r.Status(), Eq(true));
+                return true;
+            }));
+
+        Run(0x11, 0, 18);
+    }
+
+    TEST_F(GetMissionLoopProfileTelecommandTest, ShouldLimitEntriesToSingleFrame)
+    {
+        _mission.Count = 20;
+
+        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+            EXPECT_THAT(frame.size() <= devices::comm::MaxDownlinkFrameSize, Eq(true));
+            return true;
+        }));
+
+        Run(0x11, 0, 1);
+    }
+
+    TEST_F(GetMissionLoopProfileTelecommandTest, ShouldUseTelemetryLoop)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MissionLoopProfile, 0, 0x11, testing::ElementsAre(0, 0, 0))));
+
+        Run(0x11, 1, 0);
+    }
+
+    TEST_F(GetMissionLoopProfileTelecommandTest, ShouldRejectUnknownLoop)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MissionLoopProfile, 0, 0x11, testing::ElementsAre(1))));
+
+        Run(0x11, 2, 0);
+    }
+
+    TEST_F(GetMissionLoopProfileTelecommandTest, ShouldRejectMalformedRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MissionLoopProfile, 0, 0x11, testing::ElementsAre(1))));
+
+        Run(0x11);
+    }
+}
@@ -0,0 +1,54 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/comm.hpp"
+#include "telecommunication/downlink.h"
+#include "utils.hpp"
+
+using telecommunication::downlink::DownlinkAPID;
+using testing::ElementsAre;
+using testing::Return;
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct ReceivePollingStatisticsProviderMock : public devices::comm::IReceivePollingStatisticsProvider
+    {
+        MOCK_CONST_METHOD0(GetReceivePollingStatistics, devices::comm::ReceivePollingStatistics());
+    };
+
+    class GetReceivePollingStatisticsTelecommandTest : public testing::Test
+    {
+      protected:
+        testing::NiceMock<TransmitterMock> transmitter;
+        ReceivePollingStatisticsProviderMock provider;
+
+        obc::telecommands::GetReceivePollingStatisticsTelecommand telecommand{provider};
+    };
+
+    TEST_F(GetReceivePollingStatisticsTelecommandTest, ShouldSendIntervalAndLatencyHistogram)
+    {
+        devices::comm::ReceivePollingStatistics statistics;
+        statistics.Interval = 400ms;
+        statistics.Latency = {{1, 2, 3, 4, 5, 6, 0x1234}};
+        EXPECT_CALL(provider, GetReceivePollingStatistics()).WillOnce(Return(statistics));
+
+        EXPECT_CALL(transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::ReceivePolling,
+                0,
+                0x11,
+                ElementsAre(0, 0x90, 0x01, 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0, 0x34, 0x12))));
+
+        std::array<std::uint8_t, 1> buffer{0x11};
+        telecommand.Handle(transmitter, buffer);
+    }
+
+    TEST_F(GetReceivePollingStatisticsTelecommandTest, ShouldRejectMalformedRequest)
+    {
+        EXPECT_CALL(provider, GetReceivePollingStatistics()).Times(0);
+        EXPECT_CALL(transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::ReceivePolling, 0, 0, ElementsAre(1))));
+
+        telecommand.Handle(transmitter, gsl::span<const std::uint8_t>());
+    }
+}
@@ -17,7 +17,8 @@ namespace
     {
       protected:
         testing::NiceMock<TransmitterMock> _transmitter;
-        ReadMemoryTelecommand _telecommand;
+        telecommunication::uplink::CancellationToken _cancellation;
+        ReadMemoryTelecommand _telecommand{_cancellation};
     };
 
     TEST_F(ReadMemoryTelecommandTest, ShouldReadMemoryRange)
@@ -67,6 +68,31 @@ namespace
         _telecommand.Handle(_transmitter, args);
     }
 
+    TEST_F(ReadMemoryTelecommandTest, ShouldStopWhenCancelled)
+    {
+        std::array<std::uint8_t, 300> memoryToRead{};
+
+        auto part1 = gsl::make_span(memoryToRead).subspan(0, CorrelatedDownlinkFrame::MaxPayloadSize);
+
+        {
+            testing::InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MemoryContent, 0, 0x12, part1)))
+                .WillOnce(testing::InvokeWithoutArgs([this]() {
+                    _cancellation.Cancel();
+                    return true;
+                }));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Operation, 0, 0x12, ElementsAre(2))));
+        }
+
+        std::array<std::uint8_t, 9> args;
+        Writer w(args);
+        w.WriteByte(0x12);
+        w.WriteDoubleWordLE(reinterpret_cast<std::uint32_t>(memoryToRead.data()));
+        w.WriteDoubleWordLE(300);
+
+        _telecommand.Handle(_transmitter, args);
+    }
+
     TEST_F(ReadMemoryTelecommandTest, ShouldTrimReadedSizeToUpperMemoryLimit)
     {
         EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::MemoryContent, 0, 0x12, SpanOfSize(50))));
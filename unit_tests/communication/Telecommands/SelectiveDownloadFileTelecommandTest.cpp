@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <array>
+#include <string>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/writer.h"
+#include "mock/FsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/downlink.h"
+#include "utils.hpp"
+
+using std::uint8_t;
+using testing::_;
+using testing::Eq;
+using testing::ElementsAre;
+using testing::InSequence;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+using obc::telecommands::DownloadFileTelecommand;
+using obc::telecommands::SelectiveDownloadFileTelecommand;
+using telecommunication::downlink::DownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+
+namespace
+{
+    constexpr uint8_t MaxFileDataSize = DownlinkFrame::MaxPayloadSize - 2;
+
+    class SelectiveDownloadFileTelecommandTest : public testing::Test
+    {
+      protected:
+        SelectiveDownloadFileTelecommandTest();
+
+        void SendRequest(std::uint32_t first, std::initializer_list<uint8_t> selection);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<FsMock> _fs;
+
+        telecommunication::uplink::CancellationToken _cancellation;
+
+        SelectiveDownloadFileTelecommand _telecommand{_fs, _cancellation};
+
+        const std::string _path{"/a/file"};
+
+        std::array<uint8_t, 3 * MaxFileDataSize + 20> _file;
+    };
+
+    SelectiveDownloadFileTelecommandTest::SelectiveDownloadFileTelecommandTest()
+    {
+        for (auto i = 0; i < 4; i++)
+        {
+            const auto begin = _file.begin() + i * MaxFileDataSize;
+            std::fill(begin, std::min(begin + MaxFileDataSize, _file.end()), i + 1);
+        }
+    }
+
+    void SelectiveDownloadFileTelecommandTest::SendRequest(std::uint32_t first, std::initializer_list<uint8_t> selection)
+    {
+        std::array<uint8_t, 200> buffer;
+        Writer w(buffer);
+        w.WriteByte(0x11);
+        w.WriteByte(_path.length());
+        w.WriteArray(gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(_path.data()), _path.length()));
+        w.WriteByte(0);
+        w.WriteDoubleWordLE(first);
+
+        for (auto b : selection)
+        {
+            w.WriteByte(b);
+        }
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    testing::Matcher<gsl::span<const uint8_t>> IsSummary(DownloadFileTelecommand::ErrorCode status, uint8_t sent, uint8_t partsCount)
+    {
+        return IsDownlinkFrame(
+            DownlinkAPID::FileSendSummary, 0, 0x11, ElementsAre(num(status), sent, 0, 0, 0, partsCount, 0, 0, 0));
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldSendRangeOfParts)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 2, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(1, {SelectiveDownloadFileTelecommand::RangeTag, 1, 0, 2, 0});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldSendPartsSelectedByBitmap)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3, 0x11, SpanOfSize(21))))
+                .WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 2, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::BitmapTag, 1, 0b1001});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldContinueBitmapAfterRange)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 2, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::RangeTag, 0, 0, 1, 0, SelectiveDownloadFileTelecommand::BitmapTag, 1, 0b100});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldIgnorePartsBeyondEndOfFile)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, _, 0x11, _))).Times(4).WillRepeatedly(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Success, 4, 4))).WillOnce(Return(true));
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::RangeTag, 0, 0, 0xFF, 0xFF, SelectiveDownloadFileTelecommand::BitmapTag, 1, 0xFF});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldRejectMalformedSelectionBeforeSendingAnyPart)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, _, _, _))).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::MalformedRequest, 0, 4)))
+            .WillOnce(Return(true));
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::RangeTag, 0, 0, 1, 0, SelectiveDownloadFileTelecommand::BitmapTag, 2, 0xFF});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldStopSendingPartsWhenCancelled)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(InvokeWithoutArgs([this]() {
+                _cancellation.Cancel();
+                return true;
+            }));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::Cancelled, 1, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::RangeTag, 0, 0, 4, 0});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldStopSendingPartsWhenFrameCannotBeSent)
+    {
+        _fs.AddFile(_path.c_str(), _file);
+
+        {
+            InSequence s;
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0, 0x11, _))).WillOnce(Return(true));
+            EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1, 0x11, _))).WillOnce(Return(false));
+            EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::SendFailed, 1, 4))).WillOnce(Return(true));
+        }
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::RangeTag, 0, 0, 4, 0});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldReportMissingFile)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::FileNotFound, 0, 0))).WillOnce(Return(true));
+
+        SendRequest(0, {SelectiveDownloadFileTelecommand::RangeTag, 0, 0, 4, 0});
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldReportMalformedRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsSummary(DownloadFileTelecommand::ErrorCode::MalformedRequest, 0, 0))).WillOnce(Return(true));
+
+        std::array<uint8_t, 3> request{0x11, 5, 'a'};
+        _telecommand.Handle(_transmitter, request);
+    }
+}
@@ -27,9 +27,8 @@ namespace
 
     TEST_F(SendBeaconTelecommandTest, ShouldSendBeacon)
     {
-        ON_CALL(_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Success));
-
         telemetry::TelemetryState tm;
+        tm.serializedTelemetry.Publish(telemetry::SerializedTelemetry());
 
         ON_CALL(_stateProvider, MockGetState()).WillByDefault(ReturnRef(tm));
 
@@ -40,8 +39,6 @@ namespace
 
     TEST_F(SendBeaconTelecommandTest, ShouldSendErrorFrameWhenUnableToWriteBeacon)
     {
-        ON_CALL(_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Timeout));
-
         telemetry::TelemetryState tm;
 
         ON_CALL(_stateProvider, MockGetState()).WillByDefault(ReturnRef(tm));
@@ -32,6 +32,7 @@ using testing::InSequence;
 using testing::ReturnPointee;
 using testing::DoAll;
 using testing::Assign;
+using testing::Each;
 using gsl::span;
 using drivers::i2c::I2CResult;
 using namespace devices::comm;
@@ -485,6 +486,77 @@ namespace
         ASSERT_THAT(error_counter, Eq(5));
     }
 
+    TEST_F(CommTest, TestSendFrameReportsRemainingSlots)
+    {
+        uint8_t buffer[] = {0x1, 0x2, 0x3};
+        ExpectSendFrame(7);
+        std::uint8_t remainingSlots = 0;
+        const auto status = comm.SendFrame(span<const uint8_t>(buffer), remainingSlots);
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(remainingSlots, Eq(7));
+    }
+
+    TEST_F(CommTest, TestSendFrameReportsRejectedFrame)
+    {
+        uint8_t buffer[] = {0x1, 0x2, 0x3};
+        ExpectSendFrame(0xff);
+        std::uint8_t remainingSlots = 0;
+        const auto status = comm.SendFrame(span<const uint8_t>(buffer), remainingSlots);
+        ASSERT_THAT(status, Eq(false));
+        ASSERT_THAT(remainingSlots, Eq(0xff));
+    }
+
+    TEST_F(CommTest, TestSendFrameInPlaceDoesNotCopyFrame)
+    {
+        devices::comm::DownlinkFrameBuffer buffer;
+        buffer[1] = 0x1;
+        buffer[2] = 0x2;
+        buffer[3] = 0x3;
+
+        EXPECT_CALL(i2c, Write(TransmitterAddress, BeginsWith(TransmitterSendFrame)))
+            .WillOnce(Invoke([this, &buffer](uint8_t /*address*/, span<const uint8_t> inData) {
+                EXPECT_THAT(inData.data(), Eq(buffer.data()));
+                EXPECT_THAT(inData, ElementsAre(TransmitterSendFrame, 0x1, 0x2, 0x3));
+                EXPECT_CALL(i2c, Read(TransmitterAddress, _)).WillOnce(Invoke([](uint8_t /*address*/, span<uint8_t> outData) {
+                    outData[0] = 7;
+                    return I2CResult::OK;
+                }));
+                return I2CResult::OK;
+            }));
+
+        std::uint8_t remainingSlots = 0;
+        const auto status = comm.SendFrameInPlace(buffer, 3, remainingSlots);
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(remainingSlots, Eq(7));
+    }
+
+    TEST_F(CommTest, TestSendTooLongFrameInPlace)
+    {
+        devices::comm::DownlinkFrameBuffer buffer;
+        EXPECT_CALL(i2c, Write(_, _)).Times(0);
+
+        std::uint8_t remainingSlots = 0;
+        const auto status = comm.SendFrameInPlace(buffer, devices::comm::MaxDownlinkFrameSize + 1, remainingSlots);
+        ASSERT_THAT(status, Eq(false));
+    }
+
+    TEST_F(CommTest, TestFrameBufferCanBeAcquiredOnlyOnce)
+    {
+        auto buffer = comm.AcquireFrameBuffer();
+        ASSERT_THAT(buffer, Ne(nullptr));
+        ASSERT_THAT(comm.AcquireFrameBuffer(), Eq(nullptr));
+
+        (*buffer)[1] = 0x5;
+        const uint8_t expected[] = {TransmitterSendFrame, 0x5};
+        ExpectSendFrame(gsl::make_span(expected), 3);
+        ASSERT_THAT(comm.SendFrameBuffer(*buffer, 1), Eq(true));
+
+        buffer = comm.AcquireFrameBuffer();
+        ASSERT_THAT(buffer, Ne(nullptr));
+        comm.ReleaseFrameBuffer(*buffer);
+        ASSERT_THAT(comm.AcquireFrameBuffer(), Ne(nullptr));
+    }
+
     TEST_F(CommTest, TestReceiveFrameRequestFailure)
     {
         Frame frame;
@@ -1191,6 +1263,56 @@ namespace
         ASSERT_THAT(error_counter, Eq(8));
     }
 
+    TEST_F(CommTest, TestPollHardwareRemovesAllFramesBeforeHandlingThem)
+    {
+        std::uint8_t buffer[10] = {0};
+        MockFrameCount(3);
+        MockFrame(buffer, 1, 2);
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverWatchdogReset).WillOnce(Return(I2CResult::OK));
+
+        int removed = 0;
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverRemoveFrame).Times(3).WillRepeatedly(Invoke([&removed](auto, auto) {
+            removed++;
+            return I2CResult::OK;
+        }));
+        EXPECT_CALL(frameHandler, HandleFrame(_, _)).Times(3).WillRepeatedly(Invoke([&removed](auto&, auto&) {
+            ASSERT_THAT(removed, Eq(3));
+        }));
+
+        ASSERT_THAT(comm.PollHardware(), Eq(true));
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestPollHardwareLimitsBatchToPoolCapacity)
+    {
+        std::uint8_t buffer[10] = {0};
+        MockFrameCount(CommObject::ReceivePoolCapacity + 5);
+        MockFrame(buffer, 1, 2);
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverWatchdogReset).WillOnce(Return(I2CResult::OK));
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverRemoveFrame).Times(CommObject::ReceivePoolCapacity).WillRepeatedly(Return(I2CResult::OK));
+        EXPECT_CALL(frameHandler, HandleFrame(_, _)).Times(CommObject::ReceivePoolCapacity);
+
+        ASSERT_THAT(comm.PollHardware(), Eq(true));
+    }
+
+    TEST_F(CommTest, TestWakeUpRequestsReceiverQuery)
+    {
+        const auto events = reinterpret_cast<OSEventGroupHandle>(&comm);
+        EXPECT_CALL(system, EventGroupSetBits(events, 16));
+        EXPECT_CALL(system, EventGroupSetBitsISR(events, 16));
+
+        comm.WakeUp();
+        comm.WakeUpISR();
+    }
+
+    TEST_F(CommTest, TestReceivePollingStartsWithFastInterval)
+    {
+        auto statistics = comm.GetReceivePollingStatistics();
+
+        ASSERT_THAT(statistics.Interval, Eq(AdaptiveReceivePolling::FastInterval));
+        ASSERT_THAT(statistics.Latency, Each(Eq(0)));
+    }
+
     TEST_F(CommTest, TestRestartHardwareFailure)
     {
         i2c.ExpectWriteCommand(ReceiverAddress, HardwareReset).WillOnce(Return(I2CResult::Nack));
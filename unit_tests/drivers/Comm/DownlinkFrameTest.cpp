@@ -4,17 +4,23 @@
 #include "gmock/gmock.h"
 #include "base/writer.h"
 #include "comm/comm.hpp"
+#include "mock/comm.hpp"
 #include "system.h"
 #include "telecommunication/downlink.h"
 #include "utils.h"
 
 using testing::Test;
 using testing::Eq;
+using testing::ElementsAre;
+using testing::Return;
 using std::array;
 using std::uint8_t;
 using std::uint32_t;
 using telecommunication::downlink::DownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::FramePriority;
+using telecommunication::downlink::TransmitterDownlinkFrame;
+using devices::comm::DownlinkPriority;
 namespace
 {
     TEST(DownlinkFrameTest, ShouldBuildProperDownlinkFrame)
@@ -43,4 +49,55 @@ namespace
         ASSERT_THAT(frame.PayloadWriter().WriteArray(payload), Eq(true));
         ASSERT_THAT(frame.PayloadWriter().WriteByte(0xAA), Eq(false));
     }
+
+    TEST(DownlinkFrameTest, ShouldClassifyFramesByApid)
+    {
+        DownlinkFrame control(DownlinkAPID::Operation, 0x1DB55);
+        DownlinkFrame file(DownlinkAPID::FileSend, 0x1DB55);
+        DownlinkFrame memory(DownlinkAPID::MemoryContent, 3);
+        DownlinkFrame compressed(DownlinkAPID::FileSendCompressed, 7);
+        DownlinkFrame parity(DownlinkAPID::FileSendParity, 8);
+        DownlinkFrame periodic(DownlinkAPID::PeriodicMessage, 0);
+        const uint8_t beacon[] = {telecommunication::downlink::BeaconMarker, 0x11, 0x22};
+
+        ASSERT_THAT(FramePriority(control.Frame()), Eq(DownlinkPriority::Control));
+        ASSERT_THAT(FramePriority(file.Frame()), Eq(DownlinkPriority::Bulk));
+        ASSERT_THAT(FramePriority(memory.Frame()), Eq(DownlinkPriority::Bulk));
+        ASSERT_THAT(FramePriority(compressed.Frame()), Eq(DownlinkPriority::Bulk));
+        ASSERT_THAT(FramePriority(parity.Frame()), Eq(DownlinkPriority::Bulk));
+        ASSERT_THAT(FramePriority(periodic.Frame()), Eq(DownlinkPriority::Bulk));
+        ASSERT_THAT(FramePriority(beacon), Eq(DownlinkPriority::Beacon));
+    }
+
+    TEST(DownlinkFrameTest, ShouldBuildFrameInTransmitterBuffer)
+    {
+        TransmitterMock transmitter;
+        EXPECT_CALL(transmitter, SendFrame(ElementsAre(0x42, 0xD5, 0x76, 0x11, 0x42))).WillOnce(Return(true));
+
+        TransmitterDownlinkFrame frame(transmitter, DownlinkAPID::Operation, 0x1DB55, 0x11);
+        ASSERT_THAT(frame.IsValid(), Eq(true));
+
+        frame.PayloadWriter().WriteByte(0x42);
+
+        ASSERT_THAT(frame.Send(), Eq(true));
+    }
+
+    struct ExhaustedTransmitterMock : TransmitterMock
+    {
+        virtual devices::comm::DownlinkFrameBuffer* AcquireFrameBuffer() override
+        {
+            return nullptr;
+        }
+    };
+
+    TEST(DownlinkFrameTest, ShouldNotSendFrameWithoutTransmitterBuffer)
+    {
+        ExhaustedTransmitterMock transmitter;
+        EXPECT_CALL(transmitter, SendFrame(testing::_)).Times(0);
+
+        TransmitterDownlinkFrame frame(transmitter, DownlinkAPID::Operation, 1, 0x11);
+        ASSERT_THAT(frame.IsValid(), Eq(false));
+        ASSERT_THAT(frame.PayloadWriter().WriteByte(0x42), Eq(false));
+        ASSERT_THAT(frame.Send(), Eq(false));
+    }
 }
@@ -0,0 +1,410 @@
+#include <array>
+#include <cstring>
+#include <deque>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "base/BitWriter.hpp"
+#include "comm/DownlinkQueue.hpp"
+#include "comm/Frame.hpp"
+#include "mock/comm.hpp"
+#include "os/os.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Eq;
+using testing::Ne;
+using testing::Ref;
+using testing::Return;
+using testing::Invoke;
+using testing::ElementsAre;
+using testing::NiceMock;
+using namespace devices::comm;
+
+namespace
+{
+    struct FlowControlledTransmitterMock : public IFlowControlledTransmitter
+    {
+        MOCK_METHOD1(SendFrame, bool(gsl::span<const std::uint8_t>));
+        MOCK_METHOD2(SendFrame, bool(gsl::span<const std::uint8_t>, std::uint8_t&));
+        MOCK_METHOD3(SendFrameInPlace, bool(DownlinkFrameBuffer&, std::uint8_t, std::uint8_t&));
+        MOCK_METHOD0(AcquireFrameBuffer, DownlinkFrameBuffer*());
+        MOCK_METHOD2(SendFrameBuffer, bool(DownlinkFrameBuffer&, std::uint8_t));
+        MOCK_METHOD1(ReleaseFrameBuffer, void(DownlinkFrameBuffer&));
+        MOCK_METHOD1(GetTransmitterTelemetry, bool(TransmitterTelemetry&));
+        MOCK_METHOD1(SetTransmitterStateWhenIdle, bool(IdleState));
+        MOCK_METHOD1(SetTransmitterBitRate, bool(Bitrate));
+        MOCK_METHOD0(ResetTransmitter, bool());
+    };
+
+    struct FrameHandlerMock : public IHandleFrame
+    {
+        MOCK_METHOD2(HandleFrame, void(ITransmitter&, Frame&));
+    };
+
+    /** @brief Test classifier, priority is stored in the first byte of frame */
+    DownlinkPriority ClassifyByFirstByte(gsl::span<const std::uint8_t> frame)
+    {
+        return static_cast<DownlinkPriority>(frame[0]);
+    }
+
+    /** @brief In-memory implementation of RTOS queues, handles are assigned in order of creation */
+    class FakeQueues
+    {
+      public:
+        OSQueueHandle Create(std::size_t capacity, std::size_t elementSize)
+        {
+            this->_queues.push_back({capacity, elementSize, {}});
+            return reinterpret_cast<OSQueueHandle>(this->_queues.size());
+        }
+
+        bool Send(OSQueueHandle handle, const void* element)
+        {
+            auto& queue = Get(handle);
+            if (queue.Elements.size() >= queue.Capacity)
+            {
+                return false;
+            }
+
+            auto bytes = static_cast<const std::uint8_t*>(element);
+            queue.Elements.emplace_back(bytes, bytes + queue.ElementSize);
+            return true;
+        }
+
+        bool Receive(OSQueueHandle handle, void* element)
+        {
+            auto& queue = Get(handle);
+            if (queue.Elements.empty())
+            {
+                return false;
+            }
+
+            std::memcpy(element, queue.Elements.front().data(), queue.ElementSize);
+            queue.Elements.pop_front();
+            return true;
+        }
+
+        std::size_t Size(OSQueueHandle handle)
+        {
+            return Get(handle).Elements.size();
+        }
+
+        /** @brief Returns pointer to frame buffer stored at the beginning of queued element */
+        DownlinkFrameBuffer* FrontBuffer(OSQueueHandle handle)
+        {
+            DownlinkFrameBuffer* buffer = nullptr;
+            std::memcpy(&buffer, Get(handle).Elements.front().data(), sizeof(buffer));
+            return buffer;
+        }
+
+      private:
+        struct FakeQueue
+        {
+            std::size_t Capacity;
+            std::size_t ElementSize;
+            std::deque<std::vector<std::uint8_t>> Elements;
+        };
+
+        FakeQueue& Get(OSQueueHandle handle)
+        {
+            return this->_queues.at(reinterpret_cast<std::size_t>(handle) - 1);
+        }
+
+        std::vector<FakeQueue> _queues;
+    };
+
+    const auto FreeQueue = reinterpret_cast<OSQueueHandle>(1);
+    const auto ControlQueue = reinterpret_cast<OSQueueHandle>(2);
+    const auto BeaconQueue = reinterpret_cast<OSQueueHandle>(3);
+    const auto BulkQueue = reinterpret_cast<OSQueueHandle>(4);
+    const auto Events = reinterpret_cast<OSEventGroupHandle>(5);
+
+    class DownlinkQueueTest : public testing::Test
+    {
+      protected:
+        DownlinkQueueTest();
+
+        std::uint8_t FreeBuffers();
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+        FakeQueues queues;
+        NiceMock<FlowControlledTransmitterMock> transmitter;
+        DownlinkQueue queue;
+    };
+
+    DownlinkQueueTest::DownlinkQueueTest() : osReset(InstallProxy(&os)), queue(transmitter, ClassifyByFirstByte)
+    {
+        ON_CALL(os, CreateQueue(_, _)).WillByDefault(Invoke([this](std::size_t capacity, std::size_t elementSize) {
+            return this->queues.Create(capacity, elementSize);
+        }));
+        ON_CALL(os, QueueSend(_, _, _)).WillByDefault(Invoke([this](OSQueueHandle handle, const void* element, std::chrono::milliseconds) {
+            return this->queues.Send(handle, element);
+        }));
+        ON_CALL(os, QueueReceive(_, _, _)).WillByDefault(Invoke([this](OSQueueHandle handle, void* element, std::chrono::milliseconds) {
+            return this->queues.Receive(handle, element);
+        }));
+        ON_CALL(os, CreateEventGroup()).WillByDefault(Return(Events));
+
+        queue.Initialize();
+
+        EXPECT_CALL(os, QueueSend(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(os, QueueReceive(_, _, _)).Times(AnyNumber());
+    }
+
+    std::uint8_t DownlinkQueueTest::FreeBuffers()
+    {
+        return queues.Size(FreeQueue);
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldStartSenderTask)
+    {
+        DownlinkQueue other(transmitter, ClassifyByFirstByte);
+
+        EXPECT_CALL(os, CreateQueue(DownlinkQueue::PoolCapacity, sizeof(DownlinkFrameBuffer*)));
+        EXPECT_CALL(os, CreateQueue(DownlinkQueue::ControlCapacity, _));
+        EXPECT_CALL(os, CreateQueue(1, _));
+        EXPECT_CALL(os, CreateQueue(DownlinkQueue::BulkCapacity, _));
+        EXPECT_CALL(os, CreateTask(_, _, _, &other, _, _)).WillOnce(Return(OSResult::Success));
+
+        ASSERT_THAT(other.Initialize(), Eq(OSResult::Success));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldFailWhenQueueCannotBeCreated)
+    {
+        DownlinkQueue other(transmitter, ClassifyByFirstByte);
+
+        EXPECT_CALL(os, CreateQueue(_, _)).WillOnce(Return(nullptr));
+        EXPECT_CALL(os, CreateTask(_, _, _, _, _, _)).Times(0);
+
+        ASSERT_THAT(other.Initialize(), Eq(OSResult::NotEnoughMemory));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldFillPoolOnInitialization)
+    {
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldQueueControlFrameWithoutTransmittingIt)
+    {
+        std::array<std::uint8_t, 3> frame{0, 2, 3};
+
+        EXPECT_CALL(transmitter, SendFrame(_, _)).Times(0);
+        EXPECT_CALL(transmitter, SendFrameInPlace(_, _, _)).Times(0);
+        EXPECT_CALL(os, QueueReceive(FreeQueue, _, DownlinkQueue::ControlEnqueueTimeout));
+        EXPECT_CALL(os, QueueSend(ControlQueue, _, DownlinkQueue::ControlEnqueueTimeout));
+        EXPECT_CALL(os, EventGroupSetBits(Events, 3));
+
+        ASSERT_THAT(queue.SendFrame(frame), Eq(true));
+
+        const auto queued = queues.FrontBuffer(ControlQueue);
+        ASSERT_THAT(gsl::make_span(*queued).subspan(DownlinkFrameHeadroom, 3), ElementsAre(0, 2, 3));
+        ASSERT_THAT(queue.Depth(DownlinkPriority::Control), Eq(1));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity - 1));
+
+        const auto telemetry = queue.GetQueueTelemetry();
+        ASSERT_THAT(telemetry.Depth(), Eq(1));
+        ASSERT_THAT(telemetry.ControlDropped(), Eq(0));
+        ASSERT_THAT(telemetry.BulkDropped(), Eq(0));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldQueueFrameBuiltInPooledBuffer)
+    {
+        auto buffer = queue.AcquireFrameBuffer();
+        ASSERT_THAT(buffer, Ne(nullptr));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity - 1));
+
+        (*buffer)[DownlinkFrameHeadroom] = num(DownlinkPriority::Bulk);
+        (*buffer)[DownlinkFrameHeadroom + 1] = 0xAB;
+
+        ASSERT_THAT(queue.SendFrameBuffer(*buffer, 2), Eq(true));
+        ASSERT_THAT(queues.FrontBuffer(BulkQueue), Eq(buffer));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity - 1));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldReturnReleasedBufferToPool)
+    {
+        auto buffer = queue.AcquireFrameBuffer();
+        queue.ReleaseFrameBuffer(*buffer);
+
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldDropFrameWhenPoolIsExhausted)
+    {
+        for (auto i = 0; i < DownlinkQueue::PoolCapacity; i++)
+        {
+            ASSERT_THAT(queue.AcquireFrameBuffer(), Ne(nullptr));
+        }
+
+        std::array<std::uint8_t, 3> frame{0, 2, 3};
+
+        ASSERT_THAT(queue.AcquireFrameBuffer(), Eq(nullptr));
+
+        EXPECT_CALL(os, QueueReceive(FreeQueue, _, DownlinkQueue::ControlEnqueueTimeout));
+        ASSERT_THAT(queue.SendFrame(frame), Eq(false));
+        ASSERT_THAT(queue.Dropped(DownlinkPriority::Control), Eq(1u));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldNotWaitForFreeBufferForBeacon)
+    {
+        for (auto i = 0; i < DownlinkQueue::PoolCapacity; i++)
+        {
+            ASSERT_THAT(queue.AcquireFrameBuffer(), Ne(nullptr));
+        }
+
+        std::array<std::uint8_t, 3> beacon{1, 2, 3};
+
+        EXPECT_CALL(os, QueueReceive(FreeQueue, _, std::chrono::milliseconds::zero()));
+        ASSERT_THAT(queue.SendFrame(beacon), Eq(false));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldQueueBulkFrameWithoutWakingUpPacedSender)
+    {
+        std::array<std::uint8_t, 3> frame{2, 2, 3};
+
+        EXPECT_CALL(os, QueueReceive(FreeQueue, _, DownlinkQueue::BulkEnqueueTimeout));
+        EXPECT_CALL(os, QueueSend(BulkQueue, _, DownlinkQueue::BulkEnqueueTimeout));
+        EXPECT_CALL(os, EventGroupSetBits(Events, 1));
+
+        ASSERT_THAT(queue.SendFrame(frame), Eq(true));
+        ASSERT_THAT(queue.Depth(DownlinkPriority::Bulk), Eq(1));
+        ASSERT_THAT(queue.GetQueueTelemetry().Depth(), Eq(1));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldReplaceQueuedBeacon)
+    {
+        std::array<std::uint8_t, 3> first{1, 2, 3};
+        std::array<std::uint8_t, 3> second{1, 4, 5};
+
+        ASSERT_THAT(queue.SendFrame(first), Eq(true));
+        ASSERT_THAT(queue.SendFrame(second), Eq(true));
+
+        ASSERT_THAT(queues.Size(BeaconQueue), Eq(1u));
+        ASSERT_THAT(gsl::make_span(*queues.FrontBuffer(BeaconQueue)).subspan(DownlinkFrameHeadroom, 3), ElementsAre(1, 4, 5));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity - 1));
+        ASSERT_THAT(queue.Depth(DownlinkPriority::Beacon), Eq(1));
+        ASSERT_THAT(queue.Dropped(DownlinkPriority::Beacon), Eq(0u));
+        ASSERT_THAT(queue.GetQueueTelemetry().Depth(), Eq(0));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldCountReplacedBeaconOnce)
+    {
+        std::array<std::uint8_t, 3> beacon{1, 2, 3};
+
+        for (auto i = 0; i < 5; i++)
+        {
+            ASSERT_THAT(queue.SendFrame(beacon), Eq(true));
+        }
+
+        ASSERT_THAT(queue.Depth(DownlinkPriority::Beacon), Eq(1));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity - 1));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldNotCountBeaconThatCannotBeQueued)
+    {
+        std::array<std::uint8_t, 3> beacon{1, 2, 3};
+
+        EXPECT_CALL(os, QueueSend(BeaconQueue, _, _)).WillOnce(Return(false));
+
+        ASSERT_THAT(queue.SendFrame(beacon), Eq(false));
+
+        ASSERT_THAT(queue.Depth(DownlinkPriority::Beacon), Eq(0));
+        ASSERT_THAT(queue.Dropped(DownlinkPriority::Beacon), Eq(1u));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldDropFrameWhenQueueIsFull)
+    {
+        std::array<std::uint8_t, 3> control{0, 2, 3};
+        std::array<std::uint8_t, 3> bulk{2, 2, 3};
+
+        for (auto i = 0; i < DownlinkQueue::ControlCapacity; i++)
+        {
+            ASSERT_THAT(queue.SendFrame(control), Eq(true));
+        }
+
+        EXPECT_CALL(os, QueueSend(BulkQueue, _, _)).WillOnce(Return(false));
+
+        ASSERT_THAT(queue.SendFrame(control), Eq(false));
+        ASSERT_THAT(queue.SendFrame(bulk), Eq(false));
+
+        ASSERT_THAT(queue.Dropped(DownlinkPriority::Control), Eq(1u));
+        ASSERT_THAT(queue.Dropped(DownlinkPriority::Bulk), Eq(1u));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity - DownlinkQueue::ControlCapacity));
+
+        const auto telemetry = queue.GetQueueTelemetry();
+        ASSERT_THAT(telemetry.Depth(), Eq(3));
+        ASSERT_THAT(telemetry.ControlDropped(), Eq(1));
+        ASSERT_THAT(telemetry.BulkDropped(), Eq(1));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldRejectTooLongFrame)
+    {
+        std::array<std::uint8_t, MaxDownlinkFrameSize + 1> frame{};
+
+        EXPECT_CALL(os, QueueSend(Ne(FreeQueue), _, _)).Times(0);
+
+        ASSERT_THAT(queue.SendFrame(frame), Eq(false));
+
+        auto buffer = queue.AcquireFrameBuffer();
+        ASSERT_THAT(queue.SendFrameBuffer(*buffer, MaxDownlinkFrameSize + 1), Eq(false));
+        ASSERT_THAT(FreeBuffers(), Eq(DownlinkQueue::PoolCapacity));
+    }
+
+    TEST_F(DownlinkQueueTest, ShouldForwardTransmitterRequests)
+    {
+        EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm9600bps)).WillOnce(Return(true));
+        EXPECT_CALL(transmitter, SetTransmitterStateWhenIdle(IdleState::On)).WillOnce(Return(true));
+        EXPECT_CALL(transmitter, ResetTransmitter()).WillOnce(Return(false));
+
+        ASSERT_THAT(queue.SetTransmitterBitRate(Bitrate::Comm9600bps), Eq(true));
+        ASSERT_THAT(queue.SetTransmitterStateWhenIdle(IdleState::On), Eq(true));
+        ASSERT_THAT(queue.ResetTransmitter(), Eq(false));
+    }
+
+    TEST(DownlinkQueueTelemetryTest, ShouldSaturateDepth)
+    {
+        DownlinkQueueTelemetry telemetry(20, 0, 0);
+
+        ASSERT_THAT(telemetry.Depth(), Eq(3));
+    }
+
+    TEST(DownlinkQueueTelemetryTest, ShouldReportDroppedFramesInLogarithmicScale)
+    {
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 0, 1).BulkDropped(), Eq(1));
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 2, 3).ControlDropped(), Eq(2));
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 2, 3).BulkDropped(), Eq(2));
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 40, 0).ControlDropped(), Eq(6));
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 63, 64).ControlDropped(), Eq(6));
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 63, 64).BulkDropped(), Eq(7));
+        ASSERT_THAT(DownlinkQueueTelemetry(0, 100000, 0).ControlDropped(), Eq(7));
+    }
+
+    TEST(DownlinkQueueTelemetryTest, TestSerialization)
+    {
+        DownlinkQueueTelemetry telemetry(3, 1, 2);
+
+        std::array<std::uint8_t, 1> buffer;
+        BitWriter writer(buffer);
+        telemetry.Write(writer);
+
+        ASSERT_THAT(writer.Status(), Eq(true));
+        ASSERT_THAT(writer.GetBitDataLength(), Eq(DownlinkQueueTelemetry::BitSize()));
+        ASSERT_THAT(buffer, ElementsAre(0x47));
+    }
+
+    TEST(QueuedResponseFrameHandlerTest, ShouldPassDownlinkToDecoratedHandler)
+    {
+        FrameHandlerMock handler;
+        TransmitterMock downlink;
+        TransmitterMock transmitter;
+        QueuedResponseFrameHandler queued(handler, downlink);
+
+        Frame frame;
+        EXPECT_CALL(handler, HandleFrame(Ref(downlink), Ref(frame)));
+
+        queued.HandleFrame(transmitter, frame);
+    }
+}
@@ -0,0 +1,78 @@
+#include <chrono>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "comm/ReceivePolling.hpp"
+
+using testing::Eq;
+using testing::ElementsAre;
+using devices::comm::AdaptiveReceivePolling;
+using namespace std::chrono_literals;
+
+namespace
+{
+    class ReceivePollingTest : public testing::Test
+    {
+      protected:
+        AdaptiveReceivePolling polling;
+    };
+
+    TEST_F(ReceivePollingTest, ShouldStartWithFastPolling)
+    {
+        ASSERT_THAT(polling.Interval(), Eq(AdaptiveReceivePolling::FastInterval));
+    }
+
+    TEST_F(ReceivePollingTest, ShouldBackOffExponentiallyWhenIdle)
+    {
+        polling.Update(1000ms, 0);
+        ASSERT_THAT(polling.Interval(), Eq(100ms));
+
+        polling.Update(1100ms, 0);
+        ASSERT_THAT(polling.Interval(), Eq(200ms));
+
+        for (auto i = 0; i < 10; i++)
+        {
+            polling.Update(2000ms + i * 2000ms, 0);
+        }
+
+        ASSERT_THAT(polling.Interval(), Eq(AdaptiveReceivePolling::MaxInterval));
+    }
+
+    TEST_F(ReceivePollingTest, ShouldPollFrequentlyDuringPass)
+    {
+        for (auto i = 0; i < 5; i++)
+        {
+            polling.Update(1000ms + i * 2000ms, 0);
+        }
+
+        polling.Update(20s, 1);
+        ASSERT_THAT(polling.Interval(), Eq(AdaptiveReceivePolling::FastInterval));
+
+        polling.Update(20s + AdaptiveReceivePolling::PassWindow - 1ms, 0);
+        ASSERT_THAT(polling.Interval(), Eq(AdaptiveReceivePolling::FastInterval));
+
+        polling.Update(20s + AdaptiveReceivePolling::PassWindow, 0);
+        ASSERT_THAT(polling.Interval(), Eq(2 * AdaptiveReceivePolling::FastInterval));
+    }
+
+    TEST_F(ReceivePollingTest, ShouldRecordLatencySincePreviousQuery)
+    {
+        polling.Update(10s, 0);
+
+        polling.Update(10s + 40ms, 2);
+        polling.Update(10s + 140ms, 1);
+        polling.Update(10s + 1140ms, 1);
+        polling.Update(20s, 3);
+
+        const auto statistics = polling.Statistics();
+        ASSERT_THAT(statistics.Interval, Eq(AdaptiveReceivePolling::FastInterval));
+        ASSERT_THAT(statistics.Latency, ElementsAre(2, 1, 0, 0, 1, 0, 3));
+    }
+
+    TEST_F(ReceivePollingTest, ShouldSaturateLatencyCounters)
+    {
+        polling.Update(0ms, 0xFFFF);
+        polling.Update(0ms, 10);
+
+        ASSERT_THAT(polling.Statistics().Latency[0], Eq(0xFFFF));
+    }
+}
@@ -241,21 +241,60 @@ TEST_F(RedundantN25QDriverTest, ShouldWriteMultiPageMemory)
     {
         auto pageBuffer = span<const uint8_t>(buffer).subspan(i * pageSize, pageSize);
 
-        EXPECT_CALL(_n25qDriver[0], BeginWritePage(address, i * pageSize, pageBuffer))
-            .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[0]))));
-        EXPECT_CALL(_n25qDriver[1], BeginWritePage(address, i * pageSize, pageBuffer))
-            .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[1]))));
-        EXPECT_CALL(_n25qDriver[2], BeginWritePage(address, i * pageSize, pageBuffer))
-            .WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[2]))));
-
-        ExpectAllWaiters();
+        for (auto& chip : _n25qDriver)
+        {
+            if (i > 0)
+            {
+                EXPECT_CALL(chip, WaitForOperation(1ms, FlagStatus::EraseError));
+            }
+
+            EXPECT_CALL(chip, BeginWritePage(address, i * pageSize, pageBuffer)).WillOnce(Return(ByMove(MakeWaiter(&chip))));
+        }
     }
 
-    _driver.WriteMemory(address, buffer);
+    ExpectAllWaiters();
 
+    auto result = _driver.WriteMemory(address, buffer);
+
+    ASSERT_THAT(result, Eq(OperationResult::Success));
     ASSERT_THAT(_error_counter, Eq(0));
 }
 
+TEST_F(RedundantN25QDriverTest, ShouldAbortMultiPageWriteWhenMajorityOfChipsFails)
+{
+    constexpr size_t pageSize = 256;
+    constexpr uint8_t pageCount = 3;
+
+    array<uint8_t, pageSize * pageCount> buffer;
+    buffer.fill(0xCC);
+
+    size_t address = 0x0F;
+
+    // pages already started are still waited for
+    ExpectAllWaiters();
+
+    {
+        InSequence s;
+
+        for (auto& chip : _n25qDriver)
+        {
+            EXPECT_CALL(chip, BeginWritePage(address, 0, _)).WillOnce(Return(ByMove(MakeWaiter(&chip))));
+        }
+
+        EXPECT_CALL(_n25qDriver[0], WaitForOperation(_, _)).WillOnce(Return(OperationResult::Failure)).RetiresOnSaturation();
+        EXPECT_CALL(_n25qDriver[0], BeginWritePage(address, pageSize, _)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[0]))));
+        EXPECT_CALL(_n25qDriver[1], WaitForOperation(_, _)).WillOnce(Return(OperationResult::Failure)).RetiresOnSaturation();
+        EXPECT_CALL(_n25qDriver[1], BeginWritePage(address, pageSize, _)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[1]))));
+        EXPECT_CALL(_n25qDriver[2], WaitForOperation(_, _)).WillOnce(Return(OperationResult::Success)).RetiresOnSaturation();
+        EXPECT_CALL(_n25qDriver[2], BeginWritePage(address, pageSize, _)).WillOnce(Return(ByMove(MakeWaiter(&_n25qDriver[2]))));
+    }
+
+    auto result = _driver.WriteMemory(address, buffer);
+
+    ASSERT_THAT(result, Eq(OperationResult::Failure));
+    ASSERT_THAT(_error_counter, Eq(5));
+}
+
 TEST_F(RedundantN25QDriverTest, ShouldPropagateReadMemoryTimeout)
 {
     array<uint8_t, 256> buffer1;
@@ -275,3 +314,168 @@ TEST_F(RedundantN25QDriverTest, ShouldPropagateReadMemoryTimeout)
     auto r = _driver.ReadMemory(address, buffer1, buffer2, buffer3);
     ASSERT_THAT(r, Eq(OSResult::Timeout));
 }
+
+static array<uint8_t, 256> MakeChunk(uint8_t fill)
+{
+    array<uint8_t, 256> chunk;
+    chunk.fill(fill);
+    RedundantN25QDriver::AppendChecksum(chunk);
+    return chunk;
+}
+
+static auto FillBufferWith(const array<uint8_t, 256>& contents)
+{
+    return [contents](std::size_t /*address*/, span<uint8_t> buffer) {
+        std::copy(contents.begin(), contents.end(), buffer.begin());
+        return OSResult::Success;
+    };
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldVerifyChecksum)
+{
+    auto chunk = MakeChunk(0xCC);
+    ASSERT_TRUE(RedundantN25QDriver::VerifyChecksum(chunk));
+
+    chunk[10] = 0xC8;
+    ASSERT_FALSE(RedundantN25QDriver::VerifyChecksum(chunk));
+
+    chunk.fill(0xFF);
+    ASSERT_TRUE(RedundantN25QDriver::VerifyChecksum(chunk));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldReadOnlyFirstChipIfChecksumMatches)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    auto chunk = MakeChunk(0xCC);
+
+    size_t address = 0x0F;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(Invoke(FillBufferWith(chunk)));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(_, _)).Times(0);
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadMemoryWithChecksum(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(buffer1, Eq(chunk));
+    ASSERT_THAT(_error_counter, Eq(0));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldReadOnlyFirstChipIfChunkIsErased)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    array<uint8_t, 256> erased;
+    erased.fill(0xFF);
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(0x0F, span<uint8_t>(buffer1))).WillOnce(Invoke(FillBufferWith(erased)));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(_, _)).Times(0);
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    _driver.ReadMemoryWithChecksum(0x0F, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(buffer1, Eq(erased));
+    ASSERT_THAT(_error_counter, Eq(0));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldUseSecondChipIfFirstIsCorrupted)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    auto chunk = MakeChunk(0xCC);
+    auto corrupted = chunk;
+    corrupted[3] = 0x00;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(Invoke(FillBufferWith(corrupted)));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, span<uint8_t>(buffer2))).WillOnce(Invoke(FillBufferWith(chunk)));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadMemoryWithChecksum(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(buffer1, Eq(chunk));
+    ASSERT_THAT(_error_counter, Eq(5));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldUseThirdChipIfFirstTwoAreCorrupted)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    auto chunk = MakeChunk(0xCC);
+    auto corrupted1 = chunk;
+    corrupted1[3] = 0x00;
+    auto corrupted2 = chunk;
+    corrupted2[200] = 0x00;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(Invoke(FillBufferWith(corrupted1)));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, span<uint8_t>(buffer2))).WillOnce(Invoke(FillBufferWith(corrupted2)));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(address, span<uint8_t>(buffer3))).WillOnce(Invoke(FillBufferWith(chunk)));
+
+    _driver.ReadMemoryWithChecksum(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(buffer1, Eq(chunk));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldVoteIfAllChipsAreCorrupted)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    auto chunk = MakeChunk(0xCC);
+    auto corrupted1 = chunk;
+    corrupted1[3] = 0x00;
+    auto corrupted2 = chunk;
+    corrupted2[200] = 0x00;
+    auto corrupted3 = chunk;
+    corrupted3[100] = 0x00;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, _)).WillOnce(Invoke(FillBufferWith(corrupted1)));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, _)).WillOnce(Invoke(FillBufferWith(corrupted2)));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(address, _)).WillOnce(Invoke(FillBufferWith(corrupted3)));
+
+    auto r = _driver.ReadMemoryWithChecksum(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::InvalidMessage));
+    ASSERT_THAT(buffer1, Eq(chunk));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldPropagateReadMemoryWithChecksumTimeout)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    auto corrupted = MakeChunk(0xCC);
+    corrupted[3] = 0x00;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(0x0F, _)).WillOnce(Invoke(FillBufferWith(corrupted)));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(0x0F, _)).WillOnce(Return(OSResult::Timeout));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadMemoryWithChecksum(0x0F, buffer1, buffer2, buffer3);
+    ASSERT_THAT(r, Eq(OSResult::Timeout));
+}
@@ -24,6 +24,7 @@ namespace
         testing::NiceMock<HasStateMock<telemetry::TelemetryState>> _telemetryState;
 
         telemetry::TelemetryState _telemetry;
+        telemetry::TelemetryState _unpublished;
 
         beacon::BeaconSender _sender{_transmitter, _telemetryState};
     };
@@ -31,6 +32,7 @@ namespace
     BeaconSenderTest::BeaconSenderTest()
     {
         ON_CALL(_telemetryState, MockGetState()).WillByDefault(testing::ReturnRef(_telemetry));
+        _telemetry.serializedTelemetry.Publish(telemetry::SerializedTelemetry());
     }
 
     TEST_F(BeaconSenderTest, ShouldSendBeaconAndWaitLongDelayOnSuccess)
@@ -47,7 +49,7 @@ namespace
         EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Return(true));
         _sender.RunOnce();
 
-        EXPECT_CALL(_os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+        ON_CALL(_telemetryState, MockGetState()).WillByDefault(testing::ReturnRef(_unpublished));
         EXPECT_CALL(_os, Sleep(5000ms));
         EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Return(true));
         _sender.RunOnce();
@@ -55,7 +57,7 @@ namespace
 
     TEST_F(BeaconSenderTest, ShouldNotSendEmptyFrameAndShouldWaitShortDelayOnFailureToGetTelemetry)
     {
-        EXPECT_CALL(_os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+        ON_CALL(_telemetryState, MockGetState()).WillByDefault(testing::ReturnRef(_unpublished));
         EXPECT_CALL(_os, Sleep(5000ms));
         EXPECT_CALL(_transmitter, SendFrame(_)).Times(0);
         _sender.RunOnce();
@@ -0,0 +1,138 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+#include "mission/logic.hpp"
+#include "mission/profile.hpp"
+#include "mock/ActionDescriptorMock.hpp"
+#include "mock/UpdateDescriptorMock.hpp"
+#include "state/struct.h"
+
+using testing::Eq;
+using testing::ElementsAre;
+using testing::Return;
+using testing::_;
+using namespace mission;
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct RecordingProbe
+    {
+        RecordingProbe(std::vector<std::size_t>& indexes) : Indexes(indexes)
+        {
+        }
+
+        int Begin() const
+        {
+            return 0;
+        }
+
+        void End(std::size_t index, int /*token*/) const
+        {
+            Indexes.push_back(index);
+        }
+
+        std::vector<std::size_t>& Indexes;
+    };
+
+    TEST(DescriptorTimingTest, ShouldBeEmptyByDefault)
+    {
+        DescriptorTiming timing;
+
+        ASSERT_THAT(timing.Runs, Eq(0u));
+        ASSERT_THAT(timing.Average(), Eq(0ms));
+        ASSERT_THAT(timing.Overruns, Eq(0));
+    }
+
+    TEST(DescriptorTimingTest, ShouldTrackExecutionTimeStatistics)
+    {
+        DescriptorTiming timing;
+
+        timing.Record(20ms, 100ms);
+        timing.Record(10ms, 100ms);
+        timing.Record(60ms, 100ms);
+
+        ASSERT_THAT(timing.Runs, Eq(3u));
+        ASSERT_THAT(timing.Min, Eq(10ms));
+        ASSERT_THAT(timing.Max, Eq(60ms));
+        ASSERT_THAT(timing.Last, Eq(60ms));
+        ASSERT_THAT(timing.Average(), Eq(30ms));
+        ASSERT_THAT(timing.Overruns, Eq(0));
+    }
+
+    TEST(DescriptorTimingTest, ShouldCountOverruns)
+    {
+        DescriptorTiming timing;
+
+        timing.Record(100ms, 100ms);
+        timing.Record(101ms, 100ms);
+        timing.Record(500ms, 100ms);
+
+        ASSERT_THAT(timing.Overruns, Eq(2));
+    }
+
+    TEST(DescriptorTimingTest, ShouldResetStatistics)
+    {
+        DescriptorTiming timing;
+        timing.Record(500ms, 100ms);
+
+        timing.Reset();
+
+        ASSERT_THAT(timing.Runs, Eq(0u));
+        ASSERT_THAT(timing.Max, Eq(0ms));
+        ASSERT_THAT(timing.Overruns, Eq(0));
+    }
+
+    TEST(MissionLoopProfilerTest, ShouldHaveEntryForEachDescriptorAndIteration)
+    {
+        MissionLoopProfiler<2> profiler;
+        profiler.Assign(0, ProfiledElement::Update, "time");
+        profiler.Assign(1, ProfiledElement::Action, "beacon");
+
+        auto timings = profiler.Timings();
+
+        ASSERT_THAT(timings.size(), Eq(3));
+        ASSERT_THAT(timings[0].Name, Eq(std::string("time")));
+        ASSERT_THAT(timings[1].Kind, Eq(ProfiledElement::Action));
+        ASSERT_THAT(timings[2].Kind, Eq(ProfiledElement::Iteration));
+    }
+
+    TEST(MissionLoopProfilerTest, NullProfilerShouldNotExposeStatistics)
+    {
+        NullMissionLoopProfiler profiler;
+
+        ASSERT_THAT(profiler.Timings().size(), Eq(0));
+    }
+
+    TEST(MissionLoopProfilerTest, ShouldMeasureEachUpdateDescriptor)
+    {
+        SystemState state;
+        UpdateDescriptorMock<SystemState, int> update1, update2;
+        EXPECT_CALL(update1, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+        EXPECT_CALL(update2, UpdateProc(_)).WillOnce(Return(UpdateResult::Ok));
+
+        UpdateDescriptor<SystemState> descriptors[] = {update1.BuildUpdate(), update2.BuildUpdate()};
+
+        std::vector<std::size_t> indexes;
+        SystemStateUpdate(state, gsl::make_span(descriptors), RecordingProbe(indexes));
+
+        ASSERT_THAT(indexes, ElementsAre(0, 1));
+    }
+
+    TEST(MissionLoopProfilerTest, ShouldMeasureExecutedActionsUsingTheirIndex)
+    {
+        SystemState state;
+        ActionDescriptorMock<SystemState, int> action1, action2, action3;
+        EXPECT_CALL(action1, ActionProc(_)).Times(0);
+        EXPECT_CALL(action2, ActionProc(_)).Times(0);
+        EXPECT_CALL(action3, ActionProc(_)).Times(1);
+
+        ActionDescriptor<SystemState> descriptors[] = {action1.BuildAction(), action2.BuildAction(), action3.BuildAction()};
+        ActionDescriptor<SystemState>* runnable[] = {&descriptors[2]};
+
+        std::vector<std::size_t> indexes;
+        SystemDispatchActions(state, gsl::make_span(runnable), descriptors, RecordingProbe(indexes));
+
+        ASSERT_THAT(indexes, ElementsAre(2));
+    }
+}
@@ -132,4 +132,56 @@ namespace
 
         SystemDispatchActions(state, gsl::make_span(runable));
     }
+
+    Option<std::chrono::milliseconds> FixedNextDue(const SystemState& /*state*/, void* param)
+    {
+        return *static_cast<Option<std::chrono::milliseconds>*>(param);
+    }
+
+    ActionDescriptor<SystemState> DueAction(Option<std::chrono::milliseconds>& due)
+    {
+        ActionDescriptor<SystemState> action;
+        action.name = "Due";
+        action.param = &due;
+        action.nextDue = FixedNextDue;
+        return action;
+    }
+
+    TEST_F(MissionPlanTest, ShouldScheduleNextIterationAtEarliestDeadline)
+    {
+        auto first = Some<std::chrono::milliseconds>(40s);
+        auto second = Some<std::chrono::milliseconds>(15s);
+
+        ActionDescriptor<SystemState> actions[] = {DueAction(first), DueAction(second)};
+
+        ASSERT_THAT(SystemDetermineNextIteration(state, gsl::make_span(actions), 10s, 60s), Eq(15s));
+    }
+
+    TEST_F(MissionPlanTest, ShouldUseFallbackPeriodForActionsWithoutDeadline)
+    {
+        auto first = Some<std::chrono::milliseconds>(40s);
+
+        ActionDescriptorMock<SystemState, void> action;
+        ActionDescriptor<SystemState> actions[] = {DueAction(first), action.BuildAction()};
+
+        ASSERT_THAT(SystemDetermineNextIteration(state, gsl::make_span(actions), 10s, 60s), Eq(10s));
+    }
+
+    TEST_F(MissionPlanTest, ShouldUseFallbackPeriodForActionsThatAreAlreadyDue)
+    {
+        auto first = None<std::chrono::milliseconds>();
+
+        ActionDescriptor<SystemState> actions[] = {DueAction(first)};
+
+        ASSERT_THAT(SystemDetermineNextIteration(state, gsl::make_span(actions), 10s, 60s), Eq(10s));
+    }
+
+    TEST_F(MissionPlanTest, ShouldSleepForIdlePeriodWhenNothingIsDue)
+    {
+        auto first = Some<std::chrono::milliseconds>(2min);
+
+        ActionDescriptor<SystemState> actions[] = {DueAction(first)};
+
+        ASSERT_THAT(SystemDetermineNextIteration(state, gsl::make_span(actions), 10s, 60s), Eq(60s));
+    }
 }
@@ -0,0 +1,167 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+#include "mission/logic.hpp"
+#include "mission/parallel.hpp"
+
+using testing::Eq;
+using testing::ElementsAre;
+using namespace mission;
+
+namespace
+{
+    struct TestState
+    {
+        std::vector<int> Executed;
+    };
+
+    struct Step
+    {
+        int Id;
+        UpdateResult Result;
+    };
+
+    UpdateResult Execute(TestState& state, void* param)
+    {
+        auto step = static_cast<Step*>(param);
+        state.Executed.push_back(step->Id);
+        return step->Result;
+    }
+
+    UpdateDescriptor<TestState> Descriptor(Step& step, UpdateResource resource)
+    {
+        UpdateDescriptor<TestState> descriptor;
+        descriptor.name = "Step";
+        descriptor.updateProc = Execute;
+        descriptor.param = &step;
+        descriptor.resource = resource;
+        return descriptor;
+    }
+
+    /**
+     * @brief Worker pool that executes lanes synchronously starting from the last one
+     */
+    struct ReversedLanesPool : public IUpdateWorkerPool
+    {
+        virtual void Run(UpdateLaneJob job, void* context, UpdateLanes lanes) override
+        {
+            Stages.push_back(lanes);
+
+            for (auto lane = UpdateResourceCount - 1; lane > 0; lane--)
+            {
+                const auto resource = static_cast<UpdateResource>(lane);
+                if ((lanes & LaneOf(resource)) != 0)
+                {
+                    job(context, resource);
+                }
+            }
+        }
+
+        std::vector<UpdateLanes> Stages;
+    };
+
+    struct RecordingProbe
+    {
+        RecordingProbe(std::vector<std::size_t>& indexes) : Indexes(indexes)
+        {
+        }
+
+        int Begin() const
+        {
+            return 0;
+        }
+
+        void End(std::size_t index, int /*token*/) const
+        {
+            Indexes.push_back(index);
+        }
+
+        std::vector<std::size_t>& Indexes;
+    };
+
+    class ParallelUpdateTest : public testing::Test
+    {
+      protected:
+        TestState state;
+        ReversedLanesPool pool;
+        Step steps[5] = {
+            {0, UpdateResult::Ok}, {1, UpdateResult::Ok}, {2, UpdateResult::Ok}, {3, UpdateResult::Ok}, {4, UpdateResult::Ok}};
+    };
+
+    TEST_F(ParallelUpdateTest, ShouldRunExclusiveDescriptorsSequentially)
+    {
+        UpdateDescriptor<TestState> descriptors[] = {
+            Descriptor(steps[0], UpdateResource::Exclusive), Descriptor(steps[1], UpdateResource::Exclusive)};
+
+        auto result = SystemStateParallelUpdate(state, gsl::make_span(descriptors), pool);
+
+        ASSERT_THAT(result, Eq(UpdateResult::Ok));
+        ASSERT_THAT(state.Executed, ElementsAre(0, 1));
+        ASSERT_THAT(pool.Stages.size(), Eq(0u));
+    }
+
+    TEST_F(ParallelUpdateTest, ShouldGroupConsecutiveNonExclusiveDescriptorsIntoStages)
+    {
+        UpdateDescriptor<TestState> descriptors[] = {Descriptor(steps[0], UpdateResource::Cpu),
+            Descriptor(steps[1], UpdateResource::SystemBus),
+            Descriptor(steps[2], UpdateResource::Cpu),
+            Descriptor(steps[3], UpdateResource::Exclusive),
+            Descriptor(steps[4], UpdateResource::PayloadBus)};
+
+        auto result = SystemStateParallelUpdate(state, gsl::make_span(descriptors), pool);
+
+        ASSERT_THAT(result, Eq(UpdateResult::Ok));
+        ASSERT_THAT(pool.Stages,
+            ElementsAre(LaneOf(UpdateResource::Cpu) | LaneOf(UpdateResource::SystemBus), LaneOf(UpdateResource::PayloadBus)));
+        ASSERT_THAT(state.Executed, ElementsAre(1, 0, 2, 3, 4));
+    }
+
+    TEST_F(ParallelUpdateTest, ShouldReportWarningFromAnyLane)
+    {
+        steps[1].Result = UpdateResult::Warning;
+
+        UpdateDescriptor<TestState> descriptors[] = {
+            Descriptor(steps[0], UpdateResource::Cpu), Descriptor(steps[1], UpdateResource::Spi)};
+
+        auto result = SystemStateParallelUpdate(state, gsl::make_span(descriptors), pool);
+
+        ASSERT_THAT(result, Eq(UpdateResult::Warning));
+        ASSERT_THAT(state.Executed, ElementsAre(1, 0));
+    }
+
+    TEST_F(ParallelUpdateTest, ShouldStopFailedLaneAndSkipRemainingStages)
+    {
+        steps[0].Result = UpdateResult::Failure;
+
+        UpdateDescriptor<TestState> descriptors[] = {Descriptor(steps[0], UpdateResource::Cpu),
+            Descriptor(steps[1], UpdateResource::Cpu),
+            Descriptor(steps[2], UpdateResource::SystemBus),
+            Descriptor(steps[3], UpdateResource::Exclusive),
+            Descriptor(steps[4], UpdateResource::Cpu)};
+
+        auto result = SystemStateParallelUpdate(state, gsl::make_span(descriptors), pool);
+
+        ASSERT_THAT(result, Eq(UpdateResult::Failure));
+        ASSERT_THAT(state.Executed, ElementsAre(2, 0));
+    }
+
+    TEST_F(ParallelUpdateTest, ShouldMeasureDescriptorsUsingTheirIndex)
+    {
+        UpdateDescriptor<TestState> descriptors[] = {Descriptor(steps[0], UpdateResource::Exclusive),
+            Descriptor(steps[1], UpdateResource::Cpu),
+            Descriptor(steps[2], UpdateResource::PayloadBus)};
+
+        std::vector<std::size_t> indexes;
+        SystemStateParallelUpdate(state, gsl::make_span(descriptors), pool, RecordingProbe(indexes));
+
+        ASSERT_THAT(indexes, ElementsAre(0, 2, 1));
+    }
+
+    TEST(CombineUpdateResultsTest, ShouldSelectMoreSevereResult)
+    {
+        ASSERT_THAT(CombineUpdateResults(UpdateResult::Ok, UpdateResult::Ok), Eq(UpdateResult::Ok));
+        ASSERT_THAT(CombineUpdateResults(UpdateResult::Warning, UpdateResult::Ok), Eq(UpdateResult::Warning));
+        ASSERT_THAT(CombineUpdateResults(UpdateResult::Ok, UpdateResult::Failure), Eq(UpdateResult::Failure));
+        ASSERT_THAT(CombineUpdateResults(UpdateResult::Failure, UpdateResult::Warning), Eq(UpdateResult::Failure));
+    }
+}
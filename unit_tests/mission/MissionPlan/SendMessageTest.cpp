@@ -79,4 +79,25 @@ namespace
 
         ASSERT_THAT(_action.EvaluateCondition(_state), Eq(true));
     }
+
+    TEST_F(SendMessageTest, ShouldReportTimeRemainingToNextMessage)
+    {
+        _state.Time = 45min;
+        _state.AntennaState.SetDeployment(true);
+
+        ASSERT_THAT(_action.NextDue(_state).HasValue, Eq(false));
+
+        EXPECT_CALL(_transmitter, SendFrame(_)).Times(3);
+        _action.Execute(_state);
+
+        _state.Time += 2min;
+
+        auto due = _action.NextDue(_state);
+        ASSERT_THAT(due.HasValue, Eq(true));
+        ASSERT_THAT(due.Value, Eq(std::chrono::milliseconds(3min)));
+
+        _state.Time += 5min;
+
+        ASSERT_THAT(_action.NextDue(_state).HasValue, Eq(false));
+    }
 }
@@ -1,14 +1,20 @@
 #include <chrono>
+#include <vector>
 #include "gtest/gtest.h"
 #include "gmock/gmock-matchers.h"
 #include "OsMock.hpp"
+#include "base/BitWriter.hpp"
+#include "base/writer.h"
 #include "mission/telemetry.hpp"
 #include "mock/FsMock.hpp"
 #include "telemetry/TimeTelemetry.hpp"
 
 namespace
 {
+    using testing::ElementsAre;
     using testing::Eq;
+    using testing::Invoke;
+    using testing::StrEq;
     using testing::_;
     using testing::Return;
     using testing::SizeIs;
@@ -37,11 +43,13 @@ namespace
     };
 
     TelemetryTest::TelemetryTest()
-        : osReset(InstallProxy(&os)),                 //
-          config{"/current", "/previous", 1024, 30s}, //
+        : osReset(InstallProxy(&os)),                                             //
+          config{"/current", "/previous", 1024, 30s, 2048, 0ms, nullptr, nullptr, 0}, //
           task(std::tie(fs, config))
     {
+        task.Initialize();
         this->descriptor = task.BuildAction();
+        this->state.serializedTelemetry.Publish(telemetry::SerializedTelemetry());
     }
 
     inline FileOpenResult TelemetryTest::OpenSuccessful(int handle)
@@ -103,8 +111,6 @@ namespace
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
         EXPECT_CALL(fs, Close(10));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
-        EXPECT_CALL(os, GiveSemaphore(_)).WillOnce(Return(OSResult::Success));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
     }
@@ -121,19 +127,19 @@ namespace
 
     TEST_F(TelemetryTest, TestConditionAfterFailedTelemetryAccessAcquisition)
     {
-        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
+        telemetry::TelemetryState unpublished;
+        unpublished.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
 
-        ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Deadlock));
-        this->descriptor.Execute(this->state);
+        ASSERT_THAT(this->descriptor.EvaluateCondition(unpublished), Eq(true));
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+        this->descriptor.Execute(unpublished);
 
-        ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
+        ASSERT_THAT(this->descriptor.EvaluateCondition(unpublished), Eq(true));
     }
 
     TEST_F(TelemetryTest, TestSaveChangeSlightlyBelowLimit)
     {
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1023));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
@@ -143,7 +149,6 @@ namespace
     TEST_F(TelemetryTest, TestSaveChangeFileOpenFailure)
     {
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(FileOpenResult(OSResult::IOError, 0)));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
@@ -151,7 +156,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveWriteFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
@@ -160,7 +164,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitSuccess)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillRepeatedly(Return(OpenSuccessful(10)));
         EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).Times(2).WillOnce(Return(1024));
@@ -172,7 +175,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitArchivizerFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillRepeatedly(Return(OpenSuccessful(10)));
         EXPECT_CALL(fs, Write(10, _)).Times(0);
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1024));
@@ -183,7 +185,6 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitFileReopenFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10))).WillOnce(Return(FileOpenResult(OSResult::IOError, 0)));
         EXPECT_CALL(fs, Write(10, _)).Times(0);
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1024));
@@ -191,4 +192,403 @@ namespace
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
     }
+
+    class BufferedTelemetryTest : public TelemetryTest
+    {
+      protected:
+        BufferedTelemetryTest();
+
+        void SaveAt(std::chrono::milliseconds time);
+
+        mission::TelemetryConfiguration bufferedConfig;
+        mission::TelemetryTask bufferedTask;
+    };
+
+    BufferedTelemetryTest::BufferedTelemetryTest()
+        : bufferedConfig{"/current", "/previous", 1_MB, 30s, 3 * mission::TelemetryTask::AlignFileEntriesTo, 5min, nullptr, nullptr, 0}, //
+          bufferedTask(std::tie(fs, bufferedConfig))
+    {
+        bufferedTask.Initialize();
+        ON_CALL(fs, Open(_, _, _)).WillByDefault(Return(OpenSuccessful(10)));
+        ON_CALL(fs, GetFileSize(10)).WillByDefault(Return(0));
+    }
+
+    void BufferedTelemetryTest::SaveAt(std::chrono::milliseconds time)
+    {
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(time));
+        bufferedTask.Save(state);
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldWriteEntriesOnceTheyFillFlushSize)
+    {
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+        SaveAt(10min);
+        SaveAt(10min + 30s);
+
+        EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, Write(10, SizeIs(3 * mission::TelemetryTask::AlignFileEntriesTo))).WillOnce(Return(WriteSuccessful()));
+        SaveAt(10min + 60s);
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldWriteEntriesOnceFlushDelayPasses)
+    {
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+        SaveAt(10min);
+
+        EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, Write(10, SizeIs(2 * mission::TelemetryTask::AlignFileEntriesTo))).WillOnce(Return(WriteSuccessful()));
+        SaveAt(15min);
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldUpdateSaveConditionWhenEntryIsBuffered)
+    {
+        auto descriptor = bufferedTask.BuildAction();
+        SaveAt(10min);
+
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(10min + 5s));
+        ASSERT_THAT(descriptor.EvaluateCondition(state), Eq(false));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldWriteBufferedEntriesBeforePowerCycle)
+    {
+        SaveAt(10min);
+
+        EXPECT_CALL(fs, Write(10, SizeIs(mission::TelemetryTask::AlignFileEntriesTo))).WillOnce(Return(WriteSuccessful()));
+        bufferedTask.BeforePowerCycle();
+
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+        ASSERT_THAT(bufferedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldKeepEntriesWhenWriteFails)
+    {
+        SaveAt(10min);
+
+        EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
+        ASSERT_THAT(bufferedTask.Flush(), Eq(false));
+
+        EXPECT_CALL(fs, Write(10, SizeIs(mission::TelemetryTask::AlignFileEntriesTo))).WillOnce(Return(WriteSuccessful()));
+        ASSERT_THAT(bufferedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldWriteWrappedBufferInTwoParts)
+    {
+        constexpr auto EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        EXPECT_CALL(fs, Write(10, _)).WillRepeatedly(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
+        for (auto i = 0; i < mission::TelemetryTask::MaxBufferedEntries + 2; i++)
+        {
+            SaveAt(10min + i * 1s);
+        }
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        {
+            testing::InSequence s;
+            EXPECT_CALL(fs, Write(10, SizeIs((mission::TelemetryTask::MaxBufferedEntries - 2) * EntrySize))).WillOnce(Return(WriteSuccessful()));
+            EXPECT_CALL(fs, Write(10, SizeIs(2 * EntrySize))).WillOnce(Return(WriteSuccessful()));
+        }
+
+        ASSERT_THAT(bufferedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldNotWriteAgainEntriesWrittenBeforeFailure)
+    {
+        constexpr auto EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        EXPECT_CALL(fs, Write(10, _)).WillRepeatedly(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
+        for (auto i = 0; i < mission::TelemetryTask::MaxBufferedEntries + 2; i++)
+        {
+            SaveAt(10min + i * 1s);
+        }
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        {
+            testing::InSequence s;
+            EXPECT_CALL(fs, Write(10, SizeIs((mission::TelemetryTask::MaxBufferedEntries - 2) * EntrySize))).WillOnce(Return(WriteSuccessful()));
+            EXPECT_CALL(fs, Write(10, SizeIs(2 * EntrySize))).WillOnce(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
+            EXPECT_CALL(fs, Write(10, SizeIs(2 * EntrySize))).WillOnce(Return(WriteSuccessful()));
+        }
+
+        ASSERT_THAT(bufferedTask.Flush(), Eq(false));
+        ASSERT_THAT(bufferedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldWriteEntriesUpToChunkBoundary)
+    {
+        constexpr auto EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        bufferedConfig.flushSize = 512;
+        mission::TelemetryTask chunkedTask(std::tie(fs, bufferedConfig));
+        chunkedTask.Initialize();
+
+        EXPECT_CALL(fs, Write(10, _)).Times(0);
+        for (auto time : {600s, 630s})
+        {
+            state.telemetry.Set(telemetry::InternalTimeTelemetry(time));
+            chunkedTask.Save(state);
+        }
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
+        EXPECT_CALL(fs, Seek(10, services::fs::SeekOrigin::Begin, 0)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(fs, Write(10, SizeIs(512))).WillOnce(Return(WriteSuccessful()));
+        state.telemetry.Set(telemetry::InternalTimeTelemetry(660s));
+        chunkedTask.Save(state);
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(512));
+        EXPECT_CALL(fs, TruncateFile(_, _)).Times(0);
+        EXPECT_CALL(fs, Seek(10, services::fs::SeekOrigin::Begin, 512)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(fs, Write(10, SizeIs(3 * EntrySize - 512))).WillOnce(Return(WriteSuccessful()));
+        ASSERT_THAT(chunkedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldDropPartialEntryLeftByInterruptedWrite)
+    {
+        constexpr auto EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        SaveAt(10min);
+
+        // previous chunked write ended in the middle of the entry and then the rest of it was lost on reset
+        {
+            testing::InSequence s;
+            EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(2 * EntrySize + 100));
+            EXPECT_CALL(fs, TruncateFile(10, 2 * EntrySize)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(fs, Seek(10, services::fs::SeekOrigin::Begin, 2 * EntrySize)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(fs, Write(10, SizeIs(EntrySize))).WillOnce(Return(WriteSuccessful()));
+        }
+
+        ASSERT_THAT(bufferedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldSkipPartialEntryThatCannotBeDropped)
+    {
+        constexpr auto EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        SaveAt(10min);
+
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(2 * EntrySize + 100));
+        EXPECT_CALL(fs, TruncateFile(10, 2 * EntrySize)).WillOnce(Return(OSResult::IOError));
+        EXPECT_CALL(fs, Seek(10, services::fs::SeekOrigin::Begin, 3 * EntrySize)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(fs, Write(10, SizeIs(EntrySize))).WillOnce(Return(WriteSuccessful()));
+
+        ASSERT_THAT(bufferedTask.Flush(), Eq(true));
+    }
+
+    TEST_F(BufferedTelemetryTest, ShouldIndexEveryNthWrittenEntry)
+    {
+        constexpr auto EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        bufferedConfig.currentIndexFileName = "/current.idx";
+        bufferedConfig.previousIndexFileName = "/previous.idx";
+        bufferedConfig.indexInterval = 2;
+        mission::TelemetryTask indexedTask(std::tie(fs, bufferedConfig));
+        indexedTask.Initialize();
+
+        std::vector<std::uint8_t> index;
+        EXPECT_CALL(fs, Open(StrEq("/current"), _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, Open(StrEq("/current.idx"), _, _)).WillOnce(Return(OpenSuccessful(20)));
+        EXPECT_CALL(fs, Write(10, SizeIs(3 * EntrySize))).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, Write(20, _)).WillOnce(Invoke([&index](services::fs::FileHandle, gsl::span<const std::uint8_t> buffer) {
+            index.assign(buffer.begin(), buffer.end());
+            return IOResult(OSResult::Success, buffer);
+        }));
+
+        for (auto time : {600s, 630s, 660s})
+        {
+            state.telemetry.Set(telemetry::InternalTimeTelemetry(time));
+
+            telemetry::SerializedTelemetry serialized;
+            BitWriter serializer(serialized);
+            state.telemetry.Write(serializer);
+            state.serializedTelemetry.Publish(serialized);
+
+            indexedTask.Save(state);
+        }
+
+        std::array<std::uint8_t, 2 * mission::TelemetryTask::IndexEntrySize> expected;
+        Writer writer(expected);
+        writer.WriteQuadWordLE(std::chrono::milliseconds(10min).count());
+        writer.WriteDoubleWordLE(0);
+        writer.WriteQuadWordLE(std::chrono::milliseconds(10min + 60s).count());
+        writer.WriteDoubleWordLE(2 * EntrySize);
+
+        ASSERT_THAT(index, testing::ElementsAreArray(expected));
+    }
+
+    class TelemetryArchiveTest : public TelemetryTest, public mission::ITelemetryEntryReceiver
+    {
+      protected:
+        TelemetryArchiveTest();
+
+        virtual bool Receive(std::chrono::milliseconds time, gsl::span<const std::uint8_t> entry) override;
+
+        static void PutEntry(gsl::span<std::uint8_t> file, std::size_t index, std::chrono::milliseconds time);
+
+        static void PutIndexEntry(gsl::span<std::uint8_t> file, std::size_t index, std::chrono::milliseconds time, std::uint32_t offset);
+
+        static constexpr std::size_t EntrySize = mission::TelemetryTask::AlignFileEntriesTo;
+
+        mission::TelemetryConfiguration archiveConfig;
+        mission::TelemetryTask archive;
+
+        std::array<std::uint8_t, 6 * EntrySize> current;
+        std::array<std::uint8_t, 4 * EntrySize> previous;
+        std::array<std::uint8_t, 2 * mission::TelemetryTask::IndexEntrySize> currentIndex;
+
+        std::vector<std::chrono::milliseconds> received;
+        std::size_t maxEntries;
+        bool bufferLocked;
+        bool receivedWhileLocked;
+    };
+
+    constexpr std::size_t TelemetryArchiveTest::EntrySize;
+
+    TelemetryArchiveTest::TelemetryArchiveTest()
+        : archiveConfig{"/current", "/previous", 1_MB, 30s, 2048, 0ms, "/current.idx", "/previous.idx", 4}, //
+          archive(std::tie(fs, archiveConfig)),
+          maxEntries(100),
+          bufferLocked(false),
+          receivedWhileLocked(false)
+    {
+        archive.Initialize();
+        current.fill(0);
+        previous.fill(0);
+        currentIndex.fill(0);
+
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            PutEntry(previous, i, std::chrono::minutes(i));
+        }
+
+        for (std::size_t i = 0; i < 6; i++)
+        {
+            PutEntry(current, i, std::chrono::minutes(4 + i));
+        }
+
+        fs.AddFile("/current", current);
+    }
+
+    bool TelemetryArchiveTest::Receive(std::chrono::milliseconds time, gsl::span<const std::uint8_t> entry)
+    {
+        EXPECT_THAT(mission::TelemetryTask::EntryTime(entry), Eq(time));
+        received.push_back(time);
+        receivedWhileLocked |= bufferLocked;
+        return received.size() < maxEntries;
+    }
+
+    void TelemetryArchiveTest::PutEntry(gsl::span<std::uint8_t> file, std::size_t index, std::chrono::milliseconds time)
+    {
+        telemetry::ManagedTelemetry telemetry;
+        telemetry.Set(telemetry::InternalTimeTelemetry(time));
+
+        BitWriter writer(file.subspan(index * EntrySize, telemetry::ManagedTelemetry::TotalSerializedSize));
+        telemetry.Write(writer);
+    }
+
+    void TelemetryArchiveTest::PutIndexEntry(gsl::span<std::uint8_t> file, std::size_t index, std::chrono::milliseconds time, std::uint32_t offset)
+    {
+        Writer writer(file.subspan(index * mission::TelemetryTask::IndexEntrySize, mission::TelemetryTask::IndexEntrySize));
+        writer.WriteQuadWordLE(time.count());
+        writer.WriteDoubleWordLE(offset);
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldReturnEntriesWithinTimeWindow)
+    {
+        ASSERT_THAT(archive.Query(5min, 7min, *this), Eq(true));
+        ASSERT_THAT(received, ElementsAre(5min, 6min, 7min));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldReturnEntriesFromPreviousFileFirst)
+    {
+        fs.AddFile("/previous", previous);
+
+        ASSERT_THAT(archive.Query(2min, 5min, *this), Eq(true));
+        ASSERT_THAT(received, ElementsAre(2min, 3min, 4min, 5min));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldStopWhenReceiverRequestsIt)
+    {
+        maxEntries = 2;
+
+        ASSERT_THAT(archive.Query(0min, 100min, *this), Eq(true));
+        ASSERT_THAT(received, ElementsAre(4min, 5min));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldSkipEntriesBeforeIndexedEntry)
+    {
+        // entries before indexed one are never read, therefore their time does not matter
+        PutEntry(current, 0, 8min);
+        PutIndexEntry(currentIndex, 0, 4min, 0);
+        PutIndexEntry(currentIndex, 1, 7min, 3 * EntrySize);
+        fs.AddFile("/current.idx", currentIndex);
+
+        ASSERT_THAT(archive.Query(8min, 9min, *this), Eq(true));
+        ASSERT_THAT(received, ElementsAre(8min, 9min));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldIgnoreIndexThatDoesNotMatchFile)
+    {
+        PutIndexEntry(currentIndex, 0, 5min, 3 * EntrySize);
+        fs.AddFile("/current.idx", currentIndex);
+
+        ASSERT_THAT(archive.Query(5min, 6min, *this), Eq(true));
+        ASSERT_THAT(received, ElementsAre(5min, 6min));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldNotReadArchiveWithoutBufferLock)
+    {
+        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+
+        ASSERT_THAT(archive.Query(0min, 100min, *this), Eq(false));
+        ASSERT_THAT(received.empty(), Eq(true));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldReleaseBufferLockWhileReceiverHandlesEntry)
+    {
+        fs.AddFile("/previous", previous);
+
+        ON_CALL(os, TakeSemaphore(_, _)).WillByDefault(Invoke([this](OSSemaphoreHandle, std::chrono::milliseconds) {
+            bufferLocked = true;
+            return OSResult::Success;
+        }));
+        ON_CALL(os, GiveSemaphore(_)).WillByDefault(Invoke([this](OSSemaphoreHandle) {
+            bufferLocked = false;
+            return OSResult::Success;
+        }));
+
+        ASSERT_THAT(archive.Query(0min, 100min, *this), Eq(true));
+        ASSERT_THAT(received, SizeIs(10));
+        ASSERT_THAT(receivedWhileLocked, Eq(false));
+        ASSERT_THAT(bufferLocked, Eq(false));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldStopWhenBufferLockIsNotAvailableWhileReading)
+    {
+        // flush, opening missing previous file, opening current file and reading its first entry
+        EXPECT_CALL(os, TakeSemaphore(_, _))
+            .WillOnce(Return(OSResult::Success))
+            .WillOnce(Return(OSResult::Success))
+            .WillOnce(Return(OSResult::Success))
+            .WillOnce(Return(OSResult::Success))
+            .WillRepeatedly(Return(OSResult::Timeout));
+
+        ASSERT_THAT(archive.Query(0min, 100min, *this), Eq(true));
+        ASSERT_THAT(received, ElementsAre(4min));
+    }
+
+    TEST_F(TelemetryArchiveTest, ShouldReportMissingArchive)
+    {
+        mission::TelemetryConfiguration missing{"/missing", "/missing.previous", 1_MB, 30s, 2048, 0ms, nullptr, nullptr, 0};
+        mission::TelemetryTask task(std::tie(fs, missing));
+        task.Initialize();
+
+        ASSERT_THAT(task.Query(0min, 100min, *this), Eq(false));
+        ASSERT_THAT(received.empty(), Eq(true));
+    }
 }
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <array>
 #include "gtest/gtest.h"
 #include "gmock/gmock-matchers.h"
 #include "fs/yaffs.h"
@@ -13,6 +14,8 @@ using testing::StrEq;
 using testing::Eq;
 using testing::Ne;
 using testing::Ge;
+using testing::Le;
+using testing::Lt;
 using testing::Test;
 using namespace services::fs;
 
@@ -437,4 +440,84 @@ namespace
 
         yaffs_unmount("/");
     }
+
+    TEST_F(FileSystemTest, ShouldCountOpenHandles)
+    {
+        yaffs_mount("/");
+
+        auto file1 = api.Open("/file1", FileOpen::CreateAlways, FileAccess::WriteOnly);
+        auto file2 = api.Open("/file2", FileOpen::CreateAlways, FileAccess::WriteOnly);
+        api.Open("/missing", FileOpen::Existing, FileAccess::ReadOnly);
+
+        ASSERT_THAT(api.GetStatistics().OpenHandles, Eq(2u));
+
+        api.Close(file1.Result);
+
+        ASSERT_THAT(api.GetStatistics().OpenHandles, Eq(1u));
+
+        api.Close(file2.Result);
+
+        ASSERT_THAT(api.GetStatistics().OpenHandles, Eq(0u));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldUpdateStatisticsWhenFileIsClosed)
+    {
+        yaffs_mount("/");
+
+        auto file = api.Open("/file", FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        auto before = api.GetStatistics();
+        ASSERT_THAT(before.FreeBytes, Eq(static_cast<std::uint32_t>(yaffs_freespace("/"))));
+
+        std::array<std::uint8_t, 10240> buffer;
+        buffer.fill(0x5A);
+        api.Write(file.Result, buffer);
+
+        ASSERT_THAT(api.GetStatistics().FreeBytes, Eq(before.FreeBytes));
+
+        api.Close(file.Result);
+
+        auto after = api.GetStatistics();
+        ASSERT_THAT(after.FreeBytes, Eq(static_cast<std::uint32_t>(yaffs_freespace("/"))));
+        ASSERT_THAT(after.FreeBytes, Lt(before.FreeBytes));
+        ASSERT_THAT(after.ErasedBlocks, Le(before.ErasedBlocks));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldSumDirectoryUsage)
+    {
+        yaffs_mount("/");
+
+        std::array<std::uint8_t, 100> buffer;
+        buffer.fill(0x5A);
+
+        api.MakeDirectory("/a/b");
+        SaveToFile(api, "/a/file1", buffer);
+        SaveToFile(api, "/a/b/file2", gsl::make_span(buffer).subspan(0, 50));
+        SaveToFile(api, "/file3", buffer);
+
+        auto usage = api.GetDirectoryUsage("/a");
+
+        ASSERT_THAT(usage.Status, Eq(OSResult::Success));
+        ASSERT_THAT(usage.Result.Files, Eq(2u));
+        ASSERT_THAT(usage.Result.Directories, Eq(1u));
+        ASSERT_THAT(usage.Result.Size, Eq(150u));
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldNotSumUsageOfFileOrMissingDirectory)
+    {
+        yaffs_mount("/");
+
+        yaffs_close(yaffs_open("/file", O_CREAT | O_WRONLY, S_IRWXU));
+
+        ASSERT_THAT(api.GetDirectoryUsage("/file").Status, Eq(OSResult::NotADirectory));
+        ASSERT_THAT(api.GetDirectoryUsage("/missing").Status, Eq(OSResult::NotFound));
+
+        yaffs_unmount("/");
+    }
 }
@@ -1,3 +1,4 @@
+#include <array>
 #include <algorithm>
 #include <cstring>
 #include <limits>
@@ -682,4 +683,56 @@ namespace
         ASSERT_THAT(writer.GetBitDataLength(), Eq(32u));
         CheckBuffer(writer.Capture(), gsl::make_span(expected));
     }
+
+    TEST(BitWriterTest, TestLongSequenceMatchesBitByBitEncoding)
+    {
+        std::array<std::uint8_t, 64> buffer;
+        std::array<std::uint8_t, 64> expected;
+        buffer.fill(0xA5);
+        expected.fill(0xA5);
+
+        BitWriter writer(buffer);
+        std::uint32_t position = 0;
+        std::uint32_t value = 0x9E3779B9;
+        const std::uint8_t lengths[] = {1, 3, 16, 7, 32, 12, 0, 22, 5, 31, 8, 2, 17, 29, 9, 4, 32, 1, 13, 26, 11, 6, 15, 32};
+
+        for (auto length : lengths)
+        {
+            value = value * 1664525 + 1013904223;
+            ASSERT_TRUE(writer.WriteDoubleWord(value, length));
+
+            for (std::uint32_t i = 0; i < length; ++i, ++position)
+            {
+                const std::uint8_t bit = 1 << (position % 8);
+                if ((value >> i) & 1)
+                {
+                    expected[position / 8] |= bit;
+                }
+                else
+                {
+                    expected[position / 8] &= ~bit;
+                }
+            }
+        }
+
+        if ((position % 8) != 0)
+        {
+            expected[position / 8] &= (1 << (position % 8)) - 1;
+        }
+
+        ASSERT_THAT(writer.GetBitDataLength(), Eq(position));
+        CheckBuffer(buffer, expected);
+    }
+
+    TEST(BitWriterTest, TestWritingQuadWordNearBufferEnd)
+    {
+        std::array<std::uint8_t, 12> buffer;
+        const std::uint8_t expected[] = {0x01, 0x02, 0x03, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE, 0x00};
+        BitWriter writer(buffer);
+        ASSERT_TRUE(writer.WriteDoubleWord(0x030201, 24));
+        ASSERT_TRUE(writer.WriteQuadWord(0xFEDCBA9876543210ull, 64));
+        ASSERT_TRUE(writer.WriteWord(0, 8));
+        ASSERT_FALSE(writer.WriteWord(0, 1));
+        CheckBuffer(buffer, gsl::make_span(expected));
+    }
 }
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "base/lzss.hpp"
+
+using testing::Eq;
+using testing::Ge;
+using testing::Le;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+
+namespace
+{
+    std::vector<std::uint8_t> Decompress(gsl::span<const std::uint8_t> input)
+    {
+        std::array<std::uint8_t, 4096> buffer;
+        const auto output = lzss::Decompress(input, buffer);
+        return std::vector<std::uint8_t>(output.begin(), output.end());
+    }
+
+    TEST(LzssTest, ShouldHandleEmptyInput)
+    {
+        std::array<std::uint8_t, 4> output;
+        const auto result = lzss::Compress(gsl::span<const std::uint8_t>(), output);
+
+        ASSERT_THAT(result.Consumed, Eq(0U));
+        ASSERT_THAT(result.Produced, Eq(0U));
+    }
+
+    TEST(LzssTest, ShouldEncodeLiterals)
+    {
+        std::array<std::uint8_t, 2> input{0xA5, 0x3C};
+        std::array<std::uint8_t, 4> output;
+        const auto result = lzss::Compress(input, output);
+
+        ASSERT_THAT(result.Consumed, Eq(2U));
+        ASSERT_THAT(result.Produced, Eq(3U));
+        ASSERT_THAT(output, ElementsAre(0x4B, 0xF3, 0x00, testing::_));
+    }
+
+    TEST(LzssTest, ShouldEncodeRunAsBackReferences)
+    {
+        std::array<std::uint8_t, 18> input;
+        input.fill(0xFF);
+        std::array<std::uint8_t, 8> output;
+        const auto result = lzss::Compress(input, output);
+
+        ASSERT_THAT(result.Consumed, Eq(18U));
+        ASSERT_THAT(result.Produced, Eq(3U));
+        ASSERT_THAT(Decompress(gsl::make_span(output).subspan(0, result.Produced)), ElementsAreArray(input));
+    }
+
+    TEST(LzssTest, ShouldCompressPaddingSeveralFold)
+    {
+        std::array<std::uint8_t, 2048> input;
+        input.fill(0xFF);
+        std::copy_n("experiment header", 17, input.begin());
+
+        std::array<std::uint8_t, 512> output;
+        const auto result = lzss::Compress(input, output);
+
+        ASSERT_THAT(result.Consumed, Eq(input.size()));
+        ASSERT_THAT(result.Produced * 8, Le(input.size()));
+        ASSERT_THAT(Decompress(gsl::make_span(output).subspan(0, result.Produced)), ElementsAreArray(input));
+    }
+
+    TEST(LzssTest, ShouldRoundTripRandomData)
+    {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> symbols(0, 3);
+
+        std::array<std::uint8_t, 1500> input;
+        std::generate(input.begin(), input.end(), [&]() { return static_cast<std::uint8_t>(symbols(generator)); });
+
+        std::array<std::uint8_t, 2000> output;
+        const auto result = lzss::Compress(input, output);
+
+        ASSERT_THAT(result.Consumed, Eq(input.size()));
+        ASSERT_THAT(Decompress(gsl::make_span(output).subspan(0, result.Produced)), ElementsAreArray(input));
+    }
+
+    TEST(LzssTest, ShouldRejectBackReferenceBeforeBeginningOfData)
+    {
+        std::array<std::uint8_t, 2> input{0x02, 0x00};
+        std::array<std::uint8_t, 16> output;
+
+        ASSERT_THAT(lzss::Decompress(input, output).size(), Eq(0));
+    }
+
+    TEST(LzssTest, ShouldRejectDataLongerThanOutputBuffer)
+    {
+        std::array<std::uint8_t, 64> input;
+        input.fill(0xFF);
+        std::array<std::uint8_t, 16> compressed;
+        const auto result = lzss::Compress(input, compressed);
+
+        std::array<std::uint8_t, 63> output;
+        ASSERT_THAT(lzss::Decompress(gsl::make_span(compressed).subspan(0, result.Produced), output).size(), Eq(0));
+    }
+
+    TEST(LzssTest, ShouldStopWhenOutputIsFull)
+    {
+        std::mt19937 generator(11);
+        std::uniform_int_distribution<int> bytes(0, 255);
+
+        std::array<std::uint8_t, 500> input;
+        std::generate(input.begin(), input.end(), [&]() { return static_cast<std::uint8_t>(bytes(generator)); });
+
+        std::array<std::uint8_t, 100> output;
+        const auto result = lzss::Compress(input, output);
+
+        ASSERT_THAT(result.Consumed, Ge(88U));
+        ASSERT_THAT(result.Produced, Le(output.size()));
+
+        const auto decompressed = Decompress(gsl::make_span(output).subspan(0, result.Produced));
+        ASSERT_THAT(decompressed, ElementsAreArray(input.begin(), input.begin() + result.Consumed));
+    }
+}
@@ -0,0 +1,90 @@
+#include <array>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/snapshot.hpp"
+
+using testing::Eq;
+using testing::ElementsAre;
+
+namespace
+{
+    using Value = std::array<std::uint8_t, 4>;
+
+    TEST(SnapshotTest, ShouldFailReadBeforeFirstPublication)
+    {
+        Snapshot<Value> snapshot;
+        Value value{{0, 0, 0, 0}};
+
+        ASSERT_THAT(snapshot.HasValue(), Eq(false));
+        ASSERT_THAT(snapshot.Get(value), Eq(false));
+    }
+
+    TEST(SnapshotTest, ShouldReadLastPublishedValue)
+    {
+        Snapshot<Value> snapshot;
+        snapshot.Publish({{1, 2, 3, 4}});
+        snapshot.Publish({{5, 6, 7, 8}});
+
+        Value value{{0, 0, 0, 0}};
+        ASSERT_THAT(snapshot.HasValue(), Eq(true));
+        ASSERT_THAT(snapshot.Get(value), Eq(true));
+        ASSERT_THAT(value, ElementsAre(5, 6, 7, 8));
+    }
+
+    TEST(SnapshotTest, ShouldAcceptReadOverlappingSinglePublication)
+    {
+        Snapshot<Value> snapshot;
+        snapshot.Publish({{1, 2, 3, 4}});
+
+        Value value{{0, 0, 0, 0}};
+        auto calls = 0;
+        auto status = snapshot.Read([&](const Value& current) {
+            calls++;
+            snapshot.Publish({{5, 6, 7, 8}});
+            value = current;
+        });
+
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(calls, Eq(1));
+        ASSERT_THAT(value, ElementsAre(1, 2, 3, 4));
+    }
+
+    TEST(SnapshotTest, ShouldRetryReadOverwrittenByWriter)
+    {
+        Snapshot<Value> snapshot;
+        snapshot.Publish({{1, 2, 3, 4}});
+
+        Value value{{0, 0, 0, 0}};
+        auto calls = 0;
+        auto status = snapshot.Read([&](const Value& current) {
+            if (calls++ == 0)
+            {
+                snapshot.Publish({{5, 6, 7, 8}});
+                snapshot.Publish({{9, 10, 11, 12}});
+            }
+
+            value = current;
+        });
+
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(calls, Eq(2));
+        ASSERT_THAT(value, ElementsAre(9, 10, 11, 12));
+    }
+
+    TEST(SnapshotTest, ShouldGiveUpWhenWriterKeepsOverwritingValue)
+    {
+        Snapshot<Value, 2> snapshot;
+        snapshot.Publish({{1, 2, 3, 4}});
+
+        auto calls = 0;
+        auto status = snapshot.Read([&](const Value& /*current*/) {
+            calls++;
+            snapshot.Publish({{5, 6, 7, 8}});
+            snapshot.Publish({{9, 10, 11, 12}});
+        });
+
+        ASSERT_THAT(status, Eq(false));
+        ASSERT_THAT(calls, Eq(2));
+    }
+}
@@ -99,8 +99,66 @@ namespace
         return this->byte;
     }
 
+    class FlagsObject
+    {
+      public:
+        static constexpr std::uint32_t Id = 9;
+
+        FlagsObject() : flags(0)
+        {
+        }
+
+        explicit FlagsObject(std::uint8_t newFlags) : flags(newFlags)
+        {
+        }
+
+        void Write(BitWriter& writer) const
+        {
+            writer.WriteWord(this->flags, BitSize());
+        }
+
+        static constexpr std::uint32_t BitSize()
+        {
+            return 3;
+        }
+
+      private:
+        std::uint8_t flags;
+    };
+
+    class ShortObject
+    {
+      public:
+        static constexpr std::uint32_t Id = 11;
+
+        ShortObject() : value(0)
+        {
+        }
+
+        explicit ShortObject(std::uint8_t newValue) : value(newValue)
+        {
+        }
+
+        void Write(BitWriter& writer) const
+        {
+            writer.WriteWord(this->value, 4);
+        }
+
+        static constexpr std::uint32_t BitSize()
+        {
+            return 12;
+        }
+
+      private:
+        std::uint8_t value;
+    };
+
     typedef telemetry::Telemetry<SimpleObject, ComplexObject> Telemetry;
 
+    typedef telemetry::Telemetry<FlagsObject, ComplexObject, SimpleObject> UnalignedTelemetry;
+
+    typedef telemetry::Telemetry<ShortObject, FlagsObject> ShortTelemetry;
+
     class TelemetryTest : public testing::Test
     {
       protected:
@@ -269,4 +327,117 @@ namespace
         auto span = writer.Capture();
         ASSERT_THAT(span, Eq(gsl::make_span(expected)));
     }
+
+    TEST_F(TelemetryTest, TestBitOffsets)
+    {
+        ASSERT_THAT(Telemetry::BitOffset<SimpleObject>(), Eq(0));
+        ASSERT_THAT(Telemetry::BitOffset<ComplexObject>(), Eq(32));
+        ASSERT_THAT(UnalignedTelemetry::BitOffset<ComplexObject>(), Eq(3));
+        ASSERT_THAT(UnalignedTelemetry::BitOffset<SimpleObject>(), Eq(27));
+    }
+
+    TEST_F(TelemetryTest, TestDefaultStateIsChanged)
+    {
+        ASSERT_THAT(telemetry.IsChanged(), Eq(true));
+    }
+
+    TEST_F(TelemetryTest, TestWriteChangedSerializesEntireTelemetryInitially)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> image;
+        image.fill(0xff);
+        std::uint8_t expected[] = {0xee, 0x77, 0xaa, 0x55, 0x0f, 0x00, 0x1a};
+        telemetry.Set(ComplexObject(15, 26));
+        telemetry.SetVolatile(SimpleObject(0x55aa77ee));
+
+        ASSERT_THAT(telemetry.WriteChanged(image), Eq(true));
+        ASSERT_THAT(gsl::make_span(image), Eq(gsl::make_span(expected)));
+        ASSERT_THAT(telemetry.IsChanged(), Eq(false));
+    }
+
+    TEST_F(TelemetryTest, TestSettingTheSameValueDoesNotChangeSerializedTelemetry)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> image;
+        telemetry.Set(SimpleObject(1));
+        telemetry.WriteChanged(image);
+
+        telemetry.Set(SimpleObject(1));
+
+        ASSERT_THAT(telemetry.IsChanged(), Eq(false));
+        ASSERT_THAT(telemetry.IsModified(), Eq(true));
+    }
+
+    TEST_F(TelemetryTest, TestWriteChangedUpdatesOnlyChangedElements)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> image;
+        std::uint8_t expected[] = {0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1a};
+        telemetry.Set(ComplexObject(15, 26));
+        telemetry.WriteChanged(image);
+
+        image[4] = 0x33;
+        telemetry.Set(SimpleObject(1));
+
+        ASSERT_THAT(telemetry.IsChanged(), Eq(true));
+        ASSERT_THAT(telemetry.WriteChanged(image), Eq(true));
+
+        expected[4] = 0x33;
+        ASSERT_THAT(gsl::make_span(image), Eq(gsl::make_span(expected)));
+    }
+
+    TEST_F(TelemetryTest, TestInvalidateSerializedForcesFullSerialization)
+    {
+        std::array<std::uint8_t, Telemetry::TotalSerializedSize> image;
+        std::uint8_t expected[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        telemetry.WriteChanged(image);
+
+        image.fill(0xaa);
+        telemetry.InvalidateSerialized();
+
+        ASSERT_THAT(telemetry.WriteChanged(image), Eq(true));
+        ASSERT_THAT(gsl::make_span(image), Eq(gsl::make_span(expected)));
+    }
+
+    TEST(UnalignedTelemetryTest, TestWriteChangedMatchesFullSerialization)
+    {
+        UnalignedTelemetry telemetry;
+        std::array<std::uint8_t, UnalignedTelemetry::TotalSerializedSize> image;
+        std::array<std::uint8_t, UnalignedTelemetry::TotalSerializedSize> full;
+        image.fill(0);
+        full.fill(0);
+
+        telemetry.Set(FlagsObject(5));
+        telemetry.Set(ComplexObject(0x1234, 0x56));
+        telemetry.Set(SimpleObject(0x89abcdef));
+        telemetry.WriteChanged(image);
+
+        telemetry.Set(ComplexObject(0xfedc, 0xba));
+        ASSERT_THAT(telemetry.WriteChanged(image), Eq(true));
+
+        BitWriter writer(full);
+        telemetry.Write(writer);
+        ASSERT_THAT(writer.Status(), Eq(true));
+        ASSERT_THAT(gsl::make_span(image), Eq(gsl::make_span(full)));
+    }
+
+    TEST(ShortTelemetryTest, TestFullAndChangedSerializationProduceSameImage)
+    {
+        ShortTelemetry telemetry;
+        std::array<std::uint8_t, ShortTelemetry::TotalSerializedSize> image;
+        std::array<std::uint8_t, ShortTelemetry::TotalSerializedSize> full;
+        std::uint8_t expected[] = {0x05, 0x20};
+        image.fill(0);
+        full.fill(0xff);
+
+        telemetry.Set(ShortObject(5));
+        telemetry.Set(FlagsObject(2));
+
+        ASSERT_THAT(telemetry.WriteChanged(image), Eq(true));
+
+        BitWriter writer(full);
+        telemetry.Write(writer);
+        ASSERT_THAT(writer.Status(), Eq(true));
+        ASSERT_THAT(writer.GetBitDataLength(), Eq(static_cast<std::uint32_t>(ShortTelemetry::PayloadSize)));
+
+        ASSERT_THAT(gsl::make_span(full), Eq(gsl::make_span(image)));
+        ASSERT_THAT(gsl::make_span(full), Eq(gsl::make_span(expected)));
+    }
 }
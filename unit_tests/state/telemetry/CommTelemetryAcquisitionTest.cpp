@@ -59,4 +59,21 @@ namespace
         Run();
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
     }
+
+    TEST(DownlinkQueueTelemetryAcquisitionTest, TestAcquisitionStateUpdate)
+    {
+        DownlinkQueueTelemetryProviderMock queue;
+        telemetry::TelemetryState state;
+        telemetry::DownlinkQueueTelemetryAcquisition task(queue);
+        auto descriptor = task.BuildUpdate();
+
+        EXPECT_CALL(queue, GetQueueTelemetry()).WillOnce(Return(DownlinkQueueTelemetry(2, 3, 1)));
+        const auto result = descriptor.Execute(state);
+
+        ASSERT_THAT(result, Eq(mission::UpdateResult::Ok));
+        ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
+        ASSERT_THAT(state.telemetry.Get<DownlinkQueueTelemetry>().Depth(), Eq(2));
+        ASSERT_THAT(state.telemetry.Get<DownlinkQueueTelemetry>().ControlDropped(), Eq(2));
+        ASSERT_THAT(state.telemetry.Get<DownlinkQueueTelemetry>().BulkDropped(), Eq(1));
+    }
 }
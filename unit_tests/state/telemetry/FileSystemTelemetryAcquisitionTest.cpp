@@ -37,7 +37,7 @@ namespace
 
     TEST_F(FileSystemTelemetryAcquisitionTest, TestAcquisitionFailure)
     {
-        EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0xffffffff));
+        EXPECT_CALL(mock, GetStatistics()).WillOnce(Return(FileSystemStatistics{0xffffffff, 0, 0, 0}));
         const auto result = Run();
         ASSERT_THAT(result, Eq(mission::UpdateResult::Warning));
         ASSERT_THAT(state.telemetry.IsModified(), Eq(false));
@@ -45,14 +45,22 @@ namespace
 
     TEST_F(FileSystemTelemetryAcquisitionTest, TestAcquisition)
     {
-        EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0x12345678u));
+        EXPECT_CALL(mock, GetStatistics()).WillOnce(Return(FileSystemStatistics{0x12345678u, 10, 2, 1}));
         const auto result = Run();
         ASSERT_THAT(result, Eq(mission::UpdateResult::Ok));
     }
 
+    TEST_F(FileSystemTelemetryAcquisitionTest, TestAcquisitionDoesNotAccessFlash)
+    {
+        EXPECT_CALL(mock, GetStatistics()).WillOnce(Return(FileSystemStatistics{0x12345678u, 10, 2, 1}));
+        EXPECT_CALL(mock, GetFreeSpace(_)).Times(0);
+        Run();
+        ASSERT_THAT(descriptor.resource, Eq(mission::UpdateResource::Cpu));
+    }
+
     TEST_F(FileSystemTelemetryAcquisitionTest, TestAcquisitionStateUpdate)
     {
-        EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0x12345678u));
+        EXPECT_CALL(mock, GetStatistics()).WillOnce(Return(FileSystemStatistics{0x12345678u, 10, 2, 1}));
         Run();
         ASSERT_THAT(state.telemetry.Get<telemetry::FileSystemTelemetry>().GetValue(), Eq(0x12345678u));
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));